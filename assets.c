@@ -0,0 +1,5383 @@
+// Generated by tools/build_assets.c from sprites.h and background.h - do not edit
+#include "assets.h"
+
+// goblin_D_Attack: 6 frames of 48x48, 7 colours
+static const unsigned short int goblin_D_Attack_palette[8] = {
+    0x0000, 0x0865, 0x7268, 0x84A8, 0xA589, 0x4385, 0xFF17, 0xB2C8, 
+};
+static const unsigned char goblin_D_Attack_rle_data[3088] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x31, 0x01, 0x01, 0x04, 0x11, 0x11, 
+    0x01, 0x03, 0x31, 0x01, 0x01, 0x12, 0x0C, 0x31, 0x13, 0x44, 0x44, 0x31, 0x13, 0x01, 0x12, 0x0C, 
+    0x31, 0x45, 0x44, 0x44, 0x54, 0x13, 0x01, 0x13, 0x0A, 0x51, 0x44, 0x44, 0x44, 0x15, 0x01, 0x14, 
+    0x08, 0x41, 0x44, 0x44, 0x14, 0x01, 0x14, 0x08, 0x31, 0x44, 0x44, 0x13, 0x01, 0x13, 0x0A, 0x31, 
+    0x33, 0x44, 0x33, 0x13, 0x02, 0x0D, 0x03, 0x11, 0x01, 0x02, 0x0C, 0x41, 0x34, 0x33, 0x33, 0x43, 
+    0x14, 0x01, 0x0C, 0x13, 0x21, 0x22, 0x11, 0x44, 0x44, 0x76, 0x67, 0x44, 0x44, 0x01, 0x01, 0x0C, 
+    0x14, 0x21, 0x22, 0x31, 0x44, 0x44, 0x34, 0x43, 0x44, 0x44, 0x13, 0x01, 0x0C, 0x14, 0x21, 0x22, 
+    0x32, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0x13, 0x01, 0x0D, 0x14, 0x21, 0x22, 0x33, 0x43, 0x44, 
+    0x44, 0x44, 0x34, 0x33, 0x13, 0x01, 0x0E, 0x13, 0x21, 0x22, 0x24, 0x43, 0x44, 0x44, 0x34, 0x42, 
+    0x33, 0x01, 0x01, 0x0F, 0x12, 0x21, 0x42, 0x22, 0x33, 0x33, 0x33, 0x22, 0x34, 0x14, 0x01, 0x0F, 
+    0x12, 0x41, 0x12, 0x22, 0x77, 0x27, 0x77, 0x22, 0x31, 0x14, 0x01, 0x0F, 0x12, 0x11, 0x11, 0x23, 
+    0x77, 0x77, 0x77, 0x32, 0x11, 0x11, 0x01, 0x12, 0x0C, 0x31, 0x73, 0x77, 0x72, 0x37, 0x13, 0x01, 
+    0x12, 0x0C, 0x31, 0x73, 0x77, 0x72, 0x37, 0x13, 0x01, 0x12, 0x0C, 0x31, 0x33, 0x11, 0x11, 0x33, 
+    0x13, 0x02, 0x12, 0x05, 0x31, 0x33, 0x01, 0x02, 0x05, 0x31, 0x33, 0x01, 0x02, 0x13, 0x02, 0x33, 
+    0x06, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 
+    0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x31, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x31, 
+    0x01, 0x01, 0x12, 0x0C, 0x31, 0x13, 0x44, 0x44, 0x31, 0x13, 0x01, 0x12, 0x0C, 0x31, 0x45, 0x44, 
+    0x44, 0x54, 0x13, 0x01, 0x13, 0x0A, 0x51, 0x44, 0x44, 0x44, 0x15, 0x01, 0x14, 0x08, 0x41, 0x44, 
+    0x44, 0x14, 0x01, 0x14, 0x08, 0x31, 0x44, 0x44, 0x13, 0x01, 0x13, 0x0A, 0x31, 0x33, 0x44, 0x33, 
+    0x13, 0x02, 0x12, 0x0C, 0x41, 0x34, 0x33, 0x33, 0x43, 0x14, 0x02, 0x03, 0x11, 0x01, 0x01, 0x11, 
+    0x13, 0x41, 0x44, 0x64, 0x77, 0x46, 0x44, 0x14, 0x21, 0x22, 0x01, 0x01, 0x10, 0x14, 0x31, 0x44, 
+    0x44, 0x34, 0x43, 0x44, 0x44, 0x13, 0x22, 0x12, 0x01, 0x10, 0x14, 0x31, 0x33, 0x44, 0x44, 0x44, 
+    0x44, 0x33, 0x23, 0x22, 0x12, 0x01, 0x0F, 0x14, 0x31, 0x33, 0x43, 0x44, 0x44, 0x44, 0x34, 0x33, 
+    0x22, 0x12, 0x01, 0x0F, 0x13, 0x31, 0x43, 0x32, 0x44, 0x44, 0x44, 0x23, 0x24, 0x22, 0x01, 0x01, 
+    0x0F, 0x12, 0x41, 0x43, 0x22, 0x33, 0x33, 0x33, 0x22, 0x24, 0x12, 0x01, 0x0F, 0x12, 0x41, 0x13, 
+    0x22, 0x77, 0x72, 0x77, 0x22, 0x21, 0x14, 0x01, 0x0F, 0x12, 0x11, 0x11, 0x23, 0x77, 0x77, 0x77, 
+    0x32, 0x11, 0x11, 0x01, 0x12, 0x0C, 0x31, 0x73, 0x27, 0x77, 0x37, 0x13, 0x01, 0x12, 0x0C, 0x31, 
+    0x73, 0x27, 0x77, 0x37, 0x13, 0x01, 0x12, 0x0C, 0x31, 0x33, 0x11, 0x11, 0x33, 0x13, 0x02, 0x12, 
+    0x05, 0x31, 0x33, 0x01, 0x02, 0x05, 0x31, 0x33, 0x01, 0x02, 0x13, 0x02, 0x33, 0x06, 0x02, 0x33, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0E, 0x03, 0x11, 0x01, 0x01, 0x02, 
+    0x11, 0x03, 0x0D, 0x08, 0x21, 0x22, 0x11, 0x13, 0x01, 0x04, 0x11, 0x11, 0x02, 0x02, 0x11, 0x01, 
+    0x0C, 0x12, 0x21, 0x22, 0x12, 0x31, 0x13, 0x44, 0x44, 0x11, 0x13, 0x01, 0x0C, 0x12, 0x21, 0x22, 
+    0x12, 0x31, 0x45, 0x44, 0x44, 0x34, 0x13, 0x02, 0x0C, 0x06, 0x21, 0x22, 0x12, 0x01, 0x0B, 0x51, 
+    0x44, 0x44, 0x44, 0x35, 0x01, 0x02, 0x0C, 0x06, 0x21, 0x22, 0x12, 0x02, 0x09, 0x41, 0x44, 0x44, 
+    0x54, 0x01, 0x02, 0x0D, 0x05, 0x21, 0x22, 0x01, 0x02, 0x08, 0x31, 0x44, 0x44, 0x13, 0x02, 0x0D, 
+    0x05, 0x21, 0x22, 0x01, 0x01, 0x09, 0x31, 0x33, 0x44, 0x33, 0x01, 0x01, 0x0D, 0x10, 0x21, 0x22, 
+    0x11, 0x44, 0x63, 0x77, 0x36, 0x13, 0x01, 0x0D, 0x11, 0x11, 0x42, 0x43, 0x44, 0x63, 0x77, 0x36, 
+    0x44, 0x01, 0x01, 0x0D, 0x12, 0x41, 0x42, 0x43, 0x44, 0x44, 0x33, 0x44, 0x44, 0x14, 0x01, 0x0D, 
+    0x13, 0x41, 0x22, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44, 0x34, 0x01, 0x01, 0x0E, 0x12, 0x21, 0x12, 
+    0x31, 0x44, 0x44, 0x44, 0x44, 0x33, 0x13, 0x02, 0x0E, 0x03, 0x11, 0x01, 0x01, 0x0E, 0x21, 0x43, 
+    0x44, 0x44, 0x44, 0x33, 0x13, 0x01, 0x12, 0x0D, 0x21, 0x32, 0x33, 0x44, 0x54, 0x44, 0x01, 0x01, 
+    0x12, 0x0D, 0x21, 0x72, 0x77, 0x33, 0x45, 0x44, 0x01, 0x01, 0x12, 0x0C, 0x31, 0x72, 0x77, 0x72, 
+    0x47, 0x14, 0x01, 0x12, 0x0C, 0x41, 0x74, 0x77, 0x77, 0x27, 0x13, 0x01, 0x12, 0x0C, 0x41, 0x44, 
+    0x77, 0x72, 0x37, 0x13, 0x01, 0x12, 0x0C, 0x41, 0x44, 0x11, 0x71, 0x37, 0x13, 0x02, 0x12, 0x04, 
+    0x11, 0x11, 0x03, 0x05, 0x31, 0x33, 0x01, 0x01, 0x19, 0x05, 0x31, 0x33, 0x01, 0x01, 0x1B, 0x02, 
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1C, 0x02, 0x11, 0x01, 0x03, 
+    0x11, 0x01, 0x03, 0x12, 0x02, 0x11, 0x02, 0x04, 0x11, 0x11, 0x01, 0x08, 0x31, 0x11, 0x22, 0x12, 
+    0x01, 0x12, 0x12, 0x31, 0x11, 0x44, 0x44, 0x31, 0x13, 0x21, 0x22, 0x12, 0x01, 0x12, 0x12, 0x31, 
+    0x43, 0x44, 0x44, 0x54, 0x13, 0x21, 0x22, 0x12, 0x02, 0x12, 0x0B, 0x31, 0x45, 0x44, 0x44, 0x54, 
+    0x01, 0x01, 0x06, 0x21, 0x22, 0x12, 0x02, 0x13, 0x09, 0x51, 0x44, 0x44, 0x44, 0x01, 0x02, 0x06, 
+    0x21, 0x22, 0x12, 0x02, 0x14, 0x08, 0x31, 0x44, 0x44, 0x13, 0x02, 0x05, 0x21, 0x22, 0x01, 0x02, 
+    0x14, 0x09, 0x31, 0x43, 0x34, 0x33, 0x01, 0x01, 0x05, 0x21, 0x22, 0x01, 0x01, 0x13, 0x10, 0x31, 
+    0x63, 0x77, 0x36, 0x44, 0x11, 0x22, 0x12, 0x01, 0x12, 0x11, 0x41, 0x34, 0x76, 0x67, 0x43, 0x44, 
+    0x43, 0x12, 0x01, 0x01, 0x11, 0x12, 0x41, 0x44, 0x44, 0x33, 0x44, 0x44, 0x34, 0x24, 0x14, 0x01, 
+    0x10, 0x13, 0x31, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x23, 0x42, 0x01, 0x01, 0x10, 0x12, 0x31, 
+    0x33, 0x44, 0x44, 0x44, 0x44, 0x13, 0x21, 0x12, 0x02, 0x10, 0x0E, 0x31, 0x33, 0x44, 0x44, 0x44, 
+    0x34, 0x12, 0x01, 0x03, 0x11, 0x01, 0x01, 0x11, 0x0D, 0x41, 0x54, 0x44, 0x34, 0x33, 0x22, 0x01, 
+    0x01, 0x11, 0x0D, 0x41, 0x44, 0x35, 0x73, 0x77, 0x22, 0x01, 0x01, 0x12, 0x0C, 0x41, 0x74, 0x27, 
+    0x77, 0x27, 0x13, 0x01, 0x12, 0x0C, 0x31, 0x72, 0x77, 0x77, 0x47, 0x14, 0x01, 0x12, 0x0C, 0x31, 
+    0x73, 0x27, 0x77, 0x44, 0x14, 0x01, 0x12, 0x0C, 0x31, 0x73, 0x17, 0x11, 0x44, 0x14, 0x02, 0x12, 
+    0x05, 0x31, 0x33, 0x01, 0x03, 0x04, 0x11, 0x11, 0x01, 0x12, 0x05, 0x31, 0x33, 0x01, 0x01, 0x13, 
+    0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x03, 0x11, 0x01, 0x01, 0x12, 0x05, 0x21, 
+    0x22, 0x01, 0x01, 0x12, 0x06, 0x21, 0x22, 0x12, 0x01, 0x11, 0x07, 0x21, 0x22, 0x22, 0x01, 0x01, 
+    0x11, 0x06, 0x21, 0x22, 0x12, 0x02, 0x10, 0x0A, 0x21, 0x32, 0x12, 0x11, 0x11, 0x02, 0x02, 0x11, 
+    0x01, 0x10, 0x0E, 0x21, 0x32, 0x13, 0x44, 0x44, 0x11, 0x13, 0x01, 0x0F, 0x0F, 0x41, 0x22, 0x53, 
+    0x44, 0x44, 0x44, 0x33, 0x01, 0x01, 0x0F, 0x0F, 0x41, 0x42, 0x51, 0x44, 0x44, 0x44, 0x35, 0x01, 
+    0x01, 0x0E, 0x0F, 0x21, 0x22, 0x14, 0x41, 0x44, 0x44, 0x54, 0x01, 0x01, 0x0E, 0x0E, 0x21, 0x32, 
+    0x13, 0x31, 0x44, 0x44, 0x13, 0x01, 0x0E, 0x0E, 0x21, 0x32, 0x44, 0x33, 0x43, 0x34, 0x13, 0x01, 
+    0x0F, 0x0E, 0x11, 0x43, 0x44, 0x63, 0x77, 0x36, 0x13, 0x01, 0x10, 0x0E, 0x31, 0x43, 0x34, 0x76, 
+    0x67, 0x43, 0x14, 0x01, 0x11, 0x0E, 0x31, 0x43, 0x44, 0x33, 0x44, 0x44, 0x14, 0x01, 0x12, 0x0D, 
+    0x31, 0x44, 0x44, 0x44, 0x34, 0x44, 0x01, 0x01, 0x12, 0x0D, 0x31, 0x44, 0x44, 0x44, 0x34, 0x33, 
+    0x01, 0x01, 0x12, 0x0D, 0x21, 0x43, 0x44, 0x54, 0x33, 0x33, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x32, 
+    0x33, 0x45, 0x44, 0x13, 0x01, 0x12, 0x0C, 0x21, 0x72, 0x77, 0x45, 0x44, 0x12, 0x01, 0x11, 0x0D, 
+    0x41, 0x44, 0x77, 0x27, 0x77, 0x22, 0x01, 0x01, 0x11, 0x0D, 0x41, 0x44, 0x77, 0x77, 0x77, 0x32, 
+    0x01, 0x01, 0x11, 0x0D, 0x41, 0x44, 0x77, 0x27, 0x77, 0x33, 0x01, 0x01, 0x11, 0x0D, 0x11, 0x11, 
+    0x11, 0x11, 0x77, 0x33, 0x01, 0x01, 0x19, 0x05, 0x31, 0x33, 0x01, 0x01, 0x19, 0x05, 0x31, 0x33, 
+    0x01, 0x01, 0x1B, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1A, 0x03, 0x11, 0x01, 0x01, 
+    0x19, 0x05, 0x21, 0x22, 0x01, 0x01, 0x18, 0x06, 0x21, 0x22, 0x12, 0x01, 0x18, 0x07, 0x21, 0x22, 
+    0x22, 0x01, 0x01, 0x19, 0x06, 0x21, 0x22, 0x12, 0x02, 0x12, 0x02, 0x11, 0x02, 0x0A, 0x11, 0x11, 
+    0x21, 0x23, 0x12, 0x01, 0x12, 0x0E, 0x31, 0x11, 0x44, 0x44, 0x31, 0x23, 0x12, 0x01, 0x12, 0x0F, 
+    0x31, 0x43, 0x44, 0x44, 0x54, 0x23, 0x42, 0x01, 0x01, 0x12, 0x0F, 0x31, 0x45, 0x44, 0x44, 0x54, 
+    0x41, 0x42, 0x01, 0x01, 0x13, 0x0F, 0x51, 0x44, 0x44, 0x44, 0x11, 0x24, 0x22, 0x01, 0x01, 0x14, 
+    0x0E, 0x31, 0x44, 0x44, 0x13, 0x31, 0x23, 0x12, 0x01, 0x14, 0x0E, 0x31, 0x43, 0x34, 0x33, 0x44, 
+    0x23, 0x12, 0x01, 0x13, 0x0E, 0x31, 0x63, 0x77, 0x36, 0x44, 0x34, 0x11, 0x01, 0x12, 0x0E, 0x41, 
+    0x34, 0x76, 0x67, 0x43, 0x34, 0x13, 0x01, 0x11, 0x0E, 0x41, 0x44, 0x44, 0x33, 0x44, 0x34, 0x13, 
+    0x01, 0x11, 0x0D, 0x41, 0x34, 0x44, 0x44, 0x44, 0x34, 0x01, 0x01, 0x11, 0x0D, 0x31, 0x33, 0x44, 
+    0x44, 0x44, 0x34, 0x01, 0x01, 0x11, 0x0D, 0x31, 0x33, 0x53, 0x44, 0x44, 0x23, 0x01, 0x01, 0x12, 
+    0x0C, 0x31, 0x44, 0x54, 0x33, 0x23, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x44, 0x54, 0x77, 0x27, 0x12, 
+    0x01, 0x12, 0x0D, 0x21, 0x72, 0x27, 0x77, 0x47, 0x44, 0x01, 0x01, 0x12, 0x0D, 0x31, 0x72, 0x77, 
+    0x77, 0x47, 0x44, 0x01, 0x01, 0x12, 0x0D, 0x31, 0x73, 0x27, 0x77, 0x47, 0x44, 0x01, 0x01, 0x12, 
+    0x0D, 0x31, 0x73, 0x17, 0x11, 0x11, 0x11, 0x01, 0x01, 0x12, 0x05, 0x31, 0x33, 0x01, 0x01, 0x12, 
+    0x05, 0x31, 0x33, 0x01, 0x01, 0x13, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 
+    0x03, 0x11, 0x01, 0x01, 0x14, 0x05, 0x21, 0x22, 0x01, 0x01, 0x13, 0x06, 0x21, 0x22, 0x12, 0x01, 
+    0x12, 0x07, 0x21, 0x22, 0x22, 0x01, 0x02, 0x11, 0x09, 0x21, 0x23, 0x22, 0x11, 0x01, 0x02, 0x02, 
+    0x11, 0x01, 0x10, 0x0E, 0x41, 0x32, 0x23, 0x44, 0x44, 0x11, 0x13, 0x01, 0x0F, 0x0F, 0x41, 0x22, 
+    0x53, 0x44, 0x44, 0x44, 0x33, 0x01, 0x01, 0x0E, 0x10, 0x21, 0x22, 0x14, 0x45, 0x44, 0x44, 0x54, 
+    0x13, 0x01, 0x0E, 0x0F, 0x21, 0x32, 0x14, 0x41, 0x44, 0x44, 0x54, 0x01, 0x01, 0x0F, 0x0D, 0x11, 
+    0x33, 0x11, 0x43, 0x44, 0x34, 0x01, 0x01, 0x10, 0x0C, 0x31, 0x44, 0x33, 0x43, 0x34, 0x13, 0x01, 
+    0x10, 0x0D, 0x31, 0x44, 0x34, 0x76, 0x67, 0x33, 0x01, 0x01, 0x10, 0x0E, 0x31, 0x43, 0x34, 0x76, 
+    0x67, 0x43, 0x14, 0x01, 0x11, 0x0E, 0x31, 0x43, 0x44, 0x33, 0x44, 0x44, 0x14, 0x01, 0x12, 0x0D, 
+    0x31, 0x44, 0x44, 0x44, 0x34, 0x44, 0x01, 0x01, 0x12, 0x0D, 0x31, 0x44, 0x44, 0x44, 0x34, 0x33, 
+    0x01, 0x01, 0x12, 0x0D, 0x21, 0x43, 0x44, 0x54, 0x33, 0x33, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x32, 
+    0x33, 0x45, 0x44, 0x13, 0x01, 0x12, 0x0C, 0x21, 0x72, 0x77, 0x45, 0x44, 0x12, 0x01, 0x11, 0x0D, 
+    0x41, 0x44, 0x77, 0x27, 0x77, 0x22, 0x01, 0x01, 0x11, 0x0D, 0x41, 0x44, 0x77, 0x77, 0x77, 0x32, 
+    0x01, 0x01, 0x11, 0x0D, 0x41, 0x44, 0x77, 0x27, 0x77, 0x33, 0x01, 0x01, 0x11, 0x0D, 0x11, 0x11, 
+    0x11, 0x11, 0x77, 0x33, 0x01, 0x01, 0x19, 0x05, 0x31, 0x33, 0x01, 0x01, 0x19, 0x05, 0x31, 0x33, 
+    0x01, 0x01, 0x1B, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x03, 0x11, 0x01, 
+    0x01, 0x17, 0x05, 0x21, 0x22, 0x01, 0x01, 0x17, 0x06, 0x21, 0x22, 0x12, 0x01, 0x17, 0x07, 0x21, 
+    0x22, 0x22, 0x01, 0x02, 0x12, 0x02, 0x11, 0x02, 0x09, 0x11, 0x21, 0x22, 0x23, 0x01, 0x01, 0x12, 
+    0x0E, 0x31, 0x11, 0x44, 0x44, 0x32, 0x23, 0x14, 0x01, 0x12, 0x0F, 0x31, 0x43, 0x44, 0x44, 0x54, 
+    0x23, 0x42, 0x01, 0x01, 0x12, 0x10, 0x31, 0x45, 0x44, 0x44, 0x54, 0x41, 0x22, 0x12, 0x01, 0x13, 
+    0x0F, 0x51, 0x44, 0x44, 0x44, 0x11, 0x34, 0x22, 0x01, 0x01, 0x14, 0x0D, 0x31, 0x44, 0x44, 0x13, 
+    0x31, 0x13, 0x01, 0x01, 0x14, 0x0C, 0x31, 0x43, 0x34, 0x33, 0x44, 0x13, 0x01, 0x13, 0x0D, 0x31, 
+    0x63, 0x77, 0x36, 0x44, 0x34, 0x01, 0x01, 0x12, 0x0E, 0x41, 0x34, 0x76, 0x67, 0x43, 0x34, 0x13, 
+    0x01, 0x11, 0x0E, 0x41, 0x44, 0x44, 0x33, 0x44, 0x34, 0x13, 0x01, 0x11, 0x0D, 0x41, 0x34, 0x44, 
+    0x44, 0x44, 0x34, 0x01, 0x01, 0x11, 0x0D, 0x31, 0x33, 0x44, 0x44, 0x44, 0x34, 0x01, 0x01, 0x11, 
+    0x0D, 0x31, 0x33, 0x53, 0x44, 0x44, 0x23, 0x01, 0x01, 0x12, 0x0C, 0x31, 0x44, 0x54, 0x33, 0x23, 
+    0x12, 0x01, 0x12, 0x0C, 0x21, 0x44, 0x54, 0x77, 0x27, 0x12, 0x01, 0x12, 0x0D, 0x21, 0x72, 0x27, 
+    0x77, 0x47, 0x44, 0x01, 0x01, 0x12, 0x0D, 0x31, 0x72, 0x77, 0x77, 0x47, 0x44, 0x01, 0x01, 0x12, 
+    0x0D, 0x31, 0x73, 0x27, 0x77, 0x47, 0x44, 0x01, 0x01, 0x12, 0x0D, 0x31, 0x73, 0x17, 0x11, 0x11, 
+    0x11, 0x01, 0x01, 0x12, 0x05, 0x31, 0x33, 0x01, 0x01, 0x12, 0x05, 0x31, 0x33, 0x01, 0x01, 0x13, 
+    0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 
+    0x12, 0x08, 0x02, 0x11, 0x03, 0x11, 0x04, 0x22, 0x13, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x31, 
+    0x01, 0x01, 0x11, 0x0D, 0x22, 0x33, 0x41, 0x44, 0x14, 0x33, 0x01, 0x01, 0x11, 0x0D, 0x22, 0x53, 
+    0x44, 0x44, 0x44, 0x35, 0x01, 0x01, 0x11, 0x0C, 0x22, 0x51, 0x44, 0x44, 0x44, 0x15, 0x02, 0x10, 
+    0x03, 0x22, 0x02, 0x01, 0x08, 0x41, 0x44, 0x44, 0x14, 0x02, 0x10, 0x03, 0x22, 0x02, 0x01, 0x08, 
+    0x31, 0x44, 0x44, 0x13, 0x01, 0x10, 0x0E, 0x22, 0x12, 0x33, 0x43, 0x34, 0x33, 0x11, 0x01, 0x10, 
+    0x0F, 0x22, 0x32, 0x33, 0x76, 0x67, 0x33, 0x44, 0x01, 0x01, 0x10, 0x10, 0x22, 0x22, 0x33, 0x76, 
+    0x67, 0x33, 0x44, 0x14, 0x01, 0x10, 0x11, 0x22, 0x22, 0x44, 0x34, 0x43, 0x44, 0x43, 0x34, 0x01, 
+    0x01, 0x10, 0x11, 0x22, 0x22, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x01, 0x01, 0x10, 0x12, 0x22, 
+    0x22, 0x42, 0x44, 0x44, 0x44, 0x12, 0x34, 0x13, 0x01, 0x10, 0x12, 0x22, 0x22, 0x42, 0x44, 0x44, 
+    0x24, 0x12, 0x34, 0x14, 0x01, 0x10, 0x12, 0x22, 0x22, 0x22, 0x77, 0x72, 0x27, 0x12, 0x31, 0x14, 
+    0x02, 0x10, 0x0E, 0x21, 0x22, 0x22, 0x77, 0x77, 0x27, 0x13, 0x01, 0x03, 0x11, 0x01, 0x01, 0x10, 
+    0x0E, 0x21, 0x22, 0x22, 0x72, 0x72, 0x37, 0x13, 0x01, 0x10, 0x0E, 0x21, 0x22, 0x22, 0x72, 0x72, 
+    0x37, 0x13, 0x01, 0x11, 0x0D, 0x21, 0x22, 0x22, 0x11, 0x31, 0x33, 0x01, 0x02, 0x12, 0x05, 0x21, 
+    0x22, 0x01, 0x02, 0x05, 0x31, 0x33, 0x01, 0x02, 0x13, 0x02, 0x33, 0x06, 0x02, 0x33, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x21, 
+    0x03, 0x12, 0x03, 0x31, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x04, 0x31, 0x22, 0x01, 0x12, 0x0D, 
+    0x31, 0x13, 0x44, 0x44, 0x31, 0x23, 0x02, 0x01, 0x12, 0x0D, 0x31, 0x45, 0x44, 0x44, 0x54, 0x23, 
+    0x02, 0x01, 0x13, 0x0C, 0x51, 0x44, 0x44, 0x44, 0x15, 0x22, 0x02, 0x14, 0x08, 0x41, 0x44, 0x44, 
+    0x14, 0x01, 0x03, 0x22, 0x02, 0x02, 0x14, 0x08, 0x31, 0x44, 0x44, 0x13, 0x01, 0x03, 0x22, 0x02, 
+    0x01, 0x12, 0x0E, 0x11, 0x33, 0x43, 0x34, 0x33, 0x21, 0x22, 0x01, 0x11, 0x0F, 0x41, 0x34, 0x63, 
+    0x77, 0x36, 0x33, 0x22, 0x02, 0x01, 0x10, 0x10, 0x41, 0x44, 0x33, 0x76, 0x67, 0x33, 0x22, 0x22, 
+    0x01, 0x0F, 0x11, 0x31, 0x44, 0x43, 0x44, 0x33, 0x44, 0x24, 0x22, 0x02, 0x01, 0x0F, 0x11, 0x31, 
+    0x33, 0x43, 0x44, 0x44, 0x44, 0x24, 0x22, 0x02, 0x01, 0x0E, 0x12, 0x31, 0x43, 0x21, 0x44, 0x44, 
+    0x44, 0x24, 0x22, 0x22, 0x01, 0x0E, 0x12, 0x41, 0x43, 0x21, 0x42, 0x44, 0x44, 0x24, 0x22, 0x22, 
+    0x01, 0x0E, 0x12, 0x41, 0x13, 0x21, 0x72, 0x27, 0x77, 0x22, 0x22, 0x22, 0x02, 0x0E, 0x03, 0x11, 
+    0x01, 0x01, 0x0E, 0x31, 0x72, 0x77, 0x77, 0x22, 0x22, 0x12, 0x01, 0x12, 0x0E, 0x31, 0x73, 0x27, 
+    0x27, 0x22, 0x22, 0x12, 0x01, 0x12, 0x0E, 0x31, 0x73, 0x27, 0x27, 0x22, 0x22, 0x12, 0x01, 0x12, 
+    0x0D, 0x31, 0x33, 0x11, 0x21, 0x22, 0x22, 0x01, 0x02, 0x12, 0x05, 0x31, 0x33, 0x01, 0x02, 0x05, 
+    0x21, 0x22, 0x01, 0x02, 0x13, 0x02, 0x33, 0x06, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x31, 0x01, 
+    0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x31, 0x01, 0x01, 0x12, 0x0C, 0x31, 0x13, 0x44, 0x44, 0x31, 
+    0x13, 0x01, 0x12, 0x0C, 0x31, 0x45, 0x44, 0x44, 0x54, 0x13, 0x01, 0x13, 0x0A, 0x51, 0x44, 0x44, 
+    0x44, 0x15, 0x01, 0x14, 0x08, 0x41, 0x44, 0x44, 0x14, 0x01, 0x14, 0x08, 0x31, 0x44, 0x44, 0x13, 
+    0x01, 0x13, 0x0A, 0x31, 0x33, 0x44, 0x33, 0x13, 0x01, 0x12, 0x0C, 0x41, 0x34, 0x33, 0x33, 0x43, 
+    0x14, 0x01, 0x11, 0x0E, 0x31, 0x44, 0x64, 0x77, 0x46, 0x44, 0x14, 0x01, 0x11, 0x0F, 0x31, 0x44, 
+    0x44, 0x33, 0x44, 0x44, 0x34, 0x01, 0x01, 0x10, 0x10, 0x31, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 
+    0x13, 0x01, 0x10, 0x11, 0x31, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x01, 0x01, 0x10, 0x11, 
+    0x31, 0x23, 0x43, 0x44, 0x44, 0x34, 0x42, 0x33, 0x01, 0x01, 0x10, 0x11, 0x31, 0x24, 0x32, 0x33, 
+    0x33, 0x23, 0x42, 0x43, 0x01, 0x01, 0x0F, 0x12, 0x21, 0x42, 0x22, 0x77, 0x27, 0x77, 0x22, 0x31, 
+    0x14, 0x01, 0x0E, 0x13, 0x21, 0x22, 0x32, 0x72, 0x77, 0x77, 0x27, 0x13, 0x11, 0x01, 0x01, 0x0D, 
+    0x11, 0x21, 0x22, 0x22, 0x33, 0x77, 0x27, 0x77, 0x33, 0x01, 0x01, 0x0D, 0x11, 0x21, 0x22, 0x12, 
+    0x33, 0x77, 0x27, 0x77, 0x33, 0x01, 0x01, 0x0D, 0x11, 0x21, 0x22, 0x11, 0x33, 0x13, 0x11, 0x31, 
+    0x33, 0x01, 0x03, 0x0E, 0x03, 0x11, 0x01, 0x01, 0x05, 0x31, 0x33, 0x01, 0x02, 0x05, 0x31, 0x33, 
+    0x01, 0x02, 0x13, 0x02, 0x33, 0x06, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x31, 0x01, 0x01, 0x04, 
+    0x11, 0x11, 0x01, 0x03, 0x31, 0x01, 0x01, 0x12, 0x0C, 0x31, 0x13, 0x44, 0x44, 0x31, 0x13, 0x01, 
+    0x12, 0x0C, 0x31, 0x45, 0x44, 0x44, 0x54, 0x13, 0x01, 0x13, 0x0A, 0x51, 0x44, 0x44, 0x44, 0x15, 
+    0x01, 0x14, 0x08, 0x41, 0x44, 0x44, 0x14, 0x01, 0x14, 0x08, 0x31, 0x44, 0x44, 0x13, 0x01, 0x13, 
+    0x0A, 0x31, 0x33, 0x44, 0x33, 0x13, 0x01, 0x12, 0x0C, 0x41, 0x34, 0x33, 0x33, 0x43, 0x14, 0x01, 
+    0x11, 0x0E, 0x41, 0x44, 0x64, 0x77, 0x46, 0x44, 0x13, 0x01, 0x10, 0x0F, 0x31, 0x44, 0x44, 0x34, 
+    0x43, 0x44, 0x34, 0x01, 0x01, 0x10, 0x10, 0x31, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0x13, 0x01, 
+    0x0F, 0x11, 0x31, 0x33, 0x43, 0x44, 0x44, 0x44, 0x34, 0x33, 0x01, 0x01, 0x0F, 0x11, 0x31, 0x43, 
+    0x32, 0x44, 0x44, 0x44, 0x23, 0x33, 0x01, 0x01, 0x0F, 0x11, 0x41, 0x43, 0x22, 0x33, 0x33, 0x33, 
+    0x22, 0x34, 0x01, 0x01, 0x0F, 0x12, 0x41, 0x13, 0x22, 0x77, 0x72, 0x77, 0x22, 0x24, 0x12, 0x01, 
+    0x0F, 0x13, 0x11, 0x11, 0x23, 0x77, 0x77, 0x77, 0x32, 0x22, 0x22, 0x01, 0x01, 0x12, 0x11, 0x31, 
+    0x73, 0x27, 0x77, 0x37, 0x23, 0x22, 0x22, 0x01, 0x01, 0x12, 0x11, 0x31, 0x73, 0x27, 0x77, 0x37, 
+    0x13, 0x22, 0x22, 0x01, 0x01, 0x12, 0x11, 0x31, 0x33, 0x11, 0x11, 0x33, 0x13, 0x21, 0x22, 0x01, 
+    0x03, 0x12, 0x05, 0x31, 0x33, 0x01, 0x02, 0x05, 0x31, 0x33, 0x01, 0x01, 0x03, 0x11, 0x01, 0x02, 
+    0x13, 0x02, 0x33, 0x06, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+const RLESprite goblin_D_Attack_rle[6] = {
+    {48, 48, 4, goblin_D_Attack_palette, {goblin_D_Attack_rle_data + 0, goblin_D_Attack_rle_data + 253}},
+    {48, 48, 4, goblin_D_Attack_palette, {goblin_D_Attack_rle_data + 506, goblin_D_Attack_rle_data + 779}},
+    {48, 48, 4, goblin_D_Attack_palette, {goblin_D_Attack_rle_data + 1052, goblin_D_Attack_rle_data + 1311}},
+    {48, 48, 4, goblin_D_Attack_palette, {goblin_D_Attack_rle_data + 1570, goblin_D_Attack_rle_data + 1823}},
+    {48, 48, 4, goblin_D_Attack_palette, {goblin_D_Attack_rle_data + 2076, goblin_D_Attack_rle_data + 2328}},
+    {48, 48, 4, goblin_D_Attack_palette, {goblin_D_Attack_rle_data + 2580, goblin_D_Attack_rle_data + 2834}},
+};
+
+// goblin_D_Walk: 6 frames of 48x48, 7 colours
+static const unsigned short int goblin_D_Walk_palette[8] = {
+    0x0000, 0x0865, 0x84A8, 0xA589, 0x4385, 0x7268, 0xFF17, 0xB2C8, 
+};
+static const unsigned char goblin_D_Walk_rle_data[2964] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 0x11, 
+    0x01, 0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 0x0C, 
+    0x21, 0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 0x33, 0x33, 0x14, 0x01, 0x14, 
+    0x08, 0x31, 0x33, 0x33, 0x13, 0x01, 0x14, 0x08, 0x21, 0x33, 0x33, 0x12, 0x01, 0x13, 0x0A, 0x21, 
+    0x22, 0x33, 0x22, 0x12, 0x02, 0x0E, 0x03, 0x11, 0x01, 0x01, 0x0C, 0x31, 0x23, 0x22, 0x22, 0x32, 
+    0x13, 0x01, 0x0D, 0x12, 0x51, 0x55, 0x31, 0x33, 0x63, 0x77, 0x36, 0x33, 0x12, 0x01, 0x0D, 0x12, 
+    0x51, 0x55, 0x32, 0x33, 0x33, 0x22, 0x33, 0x23, 0x12, 0x01, 0x0D, 0x13, 0x51, 0x55, 0x22, 0x32, 
+    0x33, 0x33, 0x33, 0x23, 0x22, 0x01, 0x01, 0x0E, 0x12, 0x51, 0x55, 0x22, 0x33, 0x33, 0x33, 0x33, 
+    0x22, 0x12, 0x01, 0x0E, 0x12, 0x51, 0x55, 0x53, 0x32, 0x33, 0x33, 0x23, 0x25, 0x14, 0x01, 0x0F, 
+    0x11, 0x51, 0x35, 0x55, 0x22, 0x22, 0x22, 0x55, 0x44, 0x01, 0x01, 0x0F, 0x11, 0x31, 0x15, 0x55, 
+    0x77, 0x57, 0x77, 0x55, 0x44, 0x01, 0x01, 0x0F, 0x11, 0x11, 0x11, 0x52, 0x77, 0x77, 0x77, 0x25, 
+    0x11, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x72, 0x77, 0x75, 0x27, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x72, 
+    0x77, 0x75, 0x27, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x22, 0x11, 0x11, 0x22, 0x12, 0x02, 0x12, 0x05, 
+    0x21, 0x22, 0x01, 0x03, 0x03, 0x11, 0x01, 0x01, 0x13, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 
+    0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 
+    0x21, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 
+    0x33, 0x33, 0x14, 0x01, 0x14, 0x08, 0x31, 0x33, 0x33, 0x13, 0x01, 0x14, 0x08, 0x21, 0x33, 0x33, 
+    0x12, 0x01, 0x13, 0x0A, 0x21, 0x22, 0x33, 0x22, 0x12, 0x02, 0x12, 0x0C, 0x31, 0x23, 0x22, 0x22, 
+    0x32, 0x13, 0x01, 0x03, 0x11, 0x01, 0x01, 0x11, 0x12, 0x21, 0x33, 0x63, 0x77, 0x36, 0x33, 0x13, 
+    0x55, 0x15, 0x01, 0x11, 0x12, 0x21, 0x32, 0x33, 0x22, 0x33, 0x33, 0x23, 0x55, 0x15, 0x01, 0x10, 
+    0x13, 0x21, 0x22, 0x33, 0x33, 0x33, 0x33, 0x22, 0x52, 0x55, 0x01, 0x01, 0x10, 0x12, 0x21, 0x22, 
+    0x33, 0x33, 0x33, 0x33, 0x22, 0x55, 0x15, 0x01, 0x10, 0x12, 0x41, 0x52, 0x32, 0x33, 0x33, 0x23, 
+    0x35, 0x55, 0x15, 0x01, 0x10, 0x11, 0x41, 0x54, 0x25, 0x22, 0x22, 0x52, 0x35, 0x55, 0x01, 0x01, 
+    0x10, 0x11, 0x41, 0x54, 0x75, 0x57, 0x77, 0x57, 0x15, 0x35, 0x01, 0x01, 0x10, 0x11, 0x11, 0x21, 
+    0x75, 0x77, 0x77, 0x57, 0x12, 0x11, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x72, 0x57, 0x77, 0x27, 0x12, 
+    0x01, 0x12, 0x0C, 0x21, 0x72, 0x57, 0x77, 0x27, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x22, 0x11, 0x11, 
+    0x22, 0x12, 0x02, 0x13, 0x03, 0x11, 0x01, 0x03, 0x05, 0x21, 0x22, 0x01, 0x01, 0x1B, 0x02, 0x22, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 
+    0x03, 0x12, 0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 
+    0x21, 0x12, 0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 
+    0x13, 0x0A, 0x41, 0x33, 0x33, 0x33, 0x14, 0x02, 0x0E, 0x03, 0x11, 0x01, 0x03, 0x08, 0x31, 0x33, 
+    0x33, 0x13, 0x02, 0x0D, 0x05, 0x51, 0x55, 0x01, 0x02, 0x08, 0x21, 0x33, 0x33, 0x12, 0x02, 0x0D, 
+    0x05, 0x51, 0x55, 0x01, 0x01, 0x0A, 0x21, 0x22, 0x33, 0x22, 0x12, 0x01, 0x0D, 0x11, 0x51, 0x55, 
+    0x11, 0x33, 0x22, 0x22, 0x22, 0x33, 0x01, 0x01, 0x0D, 0x12, 0x51, 0x55, 0x31, 0x33, 0x63, 0x77, 
+    0x36, 0x33, 0x12, 0x01, 0x0D, 0x12, 0x51, 0x55, 0x32, 0x33, 0x33, 0x22, 0x33, 0x23, 0x12, 0x01, 
+    0x0D, 0x13, 0x51, 0x55, 0x22, 0x32, 0x33, 0x33, 0x33, 0x23, 0x42, 0x01, 0x01, 0x0E, 0x12, 0x51, 
+    0x35, 0x22, 0x33, 0x33, 0x33, 0x33, 0x42, 0x14, 0x01, 0x0E, 0x12, 0x31, 0x35, 0x51, 0x32, 0x33, 
+    0x33, 0x23, 0x45, 0x14, 0x01, 0x0E, 0x12, 0x31, 0x15, 0x51, 0x25, 0x22, 0x22, 0x52, 0x45, 0x14, 
+    0x02, 0x0E, 0x03, 0x11, 0x01, 0x01, 0x0E, 0x51, 0x75, 0x77, 0x75, 0x57, 0x15, 0x11, 0x01, 0x12, 
+    0x0C, 0x41, 0x75, 0x77, 0x77, 0x27, 0x12, 0x01, 0x12, 0x0D, 0x41, 0x74, 0x77, 0x75, 0x32, 0x33, 
+    0x01, 0x01, 0x13, 0x0C, 0x41, 0x77, 0x57, 0x27, 0x33, 0x13, 0x01, 0x13, 0x0C, 0x41, 0x44, 0x11, 
+    0x11, 0x33, 0x13, 0x02, 0x14, 0x02, 0x44, 0x04, 0x05, 0x31, 0x33, 0x01, 0x01, 0x1B, 0x04, 0x11, 
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 
+    0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x21, 0x01, 0x01, 
+    0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x34, 0x33, 0x33, 0x43, 
+    0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 0x33, 0x33, 0x14, 0x02, 0x14, 0x08, 0x31, 0x33, 0x33, 0x13, 
+    0x03, 0x03, 0x11, 0x01, 0x02, 0x14, 0x08, 0x21, 0x33, 0x33, 0x12, 0x02, 0x05, 0x51, 0x55, 0x01, 
+    0x02, 0x13, 0x0A, 0x21, 0x22, 0x33, 0x22, 0x12, 0x01, 0x05, 0x51, 0x55, 0x01, 0x01, 0x12, 0x11, 
+    0x31, 0x23, 0x22, 0x22, 0x32, 0x13, 0x51, 0x55, 0x01, 0x01, 0x11, 0x12, 0x21, 0x33, 0x63, 0x77, 
+    0x36, 0x33, 0x13, 0x55, 0x15, 0x01, 0x11, 0x12, 0x21, 0x32, 0x33, 0x22, 0x33, 0x33, 0x23, 0x55, 
+    0x15, 0x01, 0x10, 0x13, 0x41, 0x22, 0x33, 0x33, 0x33, 0x33, 0x22, 0x52, 0x55, 0x01, 0x01, 0x10, 
+    0x12, 0x41, 0x24, 0x33, 0x33, 0x33, 0x33, 0x22, 0x53, 0x15, 0x01, 0x10, 0x12, 0x41, 0x54, 0x32, 
+    0x33, 0x33, 0x23, 0x15, 0x53, 0x13, 0x01, 0x10, 0x12, 0x41, 0x54, 0x25, 0x22, 0x22, 0x52, 0x15, 
+    0x51, 0x13, 0x02, 0x10, 0x0E, 0x11, 0x51, 0x75, 0x57, 0x77, 0x57, 0x15, 0x01, 0x03, 0x11, 0x01, 
+    0x01, 0x12, 0x0C, 0x21, 0x72, 0x77, 0x77, 0x57, 0x14, 0x01, 0x11, 0x0D, 0x31, 0x33, 0x72, 0x75, 
+    0x77, 0x44, 0x01, 0x01, 0x11, 0x0C, 0x31, 0x33, 0x72, 0x75, 0x77, 0x14, 0x01, 0x11, 0x0C, 0x31, 
+    0x33, 0x11, 0x11, 0x44, 0x14, 0x02, 0x11, 0x05, 0x31, 0x33, 0x01, 0x04, 0x02, 0x44, 0x01, 0x11, 
+    0x04, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 
+    0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 
+    0x21, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x34, 
+    0x33, 0x33, 0x43, 0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 0x33, 0x33, 0x14, 0x01, 0x14, 0x08, 0x31, 
+    0x33, 0x33, 0x13, 0x01, 0x14, 0x08, 0x21, 0x33, 0x33, 0x12, 0x01, 0x13, 0x0A, 0x21, 0x22, 0x33, 
+    0x22, 0x12, 0x02, 0x0E, 0x03, 0x11, 0x01, 0x01, 0x0C, 0x31, 0x23, 0x22, 0x22, 0x32, 0x13, 0x01, 
+    0x0D, 0x12, 0x51, 0x55, 0x31, 0x33, 0x63, 0x77, 0x36, 0x33, 0x12, 0x01, 0x0D, 0x12, 0x51, 0x55, 
+    0x32, 0x33, 0x33, 0x22, 0x33, 0x23, 0x12, 0x01, 0x0D, 0x13, 0x51, 0x55, 0x22, 0x32, 0x33, 0x33, 
+    0x33, 0x23, 0x22, 0x01, 0x01, 0x0E, 0x12, 0x51, 0x55, 0x22, 0x33, 0x33, 0x33, 0x33, 0x22, 0x12, 
+    0x01, 0x0E, 0x12, 0x51, 0x55, 0x53, 0x32, 0x33, 0x33, 0x23, 0x25, 0x14, 0x01, 0x0F, 0x11, 0x51, 
+    0x35, 0x55, 0x22, 0x22, 0x22, 0x55, 0x44, 0x01, 0x01, 0x0F, 0x11, 0x31, 0x15, 0x55, 0x77, 0x57, 
+    0x77, 0x55, 0x44, 0x01, 0x01, 0x0F, 0x11, 0x11, 0x11, 0x52, 0x77, 0x77, 0x77, 0x25, 0x11, 0x01, 
+    0x01, 0x12, 0x0C, 0x21, 0x72, 0x77, 0x75, 0x27, 0x12, 0x01, 0x12, 0x0C, 0x41, 0x74, 0x77, 0x75, 
+    0x37, 0x13, 0x01, 0x13, 0x0B, 0x41, 0x14, 0x11, 0x31, 0x33, 0x01, 0x02, 0x14, 0x02, 0x11, 0x03, 
+    0x05, 0x31, 0x33, 0x01, 0x01, 0x19, 0x05, 0x31, 0x33, 0x01, 0x01, 0x1B, 0x02, 0x33, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 
+    0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x12, 
+    0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 0x13, 0x0A, 
+    0x41, 0x33, 0x33, 0x33, 0x14, 0x01, 0x14, 0x08, 0x31, 0x33, 0x33, 0x13, 0x01, 0x14, 0x08, 0x21, 
+    0x33, 0x33, 0x12, 0x01, 0x13, 0x0A, 0x21, 0x22, 0x33, 0x22, 0x12, 0x02, 0x12, 0x0C, 0x31, 0x23, 
+    0x22, 0x22, 0x32, 0x13, 0x01, 0x03, 0x11, 0x01, 0x01, 0x11, 0x12, 0x21, 0x33, 0x63, 0x77, 0x36, 
+    0x33, 0x13, 0x55, 0x15, 0x01, 0x11, 0x12, 0x21, 0x32, 0x33, 0x22, 0x33, 0x33, 0x23, 0x55, 0x15, 
+    0x01, 0x10, 0x13, 0x21, 0x22, 0x33, 0x33, 0x33, 0x33, 0x22, 0x52, 0x55, 0x01, 0x01, 0x10, 0x12, 
+    0x21, 0x22, 0x33, 0x33, 0x33, 0x33, 0x22, 0x55, 0x15, 0x01, 0x10, 0x12, 0x41, 0x52, 0x32, 0x33, 
+    0x33, 0x23, 0x35, 0x55, 0x15, 0x01, 0x10, 0x11, 0x41, 0x54, 0x25, 0x22, 0x22, 0x52, 0x35, 0x55, 
+    0x01, 0x01, 0x10, 0x11, 0x41, 0x54, 0x75, 0x57, 0x77, 0x57, 0x15, 0x35, 0x01, 0x01, 0x10, 0x11, 
+    0x11, 0x21, 0x75, 0x77, 0x77, 0x57, 0x12, 0x11, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x72, 0x57, 0x77, 
+    0x27, 0x12, 0x01, 0x12, 0x0C, 0x31, 0x73, 0x57, 0x77, 0x47, 0x14, 0x01, 0x12, 0x0B, 0x31, 0x33, 
+    0x11, 0x11, 0x44, 0x01, 0x02, 0x12, 0x05, 0x31, 0x33, 0x01, 0x03, 0x02, 0x11, 0x01, 0x12, 0x05, 
+    0x31, 0x33, 0x01, 0x01, 0x13, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 0x11, 
+    0x01, 0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 0x0C, 
+    0x21, 0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 0x33, 0x33, 0x14, 0x01, 0x14, 
+    0x08, 0x31, 0x33, 0x33, 0x13, 0x01, 0x14, 0x08, 0x21, 0x33, 0x33, 0x12, 0x01, 0x13, 0x0A, 0x21, 
+    0x22, 0x33, 0x22, 0x12, 0x01, 0x12, 0x0C, 0x31, 0x23, 0x22, 0x22, 0x32, 0x13, 0x01, 0x0E, 0x11, 
+    0x11, 0x11, 0x32, 0x33, 0x76, 0x67, 0x33, 0x33, 0x01, 0x01, 0x0D, 0x13, 0x51, 0x55, 0x24, 0x32, 
+    0x33, 0x22, 0x33, 0x33, 0x23, 0x01, 0x01, 0x0D, 0x13, 0x51, 0x55, 0x44, 0x32, 0x33, 0x33, 0x33, 
+    0x23, 0x22, 0x01, 0x01, 0x0D, 0x14, 0x51, 0x55, 0x44, 0x32, 0x33, 0x33, 0x33, 0x23, 0x22, 0x12, 
+    0x01, 0x0E, 0x13, 0x51, 0x55, 0x52, 0x32, 0x33, 0x33, 0x23, 0x35, 0x22, 0x01, 0x01, 0x0F, 0x12, 
+    0x51, 0x25, 0x55, 0x22, 0x22, 0x22, 0x55, 0x23, 0x13, 0x01, 0x0F, 0x12, 0x21, 0x15, 0x55, 0x77, 
+    0x57, 0x77, 0x55, 0x21, 0x13, 0x01, 0x0F, 0x12, 0x11, 0x11, 0x52, 0x77, 0x77, 0x77, 0x25, 0x11, 
+    0x11, 0x01, 0x12, 0x0C, 0x21, 0x72, 0x77, 0x75, 0x27, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x72, 0x77, 
+    0x75, 0x27, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x22, 0x11, 0x11, 0x22, 0x12, 0x02, 0x13, 0x03, 0x11, 
+    0x01, 0x03, 0x05, 0x21, 0x22, 0x01, 0x01, 0x1B, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 0x01, 
+    0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 0x21, 
+    0x12, 0x01, 0x12, 0x0C, 0x21, 0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 0x33, 
+    0x33, 0x14, 0x01, 0x14, 0x08, 0x31, 0x33, 0x33, 0x13, 0x01, 0x14, 0x08, 0x21, 0x33, 0x33, 0x12, 
+    0x01, 0x13, 0x0A, 0x21, 0x22, 0x33, 0x22, 0x12, 0x01, 0x12, 0x0C, 0x31, 0x23, 0x22, 0x22, 0x32, 
+    0x13, 0x01, 0x11, 0x11, 0x31, 0x33, 0x63, 0x77, 0x36, 0x33, 0x12, 0x11, 0x01, 0x01, 0x10, 0x13, 
+    0x21, 0x33, 0x33, 0x23, 0x32, 0x33, 0x22, 0x54, 0x55, 0x01, 0x01, 0x10, 0x13, 0x21, 0x22, 0x33, 
+    0x33, 0x33, 0x33, 0x42, 0x54, 0x55, 0x01, 0x01, 0x0F, 0x14, 0x21, 0x22, 0x32, 0x33, 0x33, 0x33, 
+    0x23, 0x44, 0x55, 0x15, 0x01, 0x0F, 0x13, 0x21, 0x32, 0x25, 0x33, 0x33, 0x33, 0x52, 0x52, 0x55, 
+    0x01, 0x01, 0x0F, 0x12, 0x31, 0x32, 0x55, 0x22, 0x22, 0x22, 0x55, 0x52, 0x15, 0x01, 0x0F, 0x12, 
+    0x31, 0x12, 0x55, 0x77, 0x75, 0x77, 0x55, 0x51, 0x12, 0x01, 0x0F, 0x12, 0x11, 0x11, 0x52, 0x77, 
+    0x77, 0x77, 0x25, 0x11, 0x11, 0x01, 0x12, 0x0C, 0x21, 0x72, 0x57, 0x77, 0x27, 0x12, 0x01, 0x12, 
+    0x0C, 0x21, 0x72, 0x57, 0x77, 0x27, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x22, 0x11, 0x11, 0x22, 0x12, 
+    0x02, 0x12, 0x05, 0x21, 0x22, 0x01, 0x03, 0x03, 0x11, 0x01, 0x01, 0x13, 0x02, 0x22, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 
+    0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x12, 
+    0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 0x13, 0x0A, 
+    0x41, 0x33, 0x33, 0x33, 0x14, 0x01, 0x14, 0x08, 0x31, 0x33, 0x33, 0x13, 0x01, 0x14, 0x08, 0x21, 
+    0x33, 0x33, 0x12, 0x01, 0x13, 0x0A, 0x21, 0x22, 0x33, 0x22, 0x12, 0x01, 0x12, 0x0C, 0x31, 0x23, 
+    0x22, 0x22, 0x32, 0x13, 0x01, 0x11, 0x0E, 0x21, 0x33, 0x63, 0x77, 0x36, 0x33, 0x13, 0x01, 0x0F, 
+    0x11, 0x11, 0x24, 0x32, 0x33, 0x22, 0x33, 0x33, 0x23, 0x01, 0x01, 0x0E, 0x12, 0x51, 0x55, 0x24, 
+    0x33, 0x33, 0x33, 0x33, 0x22, 0x12, 0x01, 0x0E, 0x13, 0x51, 0x55, 0x24, 0x33, 0x33, 0x33, 0x33, 
+    0x32, 0x22, 0x01, 0x01, 0x0E, 0x13, 0x51, 0x55, 0x54, 0x32, 0x33, 0x33, 0x23, 0x35, 0x33, 0x01, 
+    0x01, 0x0F, 0x12, 0x51, 0x45, 0x55, 0x22, 0x22, 0x22, 0x55, 0x32, 0x13, 0x01, 0x10, 0x11, 0x11, 
+    0x51, 0x75, 0x77, 0x75, 0x57, 0x15, 0x11, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x72, 0x77, 0x77, 0x57, 
+    0x14, 0x01, 0x11, 0x0D, 0x31, 0x33, 0x72, 0x57, 0x77, 0x44, 0x01, 0x01, 0x11, 0x0C, 0x31, 0x33, 
+    0x72, 0x57, 0x77, 0x14, 0x01, 0x11, 0x0C, 0x31, 0x33, 0x11, 0x11, 0x44, 0x14, 0x02, 0x11, 0x05, 
+    0x31, 0x33, 0x01, 0x04, 0x02, 0x44, 0x01, 0x11, 0x04, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 
+    0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 
+    0x21, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 
+    0x33, 0x33, 0x14, 0x01, 0x14, 0x08, 0x31, 0x33, 0x33, 0x13, 0x01, 0x14, 0x08, 0x21, 0x33, 0x33, 
+    0x12, 0x01, 0x13, 0x0A, 0x21, 0x22, 0x33, 0x22, 0x12, 0x01, 0x12, 0x0C, 0x31, 0x23, 0x22, 0x22, 
+    0x32, 0x13, 0x01, 0x11, 0x0E, 0x31, 0x33, 0x63, 0x77, 0x36, 0x33, 0x12, 0x01, 0x10, 0x11, 0x21, 
+    0x33, 0x33, 0x23, 0x32, 0x33, 0x22, 0x14, 0x01, 0x01, 0x10, 0x12, 0x21, 0x22, 0x33, 0x33, 0x33, 
+    0x33, 0x42, 0x55, 0x15, 0x01, 0x0F, 0x13, 0x21, 0x32, 0x32, 0x33, 0x33, 0x33, 0x23, 0x54, 0x55, 
+    0x01, 0x01, 0x0F, 0x13, 0x31, 0x33, 0x25, 0x33, 0x33, 0x33, 0x52, 0x54, 0x55, 0x01, 0x01, 0x0F, 
+    0x12, 0x31, 0x23, 0x55, 0x22, 0x22, 0x22, 0x55, 0x54, 0x15, 0x01, 0x0F, 0x11, 0x11, 0x11, 0x55, 
+    0x77, 0x75, 0x77, 0x55, 0x11, 0x01, 0x01, 0x12, 0x0C, 0x41, 0x75, 0x77, 0x77, 0x27, 0x12, 0x01, 
+    0x12, 0x0D, 0x41, 0x74, 0x57, 0x77, 0x32, 0x33, 0x01, 0x01, 0x13, 0x0C, 0x41, 0x77, 0x75, 0x27, 
+    0x33, 0x13, 0x01, 0x13, 0x0C, 0x41, 0x44, 0x11, 0x11, 0x33, 0x13, 0x02, 0x14, 0x02, 0x44, 0x04, 
+    0x05, 0x31, 0x33, 0x01, 0x01, 0x1B, 0x04, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 0x01, 
+    0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 0x21, 
+    0x12, 0x01, 0x12, 0x0C, 0x21, 0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 0x33, 
+    0x33, 0x14, 0x01, 0x14, 0x08, 0x31, 0x33, 0x33, 0x13, 0x01, 0x14, 0x08, 0x21, 0x33, 0x33, 0x12, 
+    0x01, 0x13, 0x0A, 0x21, 0x22, 0x33, 0x22, 0x12, 0x01, 0x12, 0x0C, 0x31, 0x23, 0x22, 0x22, 0x32, 
+    0x13, 0x01, 0x0E, 0x11, 0x11, 0x11, 0x32, 0x33, 0x76, 0x67, 0x33, 0x33, 0x01, 0x01, 0x0D, 0x13, 
+    0x51, 0x55, 0x24, 0x32, 0x33, 0x22, 0x33, 0x33, 0x23, 0x01, 0x01, 0x0D, 0x13, 0x51, 0x55, 0x44, 
+    0x32, 0x33, 0x33, 0x33, 0x23, 0x22, 0x01, 0x01, 0x0D, 0x14, 0x51, 0x55, 0x44, 0x32, 0x33, 0x33, 
+    0x33, 0x23, 0x22, 0x12, 0x01, 0x0E, 0x13, 0x51, 0x55, 0x52, 0x32, 0x33, 0x33, 0x23, 0x35, 0x22, 
+    0x01, 0x01, 0x0F, 0x12, 0x51, 0x25, 0x55, 0x22, 0x22, 0x22, 0x55, 0x23, 0x13, 0x01, 0x0F, 0x12, 
+    0x21, 0x15, 0x55, 0x77, 0x57, 0x77, 0x55, 0x21, 0x13, 0x01, 0x0F, 0x12, 0x11, 0x11, 0x52, 0x77, 
+    0x77, 0x77, 0x25, 0x11, 0x11, 0x01, 0x12, 0x0C, 0x21, 0x72, 0x77, 0x75, 0x27, 0x12, 0x01, 0x12, 
+    0x0C, 0x31, 0x73, 0x77, 0x75, 0x47, 0x14, 0x01, 0x12, 0x0B, 0x31, 0x33, 0x11, 0x11, 0x44, 0x01, 
+    0x02, 0x12, 0x05, 0x31, 0x33, 0x01, 0x03, 0x02, 0x11, 0x01, 0x12, 0x05, 0x31, 0x33, 0x01, 0x01, 
+    0x13, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 
+    0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x21, 0x01, 
+    0x01, 0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x34, 0x33, 0x33, 
+    0x43, 0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 0x33, 0x33, 0x14, 0x01, 0x14, 0x08, 0x31, 0x33, 0x33, 
+    0x13, 0x01, 0x14, 0x08, 0x21, 0x33, 0x33, 0x12, 0x01, 0x13, 0x0A, 0x21, 0x22, 0x33, 0x22, 0x12, 
+    0x01, 0x12, 0x0C, 0x31, 0x23, 0x22, 0x22, 0x32, 0x13, 0x01, 0x11, 0x11, 0x31, 0x33, 0x63, 0x77, 
+    0x36, 0x33, 0x12, 0x11, 0x01, 0x01, 0x10, 0x13, 0x21, 0x33, 0x33, 0x23, 0x32, 0x33, 0x22, 0x54, 
+    0x55, 0x01, 0x01, 0x10, 0x13, 0x21, 0x22, 0x33, 0x33, 0x33, 0x33, 0x42, 0x54, 0x55, 0x01, 0x01, 
+    0x0F, 0x14, 0x21, 0x22, 0x32, 0x33, 0x33, 0x33, 0x23, 0x44, 0x55, 0x15, 0x01, 0x0F, 0x13, 0x21, 
+    0x32, 0x25, 0x33, 0x33, 0x33, 0x52, 0x52, 0x55, 0x01, 0x01, 0x0F, 0x12, 0x31, 0x32, 0x55, 0x22, 
+    0x22, 0x22, 0x55, 0x52, 0x15, 0x01, 0x0F, 0x12, 0x31, 0x12, 0x55, 0x77, 0x75, 0x77, 0x55, 0x51, 
+    0x12, 0x01, 0x0F, 0x12, 0x11, 0x11, 0x52, 0x77, 0x77, 0x77, 0x25, 0x11, 0x11, 0x01, 0x12, 0x0C, 
+    0x21, 0x72, 0x57, 0x77, 0x27, 0x12, 0x01, 0x12, 0x0C, 0x41, 0x74, 0x57, 0x77, 0x37, 0x13, 0x01, 
+    0x13, 0x0B, 0x41, 0x14, 0x11, 0x31, 0x33, 0x01, 0x02, 0x14, 0x02, 0x11, 0x03, 0x05, 0x31, 0x33, 
+    0x01, 0x01, 0x19, 0x05, 0x31, 0x33, 0x01, 0x01, 0x1B, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 
+};
+const RLESprite goblin_D_Walk_rle[6] = {
+    {48, 48, 4, goblin_D_Walk_palette, {goblin_D_Walk_rle_data + 0, goblin_D_Walk_rle_data + 245}},
+    {48, 48, 4, goblin_D_Walk_palette, {goblin_D_Walk_rle_data + 490, goblin_D_Walk_rle_data + 748}},
+    {48, 48, 4, goblin_D_Walk_palette, {goblin_D_Walk_rle_data + 1006, goblin_D_Walk_rle_data + 1255}},
+    {48, 48, 4, goblin_D_Walk_palette, {goblin_D_Walk_rle_data + 1504, goblin_D_Walk_rle_data + 1748}},
+    {48, 48, 4, goblin_D_Walk_palette, {goblin_D_Walk_rle_data + 1992, goblin_D_Walk_rle_data + 2230}},
+    {48, 48, 4, goblin_D_Walk_palette, {goblin_D_Walk_rle_data + 2468, goblin_D_Walk_rle_data + 2716}},
+};
+
+// goblin_S_Attack: 6 frames of 48x48, 7 colours
+static const unsigned short int goblin_S_Attack_palette[8] = {
+    0x0000, 0x0865, 0x7268, 0x4385, 0xA589, 0x84A8, 0xFF17, 0xB2C8, 
+};
+static const unsigned char goblin_S_Attack_rle_data[3110] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 
+    0x02, 0x11, 0x01, 0x14, 0x03, 0x31, 0x01, 0x02, 0x14, 0x06, 0x31, 0x11, 0x11, 0x02, 0x02, 0x11, 
+    0x01, 0x14, 0x0A, 0x31, 0x44, 0x44, 0x11, 0x15, 0x01, 0x14, 0x0A, 0x41, 0x44, 0x44, 0x54, 0x15, 
+    0x01, 0x14, 0x0A, 0x41, 0x44, 0x44, 0x34, 0x15, 0x02, 0x0B, 0x04, 0x11, 0x11, 0x05, 0x09, 0x51, 
+    0x44, 0x44, 0x35, 0x01, 0x02, 0x0A, 0x06, 0x21, 0x22, 0x12, 0x03, 0x09, 0x51, 0x45, 0x54, 0x55, 
+    0x01, 0x02, 0x0A, 0x07, 0x21, 0x22, 0x22, 0x01, 0x01, 0x0B, 0x51, 0x65, 0x57, 0x55, 0x55, 0x01, 
+    0x01, 0x0A, 0x14, 0x21, 0x22, 0x22, 0x12, 0x51, 0x55, 0x67, 0x55, 0x45, 0x14, 0x01, 0x0B, 0x14, 
+    0x11, 0x22, 0x22, 0x32, 0x55, 0x44, 0x55, 0x45, 0x44, 0x14, 0x01, 0x0D, 0x12, 0x11, 0x22, 0x22, 
+    0x45, 0x44, 0x44, 0x44, 0x44, 0x14, 0x01, 0x0F, 0x10, 0x11, 0x33, 0x45, 0x44, 0x44, 0x44, 0x54, 
+    0x15, 0x01, 0x11, 0x0E, 0x11, 0x55, 0x44, 0x44, 0x44, 0x54, 0x15, 0x01, 0x12, 0x0D, 0x21, 0x55, 
+    0x44, 0x44, 0x54, 0x55, 0x01, 0x01, 0x12, 0x0D, 0x21, 0x77, 0x57, 0x55, 0x55, 0x44, 0x01, 0x01, 
+    0x12, 0x0D, 0x21, 0x77, 0x27, 0x77, 0x22, 0x44, 0x01, 0x01, 0x12, 0x0D, 0x51, 0x77, 0x77, 0x77, 
+    0x22, 0x12, 0x01, 0x01, 0x12, 0x0C, 0x51, 0x77, 0x27, 0x77, 0x55, 0x15, 0x01, 0x12, 0x0C, 0x51, 
+    0x55, 0x11, 0x77, 0x55, 0x15, 0x02, 0x12, 0x05, 0x51, 0x55, 0x01, 0x01, 0x06, 0x11, 0x55, 0x15, 
+    0x02, 0x13, 0x02, 0x55, 0x04, 0x05, 0x51, 0x55, 0x01, 0x01, 0x19, 0x04, 0x51, 0x55, 0x01, 0x1A, 
+    0x02, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1A, 0x02, 0x11, 0x01, 0x19, 
+    0x03, 0x31, 0x01, 0x02, 0x12, 0x02, 0x11, 0x02, 0x06, 0x11, 0x11, 0x13, 0x01, 0x12, 0x0A, 0x51, 
+    0x11, 0x44, 0x44, 0x13, 0x01, 0x12, 0x0A, 0x51, 0x45, 0x44, 0x44, 0x14, 0x01, 0x12, 0x0A, 0x51, 
+    0x43, 0x44, 0x44, 0x14, 0x02, 0x13, 0x09, 0x31, 0x45, 0x44, 0x54, 0x01, 0x05, 0x04, 0x11, 0x11, 
+    0x02, 0x14, 0x09, 0x51, 0x55, 0x44, 0x55, 0x01, 0x03, 0x06, 0x21, 0x22, 0x12, 0x02, 0x13, 0x0B, 
+    0x51, 0x55, 0x55, 0x67, 0x55, 0x01, 0x01, 0x07, 0x21, 0x22, 0x22, 0x01, 0x01, 0x12, 0x14, 0x41, 
+    0x54, 0x55, 0x76, 0x55, 0x15, 0x21, 0x22, 0x22, 0x12, 0x01, 0x11, 0x14, 0x41, 0x44, 0x54, 0x55, 
+    0x44, 0x55, 0x23, 0x22, 0x22, 0x11, 0x01, 0x11, 0x12, 0x41, 0x44, 0x44, 0x44, 0x44, 0x54, 0x22, 
+    0x22, 0x11, 0x01, 0x11, 0x10, 0x51, 0x45, 0x44, 0x44, 0x44, 0x54, 0x33, 0x11, 0x01, 0x11, 0x0E, 
+    0x51, 0x45, 0x44, 0x44, 0x44, 0x55, 0x11, 0x01, 0x11, 0x0D, 0x51, 0x55, 0x44, 0x44, 0x54, 0x25, 
+    0x01, 0x01, 0x11, 0x0D, 0x41, 0x54, 0x55, 0x55, 0x77, 0x27, 0x01, 0x01, 0x11, 0x0D, 0x41, 0x24, 
+    0x72, 0x27, 0x77, 0x27, 0x01, 0x01, 0x11, 0x0D, 0x11, 0x22, 0x72, 0x77, 0x77, 0x57, 0x01, 0x01, 
+    0x12, 0x0C, 0x51, 0x55, 0x77, 0x72, 0x77, 0x15, 0x01, 0x12, 0x0C, 0x51, 0x55, 0x77, 0x11, 0x55, 
+    0x15, 0x02, 0x12, 0x06, 0x51, 0x55, 0x11, 0x01, 0x05, 0x51, 0x55, 0x01, 0x02, 0x12, 0x05, 0x51, 
+    0x55, 0x01, 0x04, 0x02, 0x55, 0x01, 0x13, 0x04, 0x55, 0x15, 0x01, 0x14, 0x02, 0x55, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x03, 0x11, 0x01, 0x02, 0x0E, 0x05, 0x21, 0x22, 0x01, 0x01, 
+    0x02, 0x11, 0x02, 0x0D, 0x06, 0x21, 0x22, 0x12, 0x01, 0x03, 0x31, 0x01, 0x03, 0x0D, 0x06, 0x21, 
+    0x22, 0x12, 0x01, 0x06, 0x31, 0x11, 0x11, 0x02, 0x02, 0x11, 0x02, 0x0D, 0x06, 0x21, 0x22, 0x12, 
+    0x01, 0x0A, 0x31, 0x44, 0x44, 0x11, 0x15, 0x02, 0x0D, 0x06, 0x21, 0x22, 0x12, 0x01, 0x0A, 0x41, 
+    0x44, 0x44, 0x54, 0x15, 0x02, 0x0E, 0x05, 0x21, 0x22, 0x01, 0x01, 0x0A, 0x41, 0x44, 0x44, 0x34, 
+    0x15, 0x02, 0x0E, 0x05, 0x21, 0x22, 0x01, 0x01, 0x09, 0x51, 0x44, 0x44, 0x35, 0x01, 0x01, 0x0E, 
+    0x0E, 0x51, 0x22, 0x11, 0x65, 0x44, 0x55, 0x15, 0x01, 0x0E, 0x0E, 0x51, 0x52, 0x55, 0x65, 0x67, 
+    0x55, 0x15, 0x01, 0x0F, 0x0E, 0x21, 0x55, 0x55, 0x75, 0x56, 0x55, 0x15, 0x01, 0x0F, 0x0F, 0x21, 
+    0x32, 0x55, 0x44, 0x55, 0x55, 0x44, 0x01, 0x01, 0x10, 0x0F, 0x11, 0x51, 0x44, 0x44, 0x44, 0x44, 
+    0x44, 0x01, 0x01, 0x12, 0x0D, 0x51, 0x44, 0x44, 0x44, 0x54, 0x44, 0x01, 0x01, 0x12, 0x0D, 0x51, 
+    0x45, 0x44, 0x44, 0x55, 0x55, 0x01, 0x01, 0x12, 0x0D, 0x21, 0x55, 0x44, 0x34, 0x44, 0x55, 0x01, 
+    0x01, 0x12, 0x0C, 0x21, 0x77, 0x57, 0x43, 0x44, 0x15, 0x01, 0x11, 0x0D, 0x41, 0x74, 0x77, 0x72, 
+    0x44, 0x22, 0x01, 0x01, 0x11, 0x0D, 0x41, 0x44, 0x77, 0x77, 0x27, 0x22, 0x01, 0x01, 0x11, 0x0D, 
+    0x51, 0x44, 0x77, 0x72, 0x27, 0x52, 0x01, 0x01, 0x11, 0x0D, 0x51, 0x55, 0x11, 0x71, 0x57, 0x55, 
+    0x01, 0x02, 0x11, 0x04, 0x11, 0x11, 0x03, 0x06, 0x11, 0x55, 0x15, 0x01, 0x19, 0x05, 0x51, 0x55, 
+    0x01, 0x01, 0x19, 0x05, 0x51, 0x55, 0x01, 0x01, 0x19, 0x04, 0x51, 0x55, 0x01, 0x1A, 0x02, 0x55, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1E, 0x03, 0x11, 0x01, 0x02, 0x1A, 0x02, 0x11, 0x01, 
+    0x05, 0x21, 0x22, 0x01, 0x02, 0x19, 0x03, 0x31, 0x01, 0x01, 0x06, 0x21, 0x22, 0x12, 0x03, 0x12, 
+    0x02, 0x11, 0x02, 0x06, 0x11, 0x11, 0x13, 0x01, 0x06, 0x21, 0x22, 0x12, 0x02, 0x12, 0x0A, 0x51, 
+    0x11, 0x44, 0x44, 0x13, 0x01, 0x06, 0x21, 0x22, 0x12, 0x02, 0x12, 0x0A, 0x51, 0x45, 0x44, 0x44, 
+    0x14, 0x01, 0x06, 0x21, 0x22, 0x12, 0x02, 0x12, 0x0A, 0x51, 0x43, 0x44, 0x44, 0x14, 0x01, 0x05, 
+    0x21, 0x22, 0x01, 0x02, 0x13, 0x09, 0x31, 0x45, 0x44, 0x54, 0x01, 0x01, 0x05, 0x21, 0x22, 0x01, 
+    0x01, 0x14, 0x0E, 0x51, 0x55, 0x44, 0x56, 0x11, 0x22, 0x15, 0x01, 0x14, 0x0E, 0x51, 0x55, 0x76, 
+    0x56, 0x55, 0x25, 0x15, 0x01, 0x13, 0x0E, 0x51, 0x55, 0x65, 0x57, 0x55, 0x55, 0x12, 0x01, 0x12, 
+    0x0F, 0x41, 0x54, 0x55, 0x45, 0x54, 0x35, 0x22, 0x01, 0x01, 0x11, 0x0F, 0x41, 0x44, 0x44, 0x44, 
+    0x44, 0x54, 0x11, 0x01, 0x01, 0x11, 0x0D, 0x41, 0x54, 0x44, 0x44, 0x44, 0x54, 0x01, 0x01, 0x11, 
+    0x0D, 0x51, 0x55, 0x45, 0x44, 0x44, 0x55, 0x01, 0x01, 0x11, 0x0D, 0x51, 0x45, 0x34, 0x44, 0x54, 
+    0x25, 0x01, 0x01, 0x12, 0x0C, 0x51, 0x44, 0x34, 0x75, 0x77, 0x12, 0x01, 0x12, 0x0D, 0x21, 0x42, 
+    0x74, 0x72, 0x77, 0x44, 0x01, 0x01, 0x12, 0x0D, 0x21, 0x22, 0x77, 0x77, 0x47, 0x44, 0x01, 0x01, 
+    0x12, 0x0D, 0x51, 0x22, 0x77, 0x72, 0x47, 0x54, 0x01, 0x01, 0x12, 0x0D, 0x51, 0x55, 0x77, 0x11, 
+    0x51, 0x55, 0x01, 0x02, 0x12, 0x06, 0x51, 0x55, 0x11, 0x03, 0x04, 0x11, 0x11, 0x01, 0x12, 0x05, 
+    0x51, 0x55, 0x01, 0x01, 0x12, 0x05, 0x51, 0x55, 0x01, 0x01, 0x13, 0x04, 0x55, 0x15, 0x01, 0x14, 
+    0x02, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x03, 0x11, 0x01, 0x01, 0x14, 0x06, 
+    0x11, 0x22, 0x12, 0x01, 0x14, 0x06, 0x31, 0x22, 0x12, 0x02, 0x13, 0x07, 0x21, 0x23, 0x22, 0x01, 
+    0x02, 0x02, 0x11, 0x01, 0x12, 0x0C, 0x21, 0x32, 0x44, 0x44, 0x11, 0x15, 0x01, 0x11, 0x0D, 0x21, 
+    0x22, 0x44, 0x44, 0x44, 0x55, 0x01, 0x01, 0x10, 0x0E, 0x51, 0x22, 0x42, 0x44, 0x44, 0x34, 0x15, 
+    0x01, 0x0F, 0x0E, 0x51, 0x22, 0x12, 0x45, 0x44, 0x54, 0x13, 0x01, 0x0F, 0x0D, 0x21, 0x55, 0x51, 
+    0x46, 0x54, 0x55, 0x01, 0x01, 0x0F, 0x0D, 0x21, 0x55, 0x55, 0x76, 0x56, 0x55, 0x01, 0x01, 0x10, 
+    0x0D, 0x31, 0x53, 0x55, 0x67, 0x55, 0x55, 0x01, 0x01, 0x11, 0x0D, 0x31, 0x55, 0x44, 0x55, 0x55, 
+    0x44, 0x01, 0x01, 0x12, 0x0C, 0x51, 0x44, 0x44, 0x44, 0x44, 0x14, 0x01, 0x12, 0x0C, 0x51, 0x44, 
+    0x44, 0x44, 0x45, 0x14, 0x01, 0x12, 0x0C, 0x51, 0x45, 0x54, 0x33, 0x55, 0x15, 0x01, 0x12, 0x0C, 
+    0x21, 0x55, 0x43, 0x44, 0x55, 0x15, 0x01, 0x11, 0x0D, 0x41, 0x74, 0x77, 0x44, 0x54, 0x25, 0x01, 
+    0x01, 0x10, 0x0E, 0x41, 0x44, 0x74, 0x27, 0x77, 0x22, 0x12, 0x01, 0x10, 0x0E, 0x41, 0x44, 0x74, 
+    0x77, 0x77, 0x22, 0x12, 0x01, 0x10, 0x0E, 0x41, 0x44, 0x71, 0x27, 0x77, 0x55, 0x15, 0x01, 0x10, 
+    0x0E, 0x11, 0x11, 0x11, 0x11, 0x77, 0x55, 0x15, 0x01, 0x18, 0x06, 0x11, 0x55, 0x15, 0x01, 0x19, 
+    0x05, 0x51, 0x55, 0x01, 0x01, 0x19, 0x05, 0x51, 0x55, 0x01, 0x01, 0x19, 0x04, 0x51, 0x55, 0x01, 
+    0x1A, 0x02, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x17, 0x03, 0x11, 0x01, 0x01, 0x16, 
+    0x06, 0x21, 0x22, 0x11, 0x01, 0x16, 0x06, 0x21, 0x22, 0x13, 0x02, 0x12, 0x02, 0x11, 0x02, 0x07, 
+    0x21, 0x22, 0x23, 0x01, 0x01, 0x12, 0x0C, 0x51, 0x11, 0x44, 0x44, 0x23, 0x12, 0x01, 0x12, 0x0D, 
+    0x51, 0x45, 0x44, 0x44, 0x24, 0x22, 0x01, 0x01, 0x12, 0x0E, 0x51, 0x43, 0x44, 0x44, 0x24, 0x22, 
+    0x15, 0x01, 0x13, 0x0E, 0x31, 0x45, 0x44, 0x54, 0x21, 0x22, 0x15, 0x01, 0x14, 0x0D, 0x51, 0x55, 
+    0x44, 0x56, 0x51, 0x25, 0x01, 0x01, 0x14, 0x0D, 0x51, 0x55, 0x76, 0x56, 0x55, 0x25, 0x01, 0x01, 
+    0x13, 0x0D, 0x51, 0x55, 0x65, 0x57, 0x55, 0x33, 0x01, 0x01, 0x12, 0x0D, 0x41, 0x54, 0x55, 0x45, 
+    0x54, 0x35, 0x01, 0x01, 0x12, 0x0C, 0x41, 0x44, 0x44, 0x44, 0x44, 0x15, 0x01, 0x12, 0x0C, 0x41, 
+    0x54, 0x44, 0x44, 0x44, 0x15, 0x01, 0x12, 0x0C, 0x51, 0x55, 0x33, 0x45, 0x54, 0x15, 0x01, 0x12, 
+    0x0C, 0x51, 0x55, 0x44, 0x34, 0x55, 0x12, 0x01, 0x12, 0x0D, 0x21, 0x55, 0x44, 0x74, 0x77, 0x44, 
+    0x01, 0x01, 0x12, 0x0E, 0x21, 0x22, 0x77, 0x72, 0x47, 0x44, 0x14, 0x01, 0x12, 0x0E, 0x21, 0x22, 
+    0x77, 0x77, 0x47, 0x44, 0x14, 0x01, 0x12, 0x0E, 0x51, 0x55, 0x77, 0x72, 0x17, 0x44, 0x14, 0x01, 
+    0x12, 0x0E, 0x51, 0x55, 0x77, 0x11, 0x11, 0x11, 0x11, 0x01, 0x12, 0x06, 0x51, 0x55, 0x11, 0x01, 
+    0x12, 0x05, 0x51, 0x55, 0x01, 0x01, 0x12, 0x05, 0x51, 0x55, 0x01, 0x01, 0x13, 0x04, 0x55, 0x15, 
+    0x01, 0x14, 0x02, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x14, 0x02, 0x11, 0x03, 
+    0x03, 0x11, 0x01, 0x01, 0x14, 0x09, 0x31, 0x11, 0x21, 0x22, 0x01, 0x01, 0x14, 0x0A, 0x31, 0x21, 
+    0x22, 0x22, 0x11, 0x01, 0x13, 0x0B, 0x11, 0x43, 0x44, 0x14, 0x51, 0x01, 0x01, 0x11, 0x0D, 0x11, 
+    0x22, 0x44, 0x44, 0x44, 0x55, 0x01, 0x01, 0x0F, 0x0F, 0x11, 0x55, 0x22, 0x44, 0x44, 0x44, 0x53, 
+    0x01, 0x01, 0x0F, 0x0E, 0x21, 0x22, 0x22, 0x45, 0x44, 0x54, 0x13, 0x01, 0x0F, 0x0D, 0x21, 0x55, 
+    0x51, 0x46, 0x54, 0x55, 0x01, 0x01, 0x10, 0x0C, 0x51, 0x55, 0x65, 0x67, 0x55, 0x15, 0x01, 0x11, 
+    0x0C, 0x31, 0x55, 0x75, 0x56, 0x55, 0x15, 0x01, 0x11, 0x0D, 0x31, 0x55, 0x44, 0x55, 0x55, 0x44, 
+    0x01, 0x01, 0x12, 0x0C, 0x51, 0x44, 0x44, 0x44, 0x44, 0x14, 0x01, 0x12, 0x0C, 0x51, 0x44, 0x44, 
+    0x44, 0x45, 0x14, 0x01, 0x12, 0x0C, 0x51, 0x45, 0x54, 0x33, 0x55, 0x15, 0x01, 0x12, 0x0C, 0x21, 
+    0x55, 0x43, 0x44, 0x55, 0x15, 0x01, 0x11, 0x0D, 0x41, 0x74, 0x77, 0x44, 0x54, 0x25, 0x01, 0x01, 
+    0x10, 0x0E, 0x41, 0x44, 0x74, 0x27, 0x77, 0x22, 0x12, 0x01, 0x10, 0x0E, 0x41, 0x44, 0x74, 0x77, 
+    0x77, 0x22, 0x12, 0x01, 0x10, 0x0E, 0x41, 0x44, 0x71, 0x27, 0x77, 0x55, 0x15, 0x01, 0x10, 0x0E, 
+    0x11, 0x11, 0x11, 0x11, 0x77, 0x55, 0x15, 0x01, 0x18, 0x06, 0x11, 0x55, 0x15, 0x01, 0x19, 0x05, 
+    0x51, 0x55, 0x01, 0x01, 0x19, 0x05, 0x51, 0x55, 0x01, 0x01, 0x19, 0x04, 0x51, 0x55, 0x01, 0x1A, 
+    0x02, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x14, 0x03, 0x11, 0x01, 0x03, 0x02, 
+    0x11, 0x01, 0x13, 0x09, 0x21, 0x22, 0x11, 0x31, 0x01, 0x01, 0x12, 0x0A, 0x11, 0x22, 0x22, 0x12, 
+    0x13, 0x01, 0x12, 0x0B, 0x51, 0x11, 0x44, 0x44, 0x13, 0x01, 0x01, 0x12, 0x0D, 0x51, 0x45, 0x44, 
+    0x44, 0x24, 0x12, 0x01, 0x01, 0x12, 0x0F, 0x51, 0x43, 0x44, 0x44, 0x24, 0x52, 0x15, 0x01, 0x01, 
+    0x13, 0x0E, 0x31, 0x45, 0x44, 0x54, 0x22, 0x22, 0x12, 0x01, 0x14, 0x0D, 0x51, 0x55, 0x44, 0x56, 
+    0x51, 0x25, 0x01, 0x01, 0x14, 0x0C, 0x51, 0x55, 0x76, 0x56, 0x55, 0x15, 0x01, 0x13, 0x0C, 0x51, 
+    0x55, 0x65, 0x57, 0x55, 0x13, 0x01, 0x12, 0x0D, 0x41, 0x54, 0x55, 0x45, 0x54, 0x35, 0x01, 0x01, 
+    0x12, 0x0C, 0x41, 0x44, 0x44, 0x44, 0x44, 0x15, 0x01, 0x12, 0x0C, 0x41, 0x54, 0x44, 0x44, 0x44, 
+    0x15, 0x01, 0x12, 0x0C, 0x51, 0x55, 0x33, 0x45, 0x54, 0x15, 0x01, 0x12, 0x0C, 0x51, 0x55, 0x44, 
+    0x34, 0x55, 0x12, 0x01, 0x12, 0x0D, 0x21, 0x55, 0x44, 0x74, 0x77, 0x44, 0x01, 0x01, 0x12, 0x0E, 
+    0x21, 0x22, 0x77, 0x72, 0x47, 0x44, 0x14, 0x01, 0x12, 0x0E, 0x21, 0x22, 0x77, 0x77, 0x47, 0x44, 
+    0x14, 0x01, 0x12, 0x0E, 0x51, 0x55, 0x77, 0x72, 0x17, 0x44, 0x14, 0x01, 0x12, 0x0E, 0x51, 0x55, 
+    0x77, 0x11, 0x11, 0x11, 0x11, 0x01, 0x12, 0x06, 0x51, 0x55, 0x11, 0x01, 0x12, 0x05, 0x51, 0x55, 
+    0x01, 0x01, 0x12, 0x05, 0x51, 0x55, 0x01, 0x01, 0x13, 0x04, 0x55, 0x15, 0x01, 0x14, 0x02, 0x55, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x01, 0x02, 0x02, 0x02, 0x11, 
+    0x02, 0x0F, 0x02, 0x22, 0x03, 0x03, 0x31, 0x01, 0x03, 0x0E, 0x02, 0x22, 0x04, 0x06, 0x31, 0x11, 
+    0x11, 0x02, 0x02, 0x11, 0x02, 0x0D, 0x03, 0x22, 0x02, 0x04, 0x0A, 0x31, 0x44, 0x44, 0x11, 0x15, 
+    0x02, 0x0C, 0x03, 0x22, 0x02, 0x05, 0x0A, 0x41, 0x44, 0x44, 0x54, 0x15, 0x02, 0x0B, 0x04, 0x22, 
+    0x22, 0x05, 0x0A, 0x41, 0x44, 0x44, 0x34, 0x15, 0x02, 0x0B, 0x03, 0x22, 0x02, 0x06, 0x09, 0x51, 
+    0x44, 0x44, 0x35, 0x01, 0x02, 0x0A, 0x04, 0x22, 0x22, 0x05, 0x09, 0x51, 0x46, 0x54, 0x55, 0x01, 
+    0x02, 0x0A, 0x04, 0x22, 0x22, 0x04, 0x0B, 0x51, 0x65, 0x67, 0x55, 0x55, 0x01, 0x02, 0x0A, 0x04, 
+    0x22, 0x22, 0x04, 0x0C, 0x51, 0x55, 0x67, 0x55, 0x45, 0x14, 0x02, 0x09, 0x05, 0x22, 0x22, 0x02, 
+    0x04, 0x0D, 0x51, 0x45, 0x54, 0x55, 0x44, 0x44, 0x01, 0x02, 0x09, 0x05, 0x22, 0x22, 0x02, 0x04, 
+    0x0E, 0x51, 0x44, 0x44, 0x44, 0x44, 0x44, 0x15, 0x02, 0x09, 0x06, 0x22, 0x22, 0x22, 0x03, 0x0E, 
+    0x51, 0x44, 0x44, 0x44, 0x44, 0x55, 0x15, 0x01, 0x09, 0x18, 0x22, 0x22, 0x22, 0x22, 0x22, 0x55, 
+    0x44, 0x44, 0x44, 0x54, 0x55, 0x15, 0x01, 0x09, 0x18, 0x22, 0x22, 0x22, 0x22, 0x22, 0x72, 0x77, 
+    0x44, 0x44, 0x25, 0x45, 0x14, 0x01, 0x09, 0x18, 0x22, 0x22, 0x22, 0x22, 0x22, 0x72, 0x77, 0x72, 
+    0x27, 0x22, 0x41, 0x14, 0x01, 0x09, 0x18, 0x22, 0x22, 0x22, 0x22, 0x11, 0x75, 0x77, 0x77, 0x27, 
+    0x22, 0x11, 0x11, 0x02, 0x09, 0x08, 0x21, 0x22, 0x12, 0x11, 0x01, 0x0C, 0x51, 0x77, 0x27, 0x77, 
+    0x55, 0x15, 0x02, 0x0A, 0x04, 0x11, 0x11, 0x04, 0x0C, 0x51, 0x55, 0x11, 0x77, 0x55, 0x15, 0x02, 
+    0x12, 0x05, 0x51, 0x55, 0x01, 0x01, 0x06, 0x11, 0x55, 0x15, 0x02, 0x13, 0x02, 0x55, 0x04, 0x05, 
+    0x51, 0x55, 0x01, 0x01, 0x19, 0x04, 0x51, 0x55, 0x01, 0x1A, 0x02, 0x55, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1A, 0x02, 0x11, 0x02, 0x01, 0x02, 0x02, 0x19, 0x03, 0x31, 
+    0x01, 0x03, 0x02, 0x22, 0x03, 0x12, 0x02, 0x11, 0x02, 0x06, 0x11, 0x11, 0x13, 0x04, 0x02, 0x22, 
+    0x02, 0x12, 0x0A, 0x51, 0x11, 0x44, 0x44, 0x13, 0x04, 0x03, 0x22, 0x02, 0x02, 0x12, 0x0A, 0x51, 
+    0x45, 0x44, 0x44, 0x14, 0x05, 0x03, 0x22, 0x02, 0x02, 0x12, 0x0A, 0x51, 0x43, 0x44, 0x44, 0x14, 
+    0x05, 0x04, 0x22, 0x22, 0x02, 0x13, 0x09, 0x31, 0x45, 0x44, 0x54, 0x01, 0x06, 0x03, 0x22, 0x02, 
+    0x02, 0x14, 0x09, 0x51, 0x55, 0x44, 0x56, 0x01, 0x05, 0x04, 0x22, 0x22, 0x02, 0x13, 0x0B, 0x51, 
+    0x55, 0x65, 0x67, 0x55, 0x01, 0x04, 0x04, 0x22, 0x22, 0x02, 0x12, 0x0C, 0x41, 0x54, 0x55, 0x76, 
+    0x55, 0x15, 0x04, 0x04, 0x22, 0x22, 0x02, 0x11, 0x0D, 0x41, 0x44, 0x54, 0x55, 0x44, 0x55, 0x01, 
+    0x04, 0x05, 0x22, 0x22, 0x02, 0x02, 0x10, 0x0E, 0x51, 0x44, 0x44, 0x44, 0x44, 0x44, 0x15, 0x04, 
+    0x05, 0x22, 0x22, 0x02, 0x02, 0x10, 0x0E, 0x51, 0x55, 0x44, 0x44, 0x44, 0x44, 0x15, 0x03, 0x06, 
+    0x22, 0x22, 0x22, 0x01, 0x0F, 0x18, 0x51, 0x55, 0x45, 0x44, 0x44, 0x44, 0x55, 0x22, 0x22, 0x22, 
+    0x22, 0x22, 0x01, 0x0F, 0x18, 0x41, 0x54, 0x52, 0x44, 0x44, 0x77, 0x27, 0x22, 0x22, 0x22, 0x22, 
+    0x22, 0x01, 0x0F, 0x18, 0x41, 0x14, 0x22, 0x72, 0x27, 0x77, 0x27, 0x22, 0x22, 0x22, 0x22, 0x22, 
+    0x01, 0x0F, 0x18, 0x11, 0x11, 0x22, 0x72, 0x77, 0x77, 0x57, 0x11, 0x22, 0x22, 0x22, 0x22, 0x02, 
+    0x12, 0x0C, 0x51, 0x55, 0x77, 0x72, 0x77, 0x15, 0x01, 0x08, 0x11, 0x21, 0x22, 0x12, 0x02, 0x12, 
+    0x0C, 0x51, 0x55, 0x77, 0x11, 0x55, 0x15, 0x04, 0x04, 0x11, 0x11, 0x02, 0x12, 0x06, 0x51, 0x55, 
+    0x11, 0x01, 0x05, 0x51, 0x55, 0x01, 0x02, 0x12, 0x05, 0x51, 0x55, 0x01, 0x04, 0x02, 0x55, 0x01, 
+    0x13, 0x04, 0x55, 0x15, 0x01, 0x14, 0x02, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x14, 0x02, 0x11, 0x01, 0x14, 0x03, 0x31, 0x01, 0x02, 0x14, 0x06, 0x31, 0x11, 0x11, 0x02, 
+    0x02, 0x11, 0x01, 0x14, 0x0A, 0x31, 0x44, 0x44, 0x11, 0x15, 0x01, 0x14, 0x0A, 0x41, 0x44, 0x44, 
+    0x54, 0x15, 0x01, 0x14, 0x0A, 0x41, 0x44, 0x44, 0x34, 0x15, 0x01, 0x14, 0x09, 0x51, 0x44, 0x44, 
+    0x35, 0x01, 0x01, 0x13, 0x09, 0x51, 0x45, 0x54, 0x55, 0x01, 0x01, 0x12, 0x0B, 0x51, 0x65, 0x57, 
+    0x55, 0x55, 0x01, 0x01, 0x12, 0x0C, 0x51, 0x55, 0x67, 0x55, 0x45, 0x14, 0x02, 0x0B, 0x04, 0x11, 
+    0x11, 0x03, 0x0D, 0x51, 0x45, 0x54, 0x55, 0x44, 0x44, 0x01, 0x02, 0x0A, 0x07, 0x21, 0x22, 0x12, 
+    0x01, 0x01, 0x0D, 0x51, 0x44, 0x44, 0x44, 0x44, 0x44, 0x01, 0x01, 0x0A, 0x15, 0x21, 0x22, 0x22, 
+    0x12, 0x51, 0x44, 0x44, 0x44, 0x44, 0x55, 0x01, 0x01, 0x0A, 0x15, 0x21, 0x22, 0x22, 0x22, 0x53, 
+    0x45, 0x44, 0x44, 0x44, 0x55, 0x01, 0x01, 0x0B, 0x14, 0x11, 0x21, 0x22, 0x22, 0x52, 0x45, 0x44, 
+    0x44, 0x55, 0x15, 0x01, 0x0E, 0x11, 0x11, 0x31, 0x23, 0x77, 0x57, 0x55, 0x55, 0x44, 0x01, 0x01, 
+    0x11, 0x0E, 0x11, 0x72, 0x77, 0x72, 0x27, 0x42, 0x14, 0x01, 0x12, 0x0D, 0x51, 0x77, 0x77, 0x77, 
+    0x22, 0x12, 0x01, 0x01, 0x12, 0x0C, 0x51, 0x77, 0x27, 0x77, 0x55, 0x15, 0x01, 0x12, 0x0C, 0x51, 
+    0x55, 0x11, 0x77, 0x55, 0x15, 0x02, 0x12, 0x05, 0x51, 0x55, 0x01, 0x01, 0x06, 0x11, 0x55, 0x15, 
+    0x02, 0x13, 0x02, 0x55, 0x04, 0x05, 0x51, 0x55, 0x01, 0x01, 0x19, 0x04, 0x51, 0x55, 0x01, 0x1A, 
+    0x02, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1A, 0x02, 0x11, 0x01, 0x19, 
+    0x03, 0x31, 0x01, 0x02, 0x12, 0x02, 0x11, 0x02, 0x06, 0x11, 0x11, 0x13, 0x01, 0x12, 0x0A, 0x51, 
+    0x11, 0x44, 0x44, 0x13, 0x01, 0x12, 0x0A, 0x51, 0x45, 0x44, 0x44, 0x14, 0x01, 0x12, 0x0A, 0x51, 
+    0x43, 0x44, 0x44, 0x14, 0x01, 0x13, 0x09, 0x31, 0x45, 0x44, 0x54, 0x01, 0x01, 0x14, 0x09, 0x51, 
+    0x55, 0x44, 0x55, 0x01, 0x01, 0x13, 0x0B, 0x51, 0x55, 0x55, 0x67, 0x55, 0x01, 0x01, 0x12, 0x0C, 
+    0x41, 0x54, 0x55, 0x76, 0x55, 0x15, 0x02, 0x11, 0x0D, 0x41, 0x44, 0x54, 0x55, 0x44, 0x55, 0x01, 
+    0x03, 0x04, 0x11, 0x11, 0x02, 0x11, 0x0D, 0x41, 0x44, 0x44, 0x44, 0x44, 0x54, 0x01, 0x01, 0x07, 
+    0x11, 0x22, 0x22, 0x01, 0x01, 0x11, 0x15, 0x51, 0x45, 0x44, 0x44, 0x44, 0x54, 0x11, 0x22, 0x22, 
+    0x22, 0x01, 0x01, 0x11, 0x15, 0x51, 0x45, 0x44, 0x44, 0x44, 0x55, 0x23, 0x22, 0x22, 0x22, 0x01, 
+    0x01, 0x11, 0x14, 0x51, 0x55, 0x44, 0x44, 0x54, 0x25, 0x22, 0x22, 0x12, 0x11, 0x01, 0x11, 0x11, 
+    0x41, 0x54, 0x55, 0x55, 0x77, 0x27, 0x33, 0x11, 0x01, 0x01, 0x11, 0x0E, 0x41, 0x24, 0x72, 0x27, 
+    0x77, 0x27, 0x11, 0x01, 0x11, 0x0D, 0x11, 0x22, 0x72, 0x77, 0x77, 0x57, 0x01, 0x01, 0x12, 0x0C, 
+    0x51, 0x55, 0x77, 0x72, 0x77, 0x15, 0x01, 0x12, 0x0C, 0x51, 0x55, 0x77, 0x11, 0x55, 0x15, 0x02, 
+    0x12, 0x06, 0x51, 0x55, 0x11, 0x01, 0x05, 0x51, 0x55, 0x01, 0x02, 0x12, 0x05, 0x51, 0x55, 0x01, 
+    0x04, 0x02, 0x55, 0x01, 0x13, 0x04, 0x55, 0x15, 0x01, 0x14, 0x02, 0x55, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+const RLESprite goblin_S_Attack_rle[6] = {
+    {48, 48, 4, goblin_S_Attack_palette, {goblin_S_Attack_rle_data + 0, goblin_S_Attack_rle_data + 252}},
+    {48, 48, 4, goblin_S_Attack_palette, {goblin_S_Attack_rle_data + 504, goblin_S_Attack_rle_data + 778}},
+    {48, 48, 4, goblin_S_Attack_palette, {goblin_S_Attack_rle_data + 1052, goblin_S_Attack_rle_data + 1293}},
+    {48, 48, 4, goblin_S_Attack_palette, {goblin_S_Attack_rle_data + 1534, goblin_S_Attack_rle_data + 1772}},
+    {48, 48, 4, goblin_S_Attack_palette, {goblin_S_Attack_rle_data + 2010, goblin_S_Attack_rle_data + 2310}},
+    {48, 48, 4, goblin_S_Attack_palette, {goblin_S_Attack_rle_data + 2610, goblin_S_Attack_rle_data + 2860}},
+};
+
+// goblin_S_Walk: 6 frames of 48x48, 7 colours
+static const unsigned short int goblin_S_Walk_palette[8] = {
+    0x0000, 0x0865, 0x4385, 0x7268, 0xA589, 0x84A8, 0xFF17, 0xB2C8, 
+};
+static const unsigned char goblin_S_Walk_rle_data[2988] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 
+    0x02, 0x11, 0x01, 0x14, 0x03, 0x21, 0x01, 0x02, 0x14, 0x06, 0x21, 0x11, 0x11, 0x02, 0x02, 0x11, 
+    0x01, 0x14, 0x0A, 0x21, 0x44, 0x44, 0x11, 0x15, 0x02, 0x0E, 0x02, 0x11, 0x04, 0x0A, 0x41, 0x44, 
+    0x44, 0x54, 0x15, 0x02, 0x0D, 0x04, 0x31, 0x13, 0x03, 0x0A, 0x41, 0x44, 0x44, 0x24, 0x15, 0x02, 
+    0x0C, 0x06, 0x31, 0x33, 0x13, 0x02, 0x09, 0x51, 0x44, 0x44, 0x25, 0x01, 0x02, 0x0C, 0x06, 0x31, 
+    0x33, 0x13, 0x01, 0x09, 0x51, 0x45, 0x54, 0x55, 0x01, 0x01, 0x0C, 0x11, 0x31, 0x33, 0x13, 0x51, 
+    0x65, 0x57, 0x55, 0x55, 0x01, 0x01, 0x0D, 0x11, 0x31, 0x33, 0x11, 0x55, 0x75, 0x56, 0x55, 0x44, 
+    0x01, 0x01, 0x0D, 0x12, 0x31, 0x33, 0x13, 0x55, 0x44, 0x55, 0x45, 0x44, 0x14, 0x01, 0x0E, 0x12, 
+    0x31, 0x53, 0x55, 0x44, 0x44, 0x44, 0x44, 0x44, 0x15, 0x01, 0x0E, 0x12, 0x51, 0x53, 0x55, 0x44, 
+    0x44, 0x44, 0x44, 0x55, 0x15, 0x01, 0x0E, 0x13, 0x51, 0x33, 0x52, 0x45, 0x44, 0x44, 0x44, 0x55, 
+    0x44, 0x01, 0x01, 0x0F, 0x12, 0x31, 0x13, 0x53, 0x45, 0x44, 0x44, 0x55, 0x45, 0x14, 0x01, 0x10, 
+    0x11, 0x11, 0x31, 0x77, 0x57, 0x55, 0x55, 0x13, 0x44, 0x01, 0x01, 0x12, 0x0F, 0x31, 0x77, 0x37, 
+    0x77, 0x33, 0x13, 0x11, 0x01, 0x01, 0x12, 0x0C, 0x51, 0x77, 0x77, 0x77, 0x53, 0x15, 0x01, 0x12, 
+    0x0C, 0x51, 0x77, 0x77, 0x47, 0x44, 0x15, 0x01, 0x12, 0x0C, 0x51, 0x55, 0x71, 0x47, 0x44, 0x15, 
+    0x01, 0x12, 0x0C, 0x51, 0x55, 0x11, 0x51, 0x55, 0x15, 0x02, 0x13, 0x02, 0x55, 0x04, 0x04, 0x11, 
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1A, 0x02, 0x11, 0x01, 
+    0x19, 0x03, 0x21, 0x01, 0x02, 0x12, 0x02, 0x11, 0x02, 0x06, 0x11, 0x11, 0x12, 0x01, 0x12, 0x0A, 
+    0x51, 0x11, 0x44, 0x44, 0x12, 0x02, 0x12, 0x0A, 0x51, 0x45, 0x44, 0x44, 0x14, 0x04, 0x02, 0x11, 
+    0x02, 0x12, 0x0A, 0x51, 0x42, 0x44, 0x44, 0x14, 0x03, 0x04, 0x31, 0x13, 0x02, 0x13, 0x09, 0x21, 
+    0x45, 0x44, 0x54, 0x01, 0x02, 0x06, 0x31, 0x33, 0x13, 0x02, 0x14, 0x09, 0x51, 0x55, 0x44, 0x55, 
+    0x01, 0x01, 0x06, 0x31, 0x33, 0x13, 0x01, 0x13, 0x11, 0x51, 0x55, 0x55, 0x67, 0x55, 0x11, 0x33, 
+    0x33, 0x01, 0x01, 0x12, 0x11, 0x41, 0x54, 0x55, 0x76, 0x55, 0x15, 0x31, 0x33, 0x01, 0x01, 0x11, 
+    0x12, 0x41, 0x44, 0x54, 0x55, 0x44, 0x55, 0x31, 0x33, 0x13, 0x01, 0x10, 0x12, 0x51, 0x44, 0x44, 
+    0x44, 0x44, 0x44, 0x55, 0x35, 0x13, 0x01, 0x10, 0x12, 0x51, 0x55, 0x44, 0x44, 0x44, 0x44, 0x55, 
+    0x35, 0x15, 0x01, 0x0F, 0x13, 0x41, 0x54, 0x45, 0x44, 0x44, 0x44, 0x55, 0x32, 0x53, 0x01, 0x01, 
+    0x0F, 0x12, 0x41, 0x54, 0x55, 0x44, 0x44, 0x54, 0x35, 0x31, 0x13, 0x01, 0x0F, 0x11, 0x41, 0x14, 
+    0x53, 0x55, 0x55, 0x77, 0x37, 0x11, 0x01, 0x01, 0x0F, 0x0F, 0x11, 0x11, 0x33, 0x73, 0x37, 0x77, 
+    0x37, 0x01, 0x01, 0x12, 0x0C, 0x51, 0x35, 0x77, 0x77, 0x77, 0x15, 0x01, 0x12, 0x0C, 0x51, 0x44, 
+    0x74, 0x77, 0x77, 0x15, 0x01, 0x12, 0x0C, 0x51, 0x44, 0x74, 0x17, 0x55, 0x15, 0x01, 0x12, 0x0C, 
+    0x51, 0x55, 0x15, 0x11, 0x55, 0x15, 0x02, 0x13, 0x04, 0x11, 0x11, 0x04, 0x02, 0x55, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x02, 0x11, 0x01, 0x14, 0x03, 0x21, 0x01, 
+    0x03, 0x0E, 0x02, 0x11, 0x04, 0x06, 0x21, 0x11, 0x11, 0x02, 0x02, 0x11, 0x02, 0x0D, 0x04, 0x31, 
+    0x13, 0x03, 0x0A, 0x21, 0x44, 0x44, 0x11, 0x15, 0x02, 0x0C, 0x06, 0x31, 0x33, 0x13, 0x02, 0x0A, 
+    0x41, 0x44, 0x44, 0x54, 0x15, 0x02, 0x0C, 0x06, 0x31, 0x33, 0x13, 0x02, 0x0A, 0x41, 0x44, 0x44, 
+    0x24, 0x15, 0x02, 0x0C, 0x06, 0x31, 0x33, 0x13, 0x02, 0x09, 0x51, 0x44, 0x44, 0x25, 0x01, 0x02, 
+    0x0C, 0x06, 0x31, 0x33, 0x13, 0x01, 0x09, 0x51, 0x45, 0x54, 0x55, 0x01, 0x01, 0x0D, 0x10, 0x31, 
+    0x33, 0x11, 0x55, 0x76, 0x55, 0x55, 0x15, 0x01, 0x0D, 0x12, 0x31, 0x33, 0x21, 0x55, 0x75, 0x56, 
+    0x55, 0x44, 0x11, 0x01, 0x0D, 0x13, 0x31, 0x53, 0x25, 0x55, 0x44, 0x55, 0x45, 0x44, 0x54, 0x01, 
+    0x01, 0x0D, 0x14, 0x51, 0x53, 0x25, 0x45, 0x44, 0x44, 0x44, 0x44, 0x54, 0x15, 0x01, 0x0D, 0x15, 
+    0x51, 0x33, 0x22, 0x45, 0x44, 0x44, 0x44, 0x54, 0x55, 0x44, 0x01, 0x01, 0x0E, 0x15, 0x31, 0x13, 
+    0x51, 0x45, 0x44, 0x44, 0x44, 0x55, 0x45, 0x44, 0x01, 0x01, 0x0F, 0x14, 0x11, 0x11, 0x53, 0x45, 
+    0x44, 0x44, 0x55, 0x11, 0x45, 0x14, 0x02, 0x12, 0x0C, 0x31, 0x77, 0x57, 0x55, 0x55, 0x13, 0x01, 
+    0x04, 0x11, 0x11, 0x01, 0x12, 0x0C, 0x31, 0x77, 0x37, 0x77, 0x33, 0x13, 0x01, 0x13, 0x0B, 0x71, 
+    0x77, 0x77, 0x37, 0x55, 0x01, 0x01, 0x13, 0x0B, 0x71, 0x77, 0x77, 0x44, 0x54, 0x01, 0x01, 0x14, 
+    0x09, 0x21, 0x72, 0x44, 0x44, 0x01, 0x01, 0x14, 0x08, 0x21, 0x22, 0x44, 0x14, 0x01, 0x15, 0x07, 
+    0x22, 0x51, 0x55, 0x01, 0x01, 0x17, 0x05, 0x51, 0x55, 0x01, 0x01, 0x18, 0x03, 0x11, 0x01, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1A, 0x02, 0x11, 0x01, 0x19, 0x03, 0x21, 0x01, 
+    0x03, 0x12, 0x02, 0x11, 0x02, 0x06, 0x11, 0x11, 0x12, 0x04, 0x02, 0x11, 0x02, 0x12, 0x0A, 0x51, 
+    0x11, 0x44, 0x44, 0x12, 0x03, 0x04, 0x31, 0x13, 0x02, 0x12, 0x0A, 0x51, 0x45, 0x44, 0x44, 0x14, 
+    0x02, 0x06, 0x31, 0x33, 0x13, 0x02, 0x12, 0x0A, 0x51, 0x42, 0x44, 0x44, 0x14, 0x02, 0x06, 0x31, 
+    0x33, 0x13, 0x02, 0x13, 0x09, 0x21, 0x45, 0x44, 0x54, 0x01, 0x02, 0x06, 0x31, 0x33, 0x13, 0x02, 
+    0x14, 0x09, 0x51, 0x55, 0x44, 0x55, 0x01, 0x01, 0x06, 0x31, 0x33, 0x13, 0x01, 0x13, 0x10, 0x51, 
+    0x55, 0x55, 0x67, 0x55, 0x11, 0x33, 0x13, 0x01, 0x11, 0x12, 0x11, 0x44, 0x55, 0x65, 0x57, 0x55, 
+    0x12, 0x33, 0x13, 0x01, 0x10, 0x13, 0x51, 0x44, 0x44, 0x55, 0x45, 0x54, 0x25, 0x55, 0x33, 0x01, 
+    0x01, 0x0F, 0x14, 0x51, 0x45, 0x44, 0x44, 0x44, 0x44, 0x54, 0x52, 0x35, 0x15, 0x01, 0x0E, 0x15, 
+    0x41, 0x54, 0x55, 0x44, 0x44, 0x44, 0x44, 0x25, 0x32, 0x53, 0x01, 0x01, 0x0D, 0x15, 0x41, 0x44, 
+    0x55, 0x45, 0x44, 0x44, 0x44, 0x55, 0x11, 0x33, 0x01, 0x01, 0x0D, 0x14, 0x41, 0x54, 0x11, 0x55, 
+    0x44, 0x44, 0x54, 0x35, 0x11, 0x11, 0x02, 0x0D, 0x04, 0x11, 0x11, 0x01, 0x0C, 0x31, 0x55, 0x55, 
+    0x75, 0x77, 0x13, 0x01, 0x12, 0x0C, 0x31, 0x33, 0x77, 0x73, 0x77, 0x13, 0x01, 0x12, 0x0B, 0x51, 
+    0x35, 0x77, 0x77, 0x77, 0x01, 0x01, 0x12, 0x0B, 0x51, 0x44, 0x74, 0x77, 0x77, 0x01, 0x01, 0x13, 
+    0x09, 0x41, 0x44, 0x74, 0x22, 0x01, 0x01, 0x14, 0x08, 0x41, 0x44, 0x22, 0x12, 0x01, 0x14, 0x07, 
+    0x51, 0x55, 0x21, 0x02, 0x01, 0x14, 0x05, 0x51, 0x55, 0x01, 0x01, 0x15, 0x03, 0x11, 0x01, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x02, 0x11, 0x01, 0x14, 0x03, 0x21, 
+    0x01, 0x02, 0x14, 0x06, 0x21, 0x11, 0x11, 0x02, 0x02, 0x11, 0x01, 0x14, 0x0A, 0x21, 0x44, 0x44, 
+    0x11, 0x15, 0x02, 0x0E, 0x02, 0x11, 0x04, 0x0A, 0x41, 0x44, 0x44, 0x54, 0x15, 0x02, 0x0D, 0x04, 
+    0x31, 0x13, 0x03, 0x0A, 0x41, 0x44, 0x44, 0x24, 0x15, 0x02, 0x0C, 0x06, 0x31, 0x33, 0x13, 0x02, 
+    0x09, 0x51, 0x44, 0x44, 0x25, 0x01, 0x02, 0x0C, 0x06, 0x31, 0x33, 0x13, 0x01, 0x09, 0x51, 0x45, 
+    0x54, 0x55, 0x01, 0x01, 0x0C, 0x11, 0x31, 0x33, 0x13, 0x51, 0x65, 0x57, 0x55, 0x55, 0x01, 0x01, 
+    0x0D, 0x11, 0x31, 0x33, 0x11, 0x55, 0x75, 0x56, 0x55, 0x44, 0x01, 0x01, 0x0D, 0x12, 0x31, 0x33, 
+    0x13, 0x55, 0x44, 0x55, 0x45, 0x44, 0x14, 0x01, 0x0E, 0x11, 0x31, 0x53, 0x55, 0x44, 0x44, 0x44, 
+    0x44, 0x44, 0x01, 0x01, 0x0E, 0x12, 0x51, 0x53, 0x55, 0x44, 0x44, 0x44, 0x44, 0x55, 0x15, 0x01, 
+    0x0E, 0x12, 0x51, 0x33, 0x52, 0x45, 0x44, 0x44, 0x44, 0x45, 0x14, 0x01, 0x0F, 0x11, 0x31, 0x13, 
+    0x53, 0x45, 0x44, 0x44, 0x55, 0x44, 0x01, 0x01, 0x10, 0x10, 0x11, 0x31, 0x77, 0x57, 0x55, 0x55, 
+    0x43, 0x14, 0x01, 0x12, 0x0E, 0x31, 0x77, 0x37, 0x77, 0x33, 0x13, 0x11, 0x01, 0x12, 0x0C, 0x21, 
+    0x77, 0x77, 0x77, 0x55, 0x15, 0x01, 0x12, 0x0B, 0x21, 0x77, 0x77, 0x47, 0x44, 0x01, 0x01, 0x13, 
+    0x0A, 0x21, 0x22, 0x77, 0x44, 0x14, 0x01, 0x14, 0x09, 0x21, 0x12, 0x44, 0x54, 0x01, 0x01, 0x15, 
+    0x07, 0x11, 0x41, 0x44, 0x01, 0x01, 0x17, 0x05, 0x51, 0x55, 0x01, 0x01, 0x18, 0x02, 0x55, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1A, 0x02, 0x11, 0x01, 0x19, 0x03, 0x21, 0x01, 
+    0x02, 0x12, 0x02, 0x11, 0x02, 0x06, 0x11, 0x11, 0x12, 0x01, 0x12, 0x0A, 0x51, 0x11, 0x44, 0x44, 
+    0x12, 0x02, 0x12, 0x0A, 0x51, 0x45, 0x44, 0x44, 0x14, 0x04, 0x02, 0x11, 0x02, 0x12, 0x0A, 0x51, 
+    0x42, 0x44, 0x44, 0x14, 0x03, 0x04, 0x31, 0x13, 0x02, 0x13, 0x09, 0x21, 0x45, 0x44, 0x54, 0x01, 
+    0x02, 0x06, 0x31, 0x33, 0x13, 0x02, 0x14, 0x09, 0x51, 0x55, 0x44, 0x55, 0x01, 0x01, 0x06, 0x31, 
+    0x33, 0x13, 0x01, 0x13, 0x11, 0x51, 0x55, 0x55, 0x67, 0x55, 0x11, 0x33, 0x33, 0x01, 0x01, 0x12, 
+    0x11, 0x41, 0x54, 0x55, 0x76, 0x55, 0x15, 0x31, 0x33, 0x01, 0x01, 0x11, 0x12, 0x41, 0x44, 0x54, 
+    0x55, 0x44, 0x55, 0x31, 0x33, 0x13, 0x01, 0x11, 0x11, 0x41, 0x44, 0x44, 0x44, 0x44, 0x54, 0x55, 
+    0x33, 0x01, 0x01, 0x10, 0x12, 0x51, 0x55, 0x44, 0x44, 0x44, 0x44, 0x55, 0x35, 0x15, 0x01, 0x10, 
+    0x12, 0x41, 0x54, 0x44, 0x44, 0x44, 0x54, 0x25, 0x33, 0x15, 0x01, 0x10, 0x11, 0x41, 0x54, 0x45, 
+    0x44, 0x44, 0x55, 0x13, 0x33, 0x01, 0x01, 0x10, 0x10, 0x41, 0x34, 0x55, 0x55, 0x75, 0x77, 0x13, 
+    0x11, 0x01, 0x10, 0x0E, 0x11, 0x31, 0x33, 0x77, 0x73, 0x77, 0x13, 0x01, 0x12, 0x0C, 0x51, 0x55, 
+    0x77, 0x77, 0x77, 0x12, 0x01, 0x13, 0x0B, 0x41, 0x44, 0x77, 0x77, 0x27, 0x01, 0x01, 0x13, 0x0A, 
+    0x41, 0x44, 0x77, 0x22, 0x12, 0x01, 0x13, 0x09, 0x51, 0x44, 0x14, 0x22, 0x01, 0x01, 0x14, 0x07, 
+    0x41, 0x44, 0x11, 0x01, 0x01, 0x14, 0x05, 0x51, 0x55, 0x01, 0x01, 0x16, 0x02, 0x55, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x02, 0x11, 0x01, 0x14, 0x03, 0x21, 0x01, 0x02, 
+    0x14, 0x06, 0x21, 0x11, 0x11, 0x02, 0x02, 0x11, 0x01, 0x14, 0x0A, 0x21, 0x44, 0x44, 0x11, 0x15, 
+    0x01, 0x14, 0x0A, 0x41, 0x44, 0x44, 0x54, 0x15, 0x01, 0x14, 0x0A, 0x41, 0x44, 0x44, 0x24, 0x15, 
+    0x01, 0x14, 0x09, 0x51, 0x44, 0x44, 0x25, 0x01, 0x01, 0x13, 0x09, 0x51, 0x45, 0x54, 0x55, 0x01, 
+    0x01, 0x12, 0x0B, 0x51, 0x65, 0x57, 0x55, 0x55, 0x01, 0x02, 0x0E, 0x03, 0x11, 0x01, 0x01, 0x0C, 
+    0x51, 0x55, 0x67, 0x55, 0x45, 0x14, 0x01, 0x0D, 0x12, 0x31, 0x33, 0x11, 0x55, 0x44, 0x55, 0x45, 
+    0x44, 0x14, 0x01, 0x0C, 0x13, 0x31, 0x33, 0x33, 0x53, 0x44, 0x44, 0x44, 0x44, 0x44, 0x01, 0x01, 
+    0x0C, 0x13, 0x31, 0x33, 0x33, 0x53, 0x44, 0x44, 0x44, 0x54, 0x55, 0x01, 0x01, 0x0D, 0x12, 0x31, 
+    0x33, 0x33, 0x55, 0x44, 0x44, 0x24, 0x44, 0x15, 0x01, 0x0E, 0x10, 0x11, 0x11, 0x31, 0x55, 0x44, 
+    0x24, 0x44, 0x14, 0x01, 0x12, 0x0C, 0x31, 0x77, 0x57, 0x25, 0x44, 0x13, 0x01, 0x12, 0x0C, 0x31, 
+    0x77, 0x37, 0x77, 0x33, 0x13, 0x01, 0x12, 0x0C, 0x51, 0x77, 0x77, 0x77, 0x33, 0x15, 0x01, 0x12, 
+    0x0C, 0x51, 0x77, 0x37, 0x77, 0x55, 0x15, 0x01, 0x12, 0x0C, 0x51, 0x55, 0x71, 0x17, 0x55, 0x15, 
+    0x01, 0x12, 0x0C, 0x51, 0x55, 0x11, 0x11, 0x55, 0x15, 0x02, 0x13, 0x04, 0x11, 0x11, 0x02, 0x05, 
+    0x51, 0x55, 0x01, 0x01, 0x19, 0x05, 0x51, 0x55, 0x01, 0x01, 0x1A, 0x02, 0x55, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1A, 0x02, 0x11, 0x01, 0x19, 0x03, 0x21, 0x01, 0x02, 0x12, 
+    0x02, 0x11, 0x02, 0x06, 0x11, 0x11, 0x12, 0x01, 0x12, 0x0A, 0x51, 0x11, 0x44, 0x44, 0x12, 0x01, 
+    0x12, 0x0A, 0x51, 0x45, 0x44, 0x44, 0x14, 0x01, 0x12, 0x0A, 0x51, 0x42, 0x44, 0x44, 0x14, 0x01, 
+    0x13, 0x09, 0x21, 0x45, 0x44, 0x54, 0x01, 0x01, 0x14, 0x09, 0x51, 0x55, 0x44, 0x55, 0x01, 0x01, 
+    0x13, 0x0B, 0x51, 0x55, 0x55, 0x67, 0x55, 0x01, 0x02, 0x12, 0x0C, 0x41, 0x54, 0x55, 0x76, 0x55, 
+    0x15, 0x01, 0x03, 0x11, 0x01, 0x01, 0x11, 0x12, 0x41, 0x44, 0x54, 0x55, 0x44, 0x55, 0x11, 0x33, 
+    0x13, 0x01, 0x11, 0x13, 0x41, 0x44, 0x44, 0x44, 0x44, 0x54, 0x33, 0x33, 0x33, 0x01, 0x01, 0x11, 
+    0x13, 0x51, 0x55, 0x44, 0x44, 0x44, 0x54, 0x33, 0x33, 0x33, 0x01, 0x01, 0x11, 0x12, 0x51, 0x44, 
+    0x42, 0x44, 0x44, 0x55, 0x33, 0x33, 0x13, 0x01, 0x12, 0x10, 0x41, 0x44, 0x42, 0x44, 0x55, 0x13, 
+    0x11, 0x11, 0x01, 0x12, 0x0C, 0x31, 0x44, 0x52, 0x75, 0x77, 0x13, 0x01, 0x12, 0x0C, 0x31, 0x33, 
+    0x77, 0x73, 0x77, 0x13, 0x01, 0x12, 0x0C, 0x51, 0x33, 0x77, 0x77, 0x77, 0x15, 0x01, 0x12, 0x0C, 
+    0x51, 0x55, 0x77, 0x73, 0x77, 0x15, 0x01, 0x12, 0x0C, 0x51, 0x55, 0x71, 0x17, 0x55, 0x15, 0x01, 
+    0x12, 0x0C, 0x51, 0x55, 0x11, 0x11, 0x55, 0x15, 0x02, 0x12, 0x05, 0x51, 0x55, 0x01, 0x02, 0x04, 
+    0x11, 0x11, 0x01, 0x12, 0x05, 0x51, 0x55, 0x01, 0x01, 0x14, 0x02, 0x55, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x01, 0x14, 0x02, 0x11, 0x01, 0x14, 0x03, 0x21, 0x01, 0x02, 0x14, 0x06, 0x21, 
+    0x11, 0x11, 0x02, 0x02, 0x11, 0x01, 0x14, 0x0A, 0x21, 0x44, 0x44, 0x11, 0x15, 0x01, 0x14, 0x0A, 
+    0x41, 0x44, 0x44, 0x54, 0x15, 0x01, 0x14, 0x0A, 0x41, 0x44, 0x44, 0x24, 0x15, 0x01, 0x14, 0x09, 
+    0x51, 0x44, 0x44, 0x25, 0x01, 0x01, 0x13, 0x09, 0x51, 0x45, 0x54, 0x55, 0x01, 0x01, 0x12, 0x0B, 
+    0x51, 0x65, 0x57, 0x55, 0x55, 0x01, 0x01, 0x12, 0x0C, 0x51, 0x55, 0x67, 0x55, 0x45, 0x14, 0x01, 
+    0x12, 0x0C, 0x51, 0x45, 0x54, 0x55, 0x44, 0x14, 0x01, 0x10, 0x0E, 0x11, 0x51, 0x44, 0x44, 0x44, 
+    0x44, 0x14, 0x01, 0x0F, 0x0F, 0x31, 0x33, 0x45, 0x54, 0x25, 0x52, 0x44, 0x01, 0x01, 0x0E, 0x10, 
+    0x31, 0x33, 0x53, 0x45, 0x42, 0x44, 0x55, 0x15, 0x01, 0x0E, 0x10, 0x31, 0x33, 0x33, 0x55, 0x42, 
+    0x44, 0x55, 0x15, 0x01, 0x0F, 0x0F, 0x31, 0x33, 0x73, 0x77, 0x55, 0x55, 0x35, 0x01, 0x01, 0x10, 
+    0x0E, 0x11, 0x31, 0x77, 0x37, 0x77, 0x33, 0x13, 0x01, 0x11, 0x0E, 0x51, 0x75, 0x77, 0x77, 0x37, 
+    0x53, 0x15, 0x01, 0x11, 0x0E, 0x51, 0x75, 0x77, 0x73, 0x57, 0x55, 0x15, 0x01, 0x11, 0x0E, 0x51, 
+    0x55, 0x11, 0x71, 0x17, 0x55, 0x15, 0x02, 0x12, 0x04, 0x51, 0x15, 0x02, 0x08, 0x11, 0x51, 0x55, 
+    0x15, 0x02, 0x13, 0x02, 0x11, 0x06, 0x05, 0x51, 0x55, 0x01, 0x01, 0x1B, 0x05, 0x51, 0x55, 0x01, 
+    0x01, 0x1C, 0x02, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1A, 0x02, 0x11, 
+    0x01, 0x19, 0x03, 0x21, 0x01, 0x02, 0x12, 0x02, 0x11, 0x02, 0x06, 0x11, 0x11, 0x12, 0x01, 0x12, 
+    0x0A, 0x51, 0x11, 0x44, 0x44, 0x12, 0x01, 0x12, 0x0A, 0x51, 0x45, 0x44, 0x44, 0x14, 0x01, 0x12, 
+    0x0A, 0x51, 0x42, 0x44, 0x44, 0x14, 0x01, 0x13, 0x09, 0x21, 0x45, 0x44, 0x54, 0x01, 0x01, 0x14, 
+    0x09, 0x51, 0x55, 0x44, 0x55, 0x01, 0x01, 0x13, 0x0B, 0x51, 0x55, 0x55, 0x67, 0x55, 0x01, 0x01, 
+    0x12, 0x0C, 0x41, 0x54, 0x55, 0x76, 0x55, 0x15, 0x01, 0x12, 0x0C, 0x41, 0x44, 0x55, 0x45, 0x54, 
+    0x15, 0x01, 0x12, 0x0E, 0x41, 0x44, 0x44, 0x44, 0x44, 0x15, 0x11, 0x01, 0x12, 0x0F, 0x41, 0x54, 
+    0x22, 0x55, 0x44, 0x35, 0x33, 0x01, 0x01, 0x12, 0x10, 0x51, 0x55, 0x44, 0x24, 0x54, 0x35, 0x33, 
+    0x13, 0x01, 0x12, 0x10, 0x51, 0x55, 0x44, 0x24, 0x55, 0x33, 0x33, 0x13, 0x01, 0x12, 0x0F, 0x31, 
+    0x55, 0x55, 0x75, 0x77, 0x33, 0x33, 0x01, 0x01, 0x12, 0x0E, 0x31, 0x33, 0x77, 0x73, 0x77, 0x13, 
+    0x11, 0x01, 0x11, 0x0E, 0x51, 0x35, 0x73, 0x77, 0x77, 0x57, 0x15, 0x01, 0x11, 0x0E, 0x51, 0x55, 
+    0x75, 0x37, 0x77, 0x57, 0x15, 0x01, 0x11, 0x0E, 0x51, 0x55, 0x71, 0x17, 0x11, 0x55, 0x15, 0x02, 
+    0x10, 0x08, 0x51, 0x55, 0x15, 0x11, 0x02, 0x04, 0x51, 0x15, 0x02, 0x10, 0x05, 0x51, 0x55, 0x01, 
+    0x06, 0x02, 0x11, 0x01, 0x10, 0x05, 0x51, 0x55, 0x01, 0x01, 0x12, 0x02, 0x55, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x02, 0x11, 0x01, 0x14, 0x03, 0x21, 0x01, 0x02, 
+    0x14, 0x06, 0x21, 0x11, 0x11, 0x02, 0x02, 0x11, 0x01, 0x14, 0x0A, 0x21, 0x44, 0x44, 0x11, 0x15, 
+    0x01, 0x14, 0x0A, 0x41, 0x44, 0x44, 0x54, 0x15, 0x01, 0x14, 0x0A, 0x41, 0x44, 0x44, 0x24, 0x15, 
+    0x01, 0x14, 0x09, 0x51, 0x44, 0x44, 0x25, 0x01, 0x01, 0x13, 0x09, 0x51, 0x45, 0x54, 0x55, 0x01, 
+    0x01, 0x12, 0x0B, 0x51, 0x65, 0x57, 0x55, 0x55, 0x01, 0x02, 0x0E, 0x03, 0x11, 0x01, 0x01, 0x0C, 
+    0x51, 0x55, 0x67, 0x55, 0x45, 0x14, 0x01, 0x0D, 0x12, 0x31, 0x33, 0x11, 0x55, 0x44, 0x55, 0x45, 
+    0x44, 0x14, 0x01, 0x0C, 0x13, 0x31, 0x33, 0x33, 0x53, 0x44, 0x44, 0x44, 0x44, 0x44, 0x01, 0x01, 
+    0x0C, 0x13, 0x31, 0x33, 0x33, 0x53, 0x44, 0x44, 0x44, 0x44, 0x55, 0x01, 0x01, 0x0D, 0x12, 0x31, 
+    0x33, 0x33, 0x55, 0x44, 0x44, 0x44, 0x55, 0x15, 0x01, 0x0E, 0x10, 0x11, 0x11, 0x31, 0x55, 0x44, 
+    0x44, 0x42, 0x14, 0x01, 0x12, 0x0C, 0x31, 0x77, 0x57, 0x25, 0x44, 0x14, 0x01, 0x12, 0x0C, 0x31, 
+    0x77, 0x37, 0x77, 0x44, 0x13, 0x01, 0x11, 0x0D, 0x51, 0x75, 0x77, 0x77, 0x37, 0x53, 0x01, 0x01, 
+    0x11, 0x0E, 0x51, 0x75, 0x77, 0x73, 0x57, 0x55, 0x15, 0x01, 0x10, 0x10, 0x51, 0x55, 0x15, 0x11, 
+    0x77, 0x55, 0x55, 0x15, 0x02, 0x10, 0x05, 0x51, 0x55, 0x01, 0x03, 0x08, 0x11, 0x51, 0x55, 0x15, 
+    0x02, 0x11, 0x03, 0x55, 0x05, 0x07, 0x05, 0x51, 0x55, 0x01, 0x01, 0x1C, 0x04, 0x11, 0x11, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1A, 0x02, 0x11, 0x01, 0x19, 0x03, 0x21, 
+    0x01, 0x02, 0x12, 0x02, 0x11, 0x02, 0x06, 0x11, 0x11, 0x12, 0x01, 0x12, 0x0A, 0x51, 0x11, 0x44, 
+    0x44, 0x12, 0x01, 0x12, 0x0A, 0x51, 0x45, 0x44, 0x44, 0x14, 0x01, 0x12, 0x0A, 0x51, 0x42, 0x44, 
+    0x44, 0x14, 0x01, 0x13, 0x09, 0x21, 0x45, 0x44, 0x54, 0x01, 0x01, 0x14, 0x09, 0x51, 0x55, 0x44, 
+    0x55, 0x01, 0x01, 0x13, 0x0B, 0x51, 0x55, 0x55, 0x67, 0x55, 0x01, 0x02, 0x12, 0x0C, 0x41, 0x54, 
+    0x55, 0x76, 0x55, 0x15, 0x01, 0x03, 0x11, 0x01, 0x01, 0x11, 0x12, 0x41, 0x44, 0x54, 0x55, 0x44, 
+    0x55, 0x11, 0x33, 0x13, 0x01, 0x11, 0x13, 0x41, 0x44, 0x44, 0x44, 0x44, 0x54, 0x33, 0x33, 0x33, 
+    0x01, 0x01, 0x11, 0x13, 0x51, 0x45, 0x44, 0x44, 0x44, 0x54, 0x33, 0x33, 0x33, 0x01, 0x01, 0x11, 
+    0x12, 0x51, 0x55, 0x44, 0x44, 0x44, 0x55, 0x33, 0x33, 0x13, 0x01, 0x12, 0x10, 0x41, 0x24, 0x44, 
+    0x44, 0x55, 0x13, 0x11, 0x11, 0x01, 0x12, 0x0C, 0x41, 0x44, 0x52, 0x75, 0x77, 0x13, 0x01, 0x12, 
+    0x0C, 0x31, 0x44, 0x77, 0x73, 0x77, 0x13, 0x01, 0x12, 0x0D, 0x51, 0x33, 0x77, 0x77, 0x77, 0x55, 
+    0x01, 0x01, 0x11, 0x0E, 0x51, 0x55, 0x75, 0x37, 0x77, 0x57, 0x15, 0x01, 0x10, 0x10, 0x51, 0x55, 
+    0x55, 0x77, 0x11, 0x51, 0x55, 0x15, 0x02, 0x10, 0x08, 0x51, 0x55, 0x15, 0x11, 0x03, 0x05, 0x51, 
+    0x55, 0x01, 0x02, 0x10, 0x05, 0x51, 0x55, 0x01, 0x07, 0x03, 0x55, 0x05, 0x01, 0x10, 0x04, 0x11, 
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+const RLESprite goblin_S_Walk_rle[6] = {
+    {48, 48, 4, goblin_S_Walk_palette, {goblin_S_Walk_rle_data + 0, goblin_S_Walk_rle_data + 253}},
+    {48, 48, 4, goblin_S_Walk_palette, {goblin_S_Walk_rle_data + 506, goblin_S_Walk_rle_data + 778}},
+    {48, 48, 4, goblin_S_Walk_palette, {goblin_S_Walk_rle_data + 1050, goblin_S_Walk_rle_data + 1305}},
+    {48, 48, 4, goblin_S_Walk_palette, {goblin_S_Walk_rle_data + 1560, goblin_S_Walk_rle_data + 1799}},
+    {48, 48, 4, goblin_S_Walk_palette, {goblin_S_Walk_rle_data + 2038, goblin_S_Walk_rle_data + 2271}},
+    {48, 48, 4, goblin_S_Walk_palette, {goblin_S_Walk_rle_data + 2504, goblin_S_Walk_rle_data + 2746}},
+};
+
+// goblin_U_Walk: 6 frames of 48x48, 6 colours
+static const unsigned short int goblin_U_Walk_palette[7] = {
+    0x0000, 0x0865, 0x84A8, 0xA589, 0x4385, 0x7268, 0xB2C8, 
+};
+static const unsigned char goblin_U_Walk_rle_data[2946] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
+    0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 
+    0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 0x0C, 0x21, 
+    0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 0x33, 0x33, 0x14, 0x01, 0x14, 0x08, 
+    0x31, 0x33, 0x33, 0x13, 0x02, 0x14, 0x08, 0x21, 0x33, 0x33, 0x12, 0x02, 0x03, 0x11, 0x01, 0x01, 
+    0x13, 0x0F, 0x21, 0x22, 0x22, 0x22, 0x12, 0x51, 0x55, 0x01, 0x01, 0x12, 0x10, 0x31, 0x23, 0x22, 
+    0x22, 0x32, 0x13, 0x55, 0x15, 0x01, 0x11, 0x11, 0x31, 0x33, 0x33, 0x22, 0x33, 0x33, 0x52, 0x55, 
+    0x01, 0x01, 0x10, 0x12, 0x21, 0x33, 0x33, 0x23, 0x32, 0x33, 0x22, 0x52, 0x15, 0x01, 0x10, 0x12, 
+    0x21, 0x22, 0x33, 0x33, 0x33, 0x33, 0x22, 0x52, 0x15, 0x01, 0x0F, 0x12, 0x21, 0x22, 0x32, 0x33, 
+    0x33, 0x33, 0x23, 0x42, 0x14, 0x01, 0x0F, 0x12, 0x21, 0x22, 0x25, 0x33, 0x22, 0x33, 0x52, 0x44, 
+    0x14, 0x01, 0x0F, 0x12, 0x31, 0x23, 0x55, 0x22, 0x22, 0x22, 0x55, 0x44, 0x12, 0x01, 0x0F, 0x12, 
+    0x31, 0x13, 0x55, 0x66, 0x65, 0x66, 0x55, 0x51, 0x12, 0x01, 0x0F, 0x12, 0x11, 0x11, 0x52, 0x66, 
+    0x66, 0x66, 0x25, 0x11, 0x11, 0x01, 0x12, 0x0C, 0x21, 0x62, 0x56, 0x66, 0x26, 0x12, 0x01, 0x12, 
+    0x0C, 0x41, 0x64, 0x56, 0x66, 0x36, 0x13, 0x01, 0x13, 0x0B, 0x41, 0x14, 0x11, 0x31, 0x33, 0x01, 
+    0x02, 0x14, 0x02, 0x11, 0x03, 0x05, 0x31, 0x33, 0x01, 0x01, 0x19, 0x05, 0x31, 0x33, 0x01, 0x01, 
+    0x1B, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 
+    0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x21, 0x01, 
+    0x01, 0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x34, 0x33, 0x33, 
+    0x43, 0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 0x33, 0x33, 0x14, 0x01, 0x14, 0x08, 0x31, 0x33, 0x33, 
+    0x13, 0x02, 0x0F, 0x03, 0x11, 0x01, 0x02, 0x08, 0x21, 0x33, 0x33, 0x12, 0x01, 0x0E, 0x0F, 0x51, 
+    0x55, 0x11, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x0E, 0x10, 0x51, 0x55, 0x31, 0x23, 0x22, 0x22, 
+    0x32, 0x13, 0x01, 0x0E, 0x11, 0x51, 0x55, 0x32, 0x33, 0x23, 0x32, 0x33, 0x33, 0x01, 0x01, 0x0E, 
+    0x12, 0x51, 0x25, 0x22, 0x33, 0x23, 0x32, 0x33, 0x33, 0x12, 0x01, 0x0E, 0x12, 0x51, 0x25, 0x22, 
+    0x33, 0x33, 0x33, 0x33, 0x22, 0x12, 0x01, 0x0F, 0x12, 0x41, 0x24, 0x32, 0x33, 0x33, 0x33, 0x23, 
+    0x22, 0x12, 0x01, 0x0F, 0x12, 0x41, 0x44, 0x25, 0x33, 0x22, 0x33, 0x52, 0x22, 0x12, 0x01, 0x0F, 
+    0x12, 0x21, 0x44, 0x55, 0x22, 0x22, 0x22, 0x55, 0x32, 0x13, 0x01, 0x0F, 0x12, 0x21, 0x15, 0x55, 
+    0x66, 0x56, 0x66, 0x55, 0x31, 0x13, 0x01, 0x0F, 0x12, 0x11, 0x11, 0x52, 0x66, 0x66, 0x66, 0x25, 
+    0x11, 0x11, 0x01, 0x12, 0x0C, 0x21, 0x62, 0x66, 0x65, 0x26, 0x12, 0x01, 0x12, 0x0C, 0x31, 0x63, 
+    0x66, 0x65, 0x46, 0x14, 0x01, 0x12, 0x0B, 0x31, 0x33, 0x11, 0x11, 0x44, 0x01, 0x02, 0x12, 0x05, 
+    0x31, 0x33, 0x01, 0x03, 0x02, 0x11, 0x01, 0x12, 0x05, 0x31, 0x33, 0x01, 0x01, 0x13, 0x02, 0x33, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 
+    0x12, 0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 0x21, 
+    0x12, 0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 0x13, 
+    0x0A, 0x41, 0x33, 0x33, 0x33, 0x14, 0x02, 0x14, 0x08, 0x31, 0x33, 0x33, 0x13, 0x01, 0x03, 0x11, 
+    0x01, 0x01, 0x14, 0x0D, 0x21, 0x33, 0x33, 0x12, 0x51, 0x55, 0x01, 0x01, 0x13, 0x0E, 0x21, 0x22, 
+    0x22, 0x22, 0x12, 0x55, 0x15, 0x01, 0x12, 0x0F, 0x31, 0x23, 0x22, 0x22, 0x32, 0x53, 0x55, 0x01, 
+    0x01, 0x11, 0x10, 0x31, 0x33, 0x33, 0x22, 0x33, 0x33, 0x52, 0x15, 0x01, 0x10, 0x11, 0x21, 0x33, 
+    0x33, 0x23, 0x32, 0x33, 0x22, 0x54, 0x01, 0x01, 0x10, 0x11, 0x21, 0x22, 0x33, 0x33, 0x33, 0x33, 
+    0x42, 0x54, 0x01, 0x01, 0x0F, 0x11, 0x21, 0x22, 0x32, 0x33, 0x33, 0x33, 0x23, 0x44, 0x01, 0x01, 
+    0x0F, 0x11, 0x31, 0x23, 0x25, 0x33, 0x22, 0x33, 0x52, 0x44, 0x01, 0x01, 0x0F, 0x11, 0x31, 0x23, 
+    0x55, 0x22, 0x22, 0x22, 0x55, 0x44, 0x01, 0x01, 0x0F, 0x11, 0x11, 0x11, 0x55, 0x66, 0x65, 0x66, 
+    0x55, 0x11, 0x01, 0x01, 0x12, 0x0C, 0x41, 0x65, 0x66, 0x66, 0x26, 0x12, 0x01, 0x12, 0x0D, 0x41, 
+    0x64, 0x56, 0x66, 0x32, 0x33, 0x01, 0x01, 0x13, 0x0C, 0x41, 0x66, 0x65, 0x26, 0x33, 0x13, 0x01, 
+    0x13, 0x0C, 0x41, 0x44, 0x11, 0x11, 0x33, 0x13, 0x02, 0x14, 0x02, 0x44, 0x04, 0x05, 0x31, 0x33, 
+    0x01, 0x01, 0x1B, 0x04, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 0x11, 
+    0x01, 0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 0x0C, 
+    0x21, 0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 0x33, 0x33, 0x14, 0x02, 0x10, 
+    0x03, 0x11, 0x01, 0x01, 0x08, 0x31, 0x33, 0x33, 0x13, 0x01, 0x0F, 0x0D, 0x51, 0x55, 0x11, 0x32, 
+    0x33, 0x23, 0x01, 0x01, 0x0F, 0x0E, 0x51, 0x55, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x0F, 0x0F, 
+    0x51, 0x55, 0x33, 0x22, 0x22, 0x22, 0x33, 0x01, 0x01, 0x0F, 0x10, 0x51, 0x25, 0x33, 0x33, 0x22, 
+    0x33, 0x33, 0x13, 0x01, 0x0F, 0x11, 0x51, 0x24, 0x32, 0x33, 0x22, 0x33, 0x33, 0x23, 0x01, 0x01, 
+    0x0F, 0x11, 0x51, 0x44, 0x32, 0x33, 0x33, 0x33, 0x23, 0x22, 0x01, 0x01, 0x10, 0x11, 0x41, 0x24, 
+    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x01, 0x01, 0x10, 0x11, 0x41, 0x54, 0x32, 0x23, 0x32, 0x23, 
+    0x25, 0x33, 0x01, 0x01, 0x10, 0x11, 0x41, 0x54, 0x25, 0x22, 0x22, 0x52, 0x25, 0x33, 0x01, 0x01, 
+    0x10, 0x11, 0x11, 0x51, 0x65, 0x66, 0x65, 0x56, 0x15, 0x11, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x62, 
+    0x66, 0x66, 0x56, 0x14, 0x01, 0x11, 0x0D, 0x31, 0x33, 0x62, 0x56, 0x66, 0x44, 0x01, 0x01, 0x11, 
+    0x0C, 0x31, 0x33, 0x62, 0x56, 0x66, 0x14, 0x01, 0x11, 0x0C, 0x31, 0x33, 0x11, 0x11, 0x44, 0x14, 
+    0x02, 0x11, 0x05, 0x31, 0x33, 0x01, 0x04, 0x02, 0x44, 0x01, 0x11, 0x04, 0x11, 0x11, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 
+    0x03, 0x12, 0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 
+    0x21, 0x12, 0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 
+    0x13, 0x0A, 0x41, 0x33, 0x33, 0x33, 0x14, 0x01, 0x14, 0x08, 0x31, 0x33, 0x33, 0x13, 0x02, 0x14, 
+    0x08, 0x21, 0x33, 0x33, 0x12, 0x02, 0x03, 0x11, 0x01, 0x01, 0x13, 0x0F, 0x21, 0x22, 0x22, 0x22, 
+    0x12, 0x51, 0x55, 0x01, 0x01, 0x12, 0x10, 0x31, 0x23, 0x22, 0x22, 0x32, 0x13, 0x55, 0x15, 0x01, 
+    0x11, 0x11, 0x31, 0x33, 0x33, 0x22, 0x33, 0x33, 0x52, 0x55, 0x01, 0x01, 0x10, 0x12, 0x21, 0x33, 
+    0x33, 0x23, 0x32, 0x33, 0x22, 0x52, 0x15, 0x01, 0x10, 0x12, 0x21, 0x22, 0x33, 0x33, 0x33, 0x33, 
+    0x22, 0x52, 0x15, 0x01, 0x0F, 0x12, 0x21, 0x22, 0x32, 0x33, 0x33, 0x33, 0x23, 0x42, 0x14, 0x01, 
+    0x0F, 0x12, 0x21, 0x22, 0x25, 0x33, 0x22, 0x33, 0x52, 0x44, 0x14, 0x01, 0x0F, 0x12, 0x31, 0x23, 
+    0x55, 0x22, 0x22, 0x22, 0x55, 0x44, 0x12, 0x01, 0x0F, 0x12, 0x31, 0x13, 0x55, 0x66, 0x65, 0x66, 
+    0x55, 0x51, 0x12, 0x01, 0x0F, 0x12, 0x11, 0x11, 0x52, 0x66, 0x66, 0x66, 0x25, 0x11, 0x11, 0x01, 
+    0x12, 0x0C, 0x21, 0x62, 0x56, 0x66, 0x26, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x62, 0x56, 0x66, 0x26, 
+    0x12, 0x01, 0x12, 0x0C, 0x21, 0x22, 0x11, 0x11, 0x22, 0x12, 0x02, 0x12, 0x05, 0x21, 0x22, 0x01, 
+    0x03, 0x03, 0x11, 0x01, 0x01, 0x13, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 0x01, 0x01, 0x04, 
+    0x11, 0x11, 0x01, 0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 0x21, 0x12, 0x01, 
+    0x12, 0x0C, 0x21, 0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 0x33, 0x33, 0x14, 
+    0x01, 0x14, 0x08, 0x31, 0x33, 0x33, 0x13, 0x02, 0x0F, 0x03, 0x11, 0x01, 0x02, 0x08, 0x21, 0x33, 
+    0x33, 0x12, 0x01, 0x0E, 0x0F, 0x51, 0x55, 0x11, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x0E, 0x10, 
+    0x51, 0x55, 0x31, 0x23, 0x22, 0x22, 0x32, 0x13, 0x01, 0x0E, 0x11, 0x51, 0x55, 0x32, 0x33, 0x23, 
+    0x32, 0x33, 0x33, 0x01, 0x01, 0x0E, 0x12, 0x51, 0x25, 0x22, 0x33, 0x23, 0x32, 0x33, 0x33, 0x12, 
+    0x01, 0x0E, 0x12, 0x51, 0x25, 0x22, 0x33, 0x33, 0x33, 0x33, 0x22, 0x12, 0x01, 0x0F, 0x12, 0x41, 
+    0x24, 0x32, 0x33, 0x33, 0x33, 0x23, 0x22, 0x12, 0x01, 0x0F, 0x12, 0x41, 0x44, 0x25, 0x33, 0x22, 
+    0x33, 0x52, 0x22, 0x12, 0x01, 0x0F, 0x12, 0x21, 0x44, 0x55, 0x22, 0x22, 0x22, 0x55, 0x32, 0x13, 
+    0x01, 0x0F, 0x12, 0x21, 0x15, 0x55, 0x66, 0x56, 0x66, 0x55, 0x31, 0x13, 0x01, 0x0F, 0x12, 0x11, 
+    0x11, 0x52, 0x66, 0x66, 0x66, 0x25, 0x11, 0x11, 0x01, 0x12, 0x0C, 0x21, 0x62, 0x66, 0x65, 0x26, 
+    0x12, 0x01, 0x12, 0x0C, 0x21, 0x62, 0x66, 0x65, 0x26, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x22, 0x11, 
+    0x11, 0x22, 0x12, 0x02, 0x13, 0x03, 0x11, 0x01, 0x03, 0x05, 0x21, 0x22, 0x01, 0x01, 0x1B, 0x02, 
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 
+    0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x21, 0x01, 0x01, 
+    0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x34, 0x33, 0x33, 0x43, 
+    0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 0x33, 0x33, 0x14, 0x01, 0x14, 0x08, 0x31, 0x33, 0x33, 0x13, 
+    0x01, 0x14, 0x08, 0x21, 0x33, 0x33, 0x12, 0x01, 0x13, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 
+    0x12, 0x0F, 0x31, 0x23, 0x22, 0x22, 0x32, 0x13, 0x11, 0x01, 0x01, 0x11, 0x11, 0x21, 0x33, 0x33, 
+    0x22, 0x33, 0x33, 0x53, 0x55, 0x01, 0x01, 0x11, 0x11, 0x21, 0x32, 0x33, 0x22, 0x33, 0x33, 0x23, 
+    0x55, 0x01, 0x01, 0x10, 0x12, 0x21, 0x22, 0x33, 0x33, 0x33, 0x33, 0x22, 0x52, 0x15, 0x01, 0x10, 
+    0x12, 0x21, 0x22, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x15, 0x01, 0x10, 0x11, 0x41, 0x52, 0x32, 
+    0x23, 0x32, 0x23, 0x25, 0x22, 0x01, 0x01, 0x10, 0x11, 0x41, 0x54, 0x25, 0x22, 0x22, 0x52, 0x25, 
+    0x35, 0x01, 0x01, 0x10, 0x11, 0x41, 0x54, 0x65, 0x56, 0x66, 0x56, 0x15, 0x35, 0x01, 0x01, 0x10, 
+    0x11, 0x11, 0x21, 0x65, 0x66, 0x66, 0x56, 0x12, 0x11, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x62, 0x56, 
+    0x66, 0x26, 0x12, 0x01, 0x12, 0x0C, 0x31, 0x63, 0x56, 0x66, 0x46, 0x14, 0x01, 0x12, 0x0B, 0x31, 
+    0x33, 0x11, 0x11, 0x44, 0x01, 0x02, 0x12, 0x05, 0x31, 0x33, 0x01, 0x03, 0x02, 0x11, 0x01, 0x12, 
+    0x05, 0x31, 0x33, 0x01, 0x01, 0x13, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 
+    0x11, 0x01, 0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 
+    0x0C, 0x21, 0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 0x33, 0x33, 0x14, 0x01, 
+    0x14, 0x08, 0x31, 0x33, 0x33, 0x13, 0x01, 0x14, 0x08, 0x21, 0x33, 0x33, 0x12, 0x01, 0x13, 0x0A, 
+    0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x0F, 0x0F, 0x11, 0x11, 0x33, 0x22, 0x22, 0x22, 0x33, 0x01, 
+    0x01, 0x0E, 0x11, 0x51, 0x55, 0x33, 0x33, 0x23, 0x32, 0x33, 0x23, 0x01, 0x01, 0x0E, 0x11, 0x51, 
+    0x25, 0x33, 0x33, 0x23, 0x32, 0x33, 0x22, 0x01, 0x01, 0x0E, 0x12, 0x51, 0x25, 0x22, 0x33, 0x33, 
+    0x33, 0x33, 0x22, 0x12, 0x01, 0x0E, 0x12, 0x51, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x22, 0x12, 
+    0x01, 0x0F, 0x11, 0x21, 0x22, 0x25, 0x33, 0x22, 0x33, 0x52, 0x42, 0x01, 0x01, 0x0F, 0x11, 0x31, 
+    0x25, 0x55, 0x22, 0x22, 0x22, 0x55, 0x44, 0x01, 0x01, 0x0F, 0x11, 0x31, 0x15, 0x55, 0x66, 0x56, 
+    0x66, 0x55, 0x44, 0x01, 0x01, 0x0F, 0x11, 0x11, 0x11, 0x52, 0x66, 0x66, 0x66, 0x25, 0x11, 0x01, 
+    0x01, 0x12, 0x0C, 0x21, 0x62, 0x66, 0x65, 0x26, 0x12, 0x01, 0x12, 0x0C, 0x41, 0x64, 0x66, 0x65, 
+    0x36, 0x13, 0x01, 0x13, 0x0B, 0x41, 0x14, 0x11, 0x31, 0x33, 0x01, 0x02, 0x14, 0x02, 0x11, 0x03, 
+    0x05, 0x31, 0x33, 0x01, 0x01, 0x19, 0x05, 0x31, 0x33, 0x01, 0x01, 0x1B, 0x02, 0x33, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 
+    0x21, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x12, 0x33, 
+    0x33, 0x21, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 0x13, 0x0A, 0x41, 
+    0x33, 0x33, 0x33, 0x14, 0x01, 0x14, 0x08, 0x31, 0x33, 0x33, 0x13, 0x01, 0x14, 0x08, 0x21, 0x33, 
+    0x33, 0x12, 0x01, 0x13, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x12, 0x0C, 0x31, 0x23, 0x22, 
+    0x22, 0x32, 0x13, 0x01, 0x11, 0x0E, 0x21, 0x33, 0x33, 0x22, 0x33, 0x33, 0x13, 0x01, 0x11, 0x10, 
+    0x21, 0x32, 0x33, 0x22, 0x33, 0x33, 0x23, 0x11, 0x01, 0x10, 0x12, 0x41, 0x22, 0x33, 0x33, 0x33, 
+    0x33, 0x22, 0x22, 0x15, 0x01, 0x10, 0x12, 0x41, 0x24, 0x33, 0x33, 0x33, 0x33, 0x22, 0x32, 0x13, 
+    0x01, 0x10, 0x12, 0x41, 0x54, 0x32, 0x23, 0x32, 0x23, 0x15, 0x53, 0x13, 0x01, 0x10, 0x12, 0x41, 
+    0x54, 0x25, 0x22, 0x22, 0x52, 0x15, 0x55, 0x13, 0x01, 0x10, 0x11, 0x11, 0x51, 0x65, 0x56, 0x66, 
+    0x56, 0x15, 0x11, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x62, 0x66, 0x66, 0x56, 0x14, 0x01, 0x11, 0x0D, 
+    0x31, 0x33, 0x62, 0x65, 0x66, 0x44, 0x01, 0x01, 0x11, 0x0C, 0x31, 0x33, 0x62, 0x65, 0x66, 0x14, 
+    0x01, 0x11, 0x0C, 0x31, 0x33, 0x11, 0x11, 0x44, 0x14, 0x02, 0x11, 0x05, 0x31, 0x33, 0x01, 0x04, 
+    0x02, 0x44, 0x01, 0x11, 0x04, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 
+    0x11, 0x01, 0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 
+    0x0C, 0x21, 0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 0x33, 0x33, 0x14, 0x01, 
+    0x14, 0x08, 0x31, 0x33, 0x33, 0x13, 0x01, 0x14, 0x08, 0x21, 0x33, 0x33, 0x12, 0x01, 0x13, 0x0A, 
+    0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x12, 0x0C, 0x31, 0x23, 0x22, 0x22, 0x32, 0x13, 0x01, 0x11, 
+    0x0E, 0x31, 0x33, 0x33, 0x22, 0x33, 0x33, 0x12, 0x01, 0x0F, 0x10, 0x11, 0x32, 0x33, 0x33, 0x22, 
+    0x33, 0x23, 0x12, 0x01, 0x0E, 0x12, 0x51, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x22, 0x14, 0x01, 
+    0x0E, 0x12, 0x31, 0x23, 0x22, 0x33, 0x33, 0x33, 0x33, 0x42, 0x14, 0x01, 0x0E, 0x12, 0x31, 0x35, 
+    0x51, 0x32, 0x23, 0x32, 0x23, 0x45, 0x14, 0x01, 0x0E, 0x12, 0x31, 0x55, 0x51, 0x25, 0x22, 0x22, 
+    0x52, 0x45, 0x14, 0x01, 0x0F, 0x11, 0x11, 0x11, 0x55, 0x66, 0x56, 0x66, 0x55, 0x11, 0x01, 0x01, 
+    0x12, 0x0C, 0x41, 0x65, 0x66, 0x66, 0x26, 0x12, 0x01, 0x12, 0x0D, 0x41, 0x64, 0x66, 0x65, 0x32, 
+    0x33, 0x01, 0x01, 0x13, 0x0C, 0x41, 0x66, 0x56, 0x26, 0x33, 0x13, 0x01, 0x13, 0x0C, 0x41, 0x44, 
+    0x11, 0x11, 0x33, 0x13, 0x02, 0x14, 0x02, 0x44, 0x04, 0x05, 0x31, 0x33, 0x01, 0x01, 0x1B, 0x04, 
+    0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 
+    0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x21, 
+    0x01, 0x01, 0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x34, 0x33, 
+    0x33, 0x43, 0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 0x33, 0x33, 0x14, 0x01, 0x14, 0x08, 0x31, 0x33, 
+    0x33, 0x13, 0x01, 0x14, 0x08, 0x21, 0x33, 0x33, 0x12, 0x01, 0x13, 0x0A, 0x21, 0x22, 0x22, 0x22, 
+    0x12, 0x01, 0x12, 0x0F, 0x31, 0x23, 0x22, 0x22, 0x32, 0x13, 0x11, 0x01, 0x01, 0x11, 0x11, 0x21, 
+    0x33, 0x33, 0x22, 0x33, 0x33, 0x53, 0x55, 0x01, 0x01, 0x11, 0x11, 0x21, 0x32, 0x33, 0x22, 0x33, 
+    0x33, 0x23, 0x55, 0x01, 0x01, 0x10, 0x12, 0x21, 0x22, 0x33, 0x33, 0x33, 0x33, 0x22, 0x52, 0x15, 
+    0x01, 0x10, 0x12, 0x21, 0x22, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x15, 0x01, 0x10, 0x11, 0x41, 
+    0x52, 0x32, 0x23, 0x32, 0x23, 0x25, 0x22, 0x01, 0x01, 0x10, 0x11, 0x41, 0x54, 0x25, 0x22, 0x22, 
+    0x52, 0x25, 0x35, 0x01, 0x01, 0x10, 0x11, 0x41, 0x54, 0x65, 0x56, 0x66, 0x56, 0x15, 0x35, 0x01, 
+    0x01, 0x10, 0x11, 0x11, 0x21, 0x65, 0x66, 0x66, 0x56, 0x12, 0x11, 0x01, 0x01, 0x12, 0x0C, 0x21, 
+    0x62, 0x56, 0x66, 0x26, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x62, 0x56, 0x66, 0x26, 0x12, 0x01, 0x12, 
+    0x0C, 0x21, 0x22, 0x11, 0x11, 0x22, 0x12, 0x02, 0x13, 0x03, 0x11, 0x01, 0x03, 0x05, 0x21, 0x22, 
+    0x01, 0x01, 0x1B, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
+    0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x21, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 
+    0x03, 0x21, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x12, 0x33, 0x33, 0x21, 0x12, 0x01, 0x12, 0x0C, 0x21, 
+    0x34, 0x33, 0x33, 0x43, 0x12, 0x01, 0x13, 0x0A, 0x41, 0x33, 0x33, 0x33, 0x14, 0x01, 0x14, 0x08, 
+    0x31, 0x33, 0x33, 0x13, 0x01, 0x14, 0x08, 0x21, 0x33, 0x33, 0x12, 0x01, 0x13, 0x0A, 0x21, 0x22, 
+    0x22, 0x22, 0x12, 0x01, 0x0F, 0x0F, 0x11, 0x11, 0x33, 0x22, 0x22, 0x22, 0x33, 0x01, 0x01, 0x0E, 
+    0x11, 0x51, 0x55, 0x33, 0x33, 0x23, 0x32, 0x33, 0x23, 0x01, 0x01, 0x0E, 0x11, 0x51, 0x25, 0x33, 
+    0x33, 0x23, 0x32, 0x33, 0x22, 0x01, 0x01, 0x0E, 0x12, 0x51, 0x25, 0x22, 0x33, 0x33, 0x33, 0x33, 
+    0x22, 0x12, 0x01, 0x0E, 0x12, 0x51, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x22, 0x12, 0x01, 0x0F, 
+    0x11, 0x21, 0x22, 0x25, 0x33, 0x22, 0x33, 0x52, 0x42, 0x01, 0x01, 0x0F, 0x11, 0x31, 0x25, 0x55, 
+    0x22, 0x22, 0x22, 0x55, 0x44, 0x01, 0x01, 0x0F, 0x11, 0x31, 0x15, 0x55, 0x66, 0x56, 0x66, 0x55, 
+    0x44, 0x01, 0x01, 0x0F, 0x11, 0x11, 0x11, 0x52, 0x66, 0x66, 0x66, 0x25, 0x11, 0x01, 0x01, 0x12, 
+    0x0C, 0x21, 0x62, 0x66, 0x65, 0x26, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x62, 0x66, 0x65, 0x26, 0x12, 
+    0x01, 0x12, 0x0C, 0x21, 0x22, 0x11, 0x11, 0x22, 0x12, 0x02, 0x12, 0x05, 0x21, 0x22, 0x01, 0x03, 
+    0x03, 0x11, 0x01, 0x01, 0x13, 0x02, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 
+};
+const RLESprite goblin_U_Walk_rle[6] = {
+    {48, 48, 4, goblin_U_Walk_palette, {goblin_U_Walk_rle_data + 0, goblin_U_Walk_rle_data + 253}},
+    {48, 48, 4, goblin_U_Walk_palette, {goblin_U_Walk_rle_data + 506, goblin_U_Walk_rle_data + 754}},
+    {48, 48, 4, goblin_U_Walk_palette, {goblin_U_Walk_rle_data + 1002, goblin_U_Walk_rle_data + 1251}},
+    {48, 48, 4, goblin_U_Walk_palette, {goblin_U_Walk_rle_data + 1500, goblin_U_Walk_rle_data + 1746}},
+    {48, 48, 4, goblin_U_Walk_palette, {goblin_U_Walk_rle_data + 1992, goblin_U_Walk_rle_data + 2227}},
+    {48, 48, 4, goblin_U_Walk_palette, {goblin_U_Walk_rle_data + 2462, goblin_U_Walk_rle_data + 2704}},
+};
+
+// goblin_U_Attack: 6 frames of 48x48, 6 colours
+static const unsigned short int goblin_U_Attack_palette[7] = {
+    0x0000, 0x0865, 0x7268, 0x84A8, 0xA589, 0x4385, 0xB2C8, 
+};
+static const unsigned char goblin_U_Attack_rle_data[3090] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x31, 0x01, 0x01, 0x04, 0x11, 0x11, 
+    0x01, 0x03, 0x31, 0x01, 0x01, 0x12, 0x0C, 0x31, 0x13, 0x44, 0x44, 0x31, 0x13, 0x01, 0x12, 0x0C, 
+    0x31, 0x45, 0x44, 0x44, 0x54, 0x13, 0x01, 0x13, 0x0A, 0x51, 0x44, 0x44, 0x44, 0x15, 0x01, 0x14, 
+    0x08, 0x41, 0x44, 0x44, 0x14, 0x01, 0x14, 0x08, 0x31, 0x44, 0x44, 0x13, 0x01, 0x13, 0x0A, 0x31, 
+    0x33, 0x33, 0x33, 0x13, 0x02, 0x12, 0x0C, 0x41, 0x34, 0x33, 0x33, 0x43, 0x14, 0x02, 0x03, 0x11, 
+    0x01, 0x01, 0x11, 0x13, 0x41, 0x44, 0x44, 0x33, 0x44, 0x44, 0x14, 0x21, 0x22, 0x01, 0x01, 0x10, 
+    0x14, 0x31, 0x44, 0x44, 0x34, 0x43, 0x44, 0x44, 0x13, 0x22, 0x12, 0x01, 0x10, 0x14, 0x31, 0x33, 
+    0x44, 0x44, 0x44, 0x44, 0x33, 0x23, 0x22, 0x12, 0x01, 0x0F, 0x14, 0x31, 0x33, 0x43, 0x44, 0x44, 
+    0x44, 0x34, 0x33, 0x22, 0x12, 0x01, 0x0F, 0x13, 0x31, 0x33, 0x32, 0x44, 0x33, 0x44, 0x23, 0x33, 
+    0x23, 0x01, 0x01, 0x0F, 0x12, 0x41, 0x34, 0x22, 0x33, 0x33, 0x33, 0x22, 0x43, 0x14, 0x01, 0x0F, 
+    0x12, 0x41, 0x14, 0x22, 0x66, 0x62, 0x66, 0x22, 0x41, 0x14, 0x01, 0x0F, 0x12, 0x11, 0x11, 0x23, 
+    0x66, 0x66, 0x66, 0x32, 0x11, 0x11, 0x01, 0x12, 0x0C, 0x31, 0x63, 0x26, 0x66, 0x36, 0x13, 0x01, 
+    0x12, 0x0C, 0x31, 0x63, 0x26, 0x66, 0x36, 0x13, 0x01, 0x12, 0x0C, 0x31, 0x33, 0x11, 0x11, 0x33, 
+    0x13, 0x02, 0x12, 0x05, 0x31, 0x33, 0x01, 0x02, 0x05, 0x31, 0x33, 0x01, 0x02, 0x13, 0x02, 0x33, 
+    0x06, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 
+    0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x31, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x31, 
+    0x01, 0x01, 0x12, 0x0C, 0x31, 0x13, 0x44, 0x44, 0x31, 0x13, 0x01, 0x12, 0x0C, 0x31, 0x45, 0x44, 
+    0x44, 0x54, 0x13, 0x01, 0x13, 0x0A, 0x51, 0x44, 0x44, 0x44, 0x15, 0x01, 0x14, 0x08, 0x41, 0x44, 
+    0x44, 0x14, 0x01, 0x14, 0x08, 0x31, 0x44, 0x44, 0x13, 0x01, 0x13, 0x0A, 0x31, 0x33, 0x33, 0x33, 
+    0x13, 0x02, 0x0D, 0x03, 0x11, 0x01, 0x02, 0x0C, 0x41, 0x34, 0x33, 0x33, 0x43, 0x14, 0x01, 0x0C, 
+    0x13, 0x21, 0x22, 0x11, 0x44, 0x44, 0x34, 0x43, 0x44, 0x44, 0x01, 0x01, 0x0C, 0x14, 0x21, 0x22, 
+    0x31, 0x44, 0x44, 0x34, 0x43, 0x44, 0x44, 0x13, 0x01, 0x0C, 0x14, 0x21, 0x22, 0x32, 0x33, 0x44, 
+    0x44, 0x44, 0x44, 0x33, 0x13, 0x01, 0x0D, 0x14, 0x21, 0x22, 0x33, 0x43, 0x44, 0x44, 0x44, 0x34, 
+    0x33, 0x13, 0x01, 0x0E, 0x13, 0x21, 0x33, 0x23, 0x43, 0x34, 0x43, 0x34, 0x32, 0x33, 0x01, 0x01, 
+    0x0F, 0x12, 0x41, 0x34, 0x22, 0x33, 0x33, 0x33, 0x22, 0x43, 0x14, 0x01, 0x0F, 0x12, 0x41, 0x14, 
+    0x22, 0x66, 0x26, 0x66, 0x22, 0x41, 0x14, 0x01, 0x0F, 0x12, 0x11, 0x11, 0x23, 0x66, 0x66, 0x66, 
+    0x32, 0x11, 0x11, 0x01, 0x12, 0x0C, 0x31, 0x63, 0x66, 0x62, 0x36, 0x13, 0x01, 0x12, 0x0C, 0x31, 
+    0x63, 0x66, 0x62, 0x36, 0x13, 0x01, 0x12, 0x0C, 0x31, 0x33, 0x11, 0x11, 0x33, 0x13, 0x02, 0x12, 
+    0x05, 0x31, 0x33, 0x01, 0x02, 0x05, 0x31, 0x33, 0x01, 0x02, 0x13, 0x02, 0x33, 0x06, 0x02, 0x33, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1C, 0x02, 0x11, 0x01, 0x03, 0x11, 
+    0x01, 0x03, 0x12, 0x02, 0x11, 0x02, 0x04, 0x11, 0x11, 0x01, 0x08, 0x31, 0x11, 0x22, 0x12, 0x01, 
+    0x12, 0x12, 0x31, 0x11, 0x44, 0x44, 0x31, 0x13, 0x21, 0x22, 0x12, 0x01, 0x12, 0x12, 0x31, 0x43, 
+    0x44, 0x44, 0x54, 0x13, 0x21, 0x22, 0x12, 0x02, 0x12, 0x0B, 0x31, 0x45, 0x44, 0x44, 0x54, 0x01, 
+    0x01, 0x06, 0x21, 0x22, 0x12, 0x02, 0x13, 0x09, 0x51, 0x44, 0x44, 0x44, 0x01, 0x02, 0x06, 0x21, 
+    0x22, 0x12, 0x02, 0x14, 0x08, 0x31, 0x44, 0x44, 0x13, 0x02, 0x05, 0x21, 0x22, 0x01, 0x02, 0x14, 
+    0x09, 0x31, 0x33, 0x33, 0x33, 0x01, 0x01, 0x05, 0x21, 0x22, 0x01, 0x01, 0x13, 0x10, 0x31, 0x33, 
+    0x33, 0x33, 0x44, 0x11, 0x22, 0x12, 0x01, 0x12, 0x11, 0x41, 0x34, 0x33, 0x43, 0x44, 0x44, 0x33, 
+    0x12, 0x01, 0x01, 0x11, 0x12, 0x31, 0x44, 0x44, 0x33, 0x44, 0x44, 0x34, 0x44, 0x14, 0x01, 0x10, 
+    0x13, 0x51, 0x33, 0x44, 0x34, 0x44, 0x44, 0x33, 0x43, 0x44, 0x01, 0x01, 0x10, 0x12, 0x51, 0x35, 
+    0x44, 0x44, 0x44, 0x44, 0x13, 0x21, 0x12, 0x02, 0x10, 0x0E, 0x51, 0x35, 0x44, 0x44, 0x43, 0x34, 
+    0x12, 0x01, 0x03, 0x11, 0x01, 0x01, 0x11, 0x0D, 0x51, 0x32, 0x44, 0x33, 0x33, 0x22, 0x01, 0x01, 
+    0x11, 0x0D, 0x51, 0x22, 0x33, 0x63, 0x66, 0x22, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x62, 0x26, 0x66, 
+    0x26, 0x15, 0x01, 0x12, 0x0C, 0x31, 0x62, 0x66, 0x66, 0x56, 0x15, 0x01, 0x12, 0x0C, 0x31, 0x63, 
+    0x26, 0x66, 0x56, 0x15, 0x01, 0x12, 0x0C, 0x31, 0x63, 0x16, 0x11, 0x55, 0x15, 0x02, 0x12, 0x05, 
+    0x31, 0x33, 0x01, 0x03, 0x04, 0x11, 0x11, 0x01, 0x12, 0x05, 0x31, 0x33, 0x01, 0x01, 0x13, 0x02, 
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0E, 0x03, 0x11, 0x01, 0x01, 
+    0x02, 0x11, 0x03, 0x0D, 0x08, 0x21, 0x22, 0x11, 0x13, 0x01, 0x04, 0x11, 0x11, 0x02, 0x02, 0x11, 
+    0x01, 0x0C, 0x12, 0x21, 0x22, 0x12, 0x31, 0x13, 0x44, 0x44, 0x11, 0x13, 0x01, 0x0C, 0x12, 0x21, 
+    0x22, 0x12, 0x31, 0x45, 0x44, 0x44, 0x34, 0x13, 0x02, 0x0C, 0x06, 0x21, 0x22, 0x12, 0x01, 0x0B, 
+    0x51, 0x44, 0x44, 0x44, 0x35, 0x01, 0x02, 0x0C, 0x06, 0x21, 0x22, 0x12, 0x02, 0x09, 0x41, 0x44, 
+    0x44, 0x54, 0x01, 0x02, 0x0D, 0x05, 0x21, 0x22, 0x01, 0x02, 0x08, 0x31, 0x44, 0x44, 0x13, 0x02, 
+    0x0D, 0x05, 0x21, 0x22, 0x01, 0x01, 0x09, 0x31, 0x33, 0x33, 0x33, 0x01, 0x01, 0x0D, 0x10, 0x21, 
+    0x22, 0x11, 0x44, 0x33, 0x33, 0x33, 0x13, 0x01, 0x0D, 0x11, 0x11, 0x32, 0x43, 0x44, 0x44, 0x33, 
+    0x33, 0x44, 0x01, 0x01, 0x0D, 0x12, 0x41, 0x44, 0x43, 0x44, 0x44, 0x33, 0x44, 0x44, 0x13, 0x01, 
+    0x0D, 0x13, 0x41, 0x44, 0x33, 0x43, 0x44, 0x34, 0x44, 0x34, 0x53, 0x01, 0x01, 0x0E, 0x12, 0x21, 
+    0x12, 0x31, 0x44, 0x44, 0x44, 0x44, 0x53, 0x15, 0x02, 0x0E, 0x03, 0x11, 0x01, 0x01, 0x0E, 0x21, 
+    0x43, 0x34, 0x44, 0x44, 0x53, 0x15, 0x01, 0x12, 0x0D, 0x21, 0x32, 0x33, 0x43, 0x34, 0x52, 0x01, 
+    0x01, 0x12, 0x0D, 0x21, 0x62, 0x66, 0x33, 0x23, 0x52, 0x01, 0x01, 0x12, 0x0C, 0x51, 0x62, 0x66, 
+    0x62, 0x26, 0x12, 0x01, 0x12, 0x0C, 0x51, 0x65, 0x66, 0x66, 0x26, 0x13, 0x01, 0x12, 0x0C, 0x51, 
+    0x65, 0x66, 0x62, 0x36, 0x13, 0x01, 0x12, 0x0C, 0x51, 0x55, 0x11, 0x61, 0x36, 0x13, 0x02, 0x12, 
+    0x04, 0x11, 0x11, 0x03, 0x05, 0x31, 0x33, 0x01, 0x01, 0x19, 0x05, 0x31, 0x33, 0x01, 0x01, 0x1B, 
+    0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1A, 0x03, 0x11, 0x01, 0x01, 0x19, 0x05, 0x21, 
+    0x22, 0x01, 0x01, 0x18, 0x06, 0x21, 0x22, 0x12, 0x01, 0x18, 0x07, 0x21, 0x22, 0x22, 0x01, 0x01, 
+    0x19, 0x06, 0x21, 0x22, 0x12, 0x02, 0x12, 0x02, 0x11, 0x02, 0x0A, 0x11, 0x11, 0x21, 0x22, 0x12, 
+    0x01, 0x12, 0x0E, 0x31, 0x11, 0x44, 0x44, 0x31, 0x22, 0x12, 0x01, 0x12, 0x0F, 0x31, 0x43, 0x44, 
+    0x44, 0x54, 0x22, 0x44, 0x01, 0x01, 0x12, 0x0F, 0x31, 0x45, 0x44, 0x44, 0x54, 0x21, 0x44, 0x01, 
+    0x01, 0x13, 0x0F, 0x51, 0x44, 0x44, 0x44, 0x11, 0x43, 0x24, 0x01, 0x01, 0x14, 0x0E, 0x31, 0x44, 
+    0x44, 0x13, 0x31, 0x33, 0x12, 0x01, 0x14, 0x0E, 0x31, 0x33, 0x33, 0x33, 0x44, 0x23, 0x12, 0x01, 
+    0x13, 0x0E, 0x31, 0x33, 0x33, 0x33, 0x44, 0x34, 0x11, 0x01, 0x12, 0x0E, 0x41, 0x34, 0x33, 0x43, 
+    0x44, 0x34, 0x13, 0x01, 0x11, 0x0E, 0x31, 0x44, 0x44, 0x33, 0x44, 0x34, 0x13, 0x01, 0x11, 0x0D, 
+    0x31, 0x43, 0x44, 0x43, 0x44, 0x34, 0x01, 0x01, 0x11, 0x0D, 0x51, 0x43, 0x44, 0x44, 0x44, 0x34, 
+    0x01, 0x01, 0x11, 0x0D, 0x51, 0x43, 0x44, 0x34, 0x44, 0x23, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x43, 
+    0x34, 0x33, 0x23, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x32, 0x33, 0x66, 0x26, 0x12, 0x01, 0x12, 0x0D, 
+    0x21, 0x62, 0x26, 0x66, 0x26, 0x55, 0x01, 0x01, 0x12, 0x0D, 0x31, 0x62, 0x66, 0x66, 0x56, 0x55, 
+    0x01, 0x01, 0x12, 0x0D, 0x31, 0x63, 0x26, 0x66, 0x56, 0x55, 0x01, 0x01, 0x12, 0x0D, 0x31, 0x63, 
+    0x16, 0x11, 0x11, 0x11, 0x01, 0x01, 0x12, 0x05, 0x31, 0x33, 0x01, 0x01, 0x12, 0x05, 0x31, 0x33, 
+    0x01, 0x01, 0x13, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x03, 0x11, 0x01, 0x01, 
+    0x12, 0x05, 0x21, 0x22, 0x01, 0x01, 0x12, 0x06, 0x21, 0x22, 0x12, 0x01, 0x11, 0x07, 0x21, 0x22, 
+    0x22, 0x01, 0x01, 0x11, 0x06, 0x21, 0x22, 0x12, 0x02, 0x10, 0x0A, 0x21, 0x22, 0x12, 0x11, 0x11, 
+    0x02, 0x02, 0x11, 0x01, 0x10, 0x0E, 0x21, 0x22, 0x13, 0x44, 0x44, 0x11, 0x13, 0x01, 0x0F, 0x0F, 
+    0x41, 0x24, 0x52, 0x44, 0x44, 0x44, 0x33, 0x01, 0x01, 0x0F, 0x0F, 0x41, 0x24, 0x51, 0x44, 0x44, 
+    0x44, 0x35, 0x01, 0x01, 0x0E, 0x0F, 0x21, 0x44, 0x13, 0x41, 0x44, 0x44, 0x54, 0x01, 0x01, 0x0E, 
+    0x0E, 0x21, 0x33, 0x13, 0x31, 0x44, 0x44, 0x13, 0x01, 0x0E, 0x0E, 0x21, 0x32, 0x44, 0x33, 0x33, 
+    0x33, 0x13, 0x01, 0x0F, 0x0E, 0x11, 0x43, 0x44, 0x33, 0x33, 0x33, 0x13, 0x01, 0x10, 0x0E, 0x31, 
+    0x43, 0x44, 0x34, 0x33, 0x43, 0x14, 0x01, 0x11, 0x0E, 0x31, 0x43, 0x44, 0x33, 0x44, 0x44, 0x13, 
+    0x01, 0x12, 0x0D, 0x31, 0x44, 0x44, 0x43, 0x44, 0x33, 0x01, 0x01, 0x12, 0x0D, 0x31, 0x44, 0x44, 
+    0x44, 0x44, 0x53, 0x01, 0x01, 0x12, 0x0D, 0x21, 0x43, 0x34, 0x44, 0x44, 0x53, 0x01, 0x01, 0x12, 
+    0x0C, 0x21, 0x32, 0x33, 0x43, 0x34, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x62, 0x66, 0x33, 0x23, 0x12, 
+    0x01, 0x11, 0x0D, 0x51, 0x25, 0x66, 0x26, 0x66, 0x22, 0x01, 0x01, 0x11, 0x0D, 0x51, 0x55, 0x66, 
+    0x66, 0x66, 0x32, 0x01, 0x01, 0x11, 0x0D, 0x51, 0x55, 0x66, 0x26, 0x66, 0x33, 0x01, 0x01, 0x11, 
+    0x0D, 0x11, 0x11, 0x11, 0x11, 0x66, 0x33, 0x01, 0x01, 0x19, 0x05, 0x31, 0x33, 0x01, 0x01, 0x19, 
+    0x05, 0x31, 0x33, 0x01, 0x01, 0x1B, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 
+    0x03, 0x11, 0x01, 0x01, 0x17, 0x05, 0x21, 0x22, 0x01, 0x01, 0x17, 0x06, 0x21, 0x22, 0x12, 0x01, 
+    0x17, 0x07, 0x21, 0x22, 0x22, 0x01, 0x02, 0x12, 0x02, 0x11, 0x02, 0x0A, 0x11, 0x21, 0x22, 0x22, 
+    0x11, 0x01, 0x12, 0x0F, 0x31, 0x11, 0x44, 0x44, 0x22, 0x22, 0x44, 0x01, 0x01, 0x12, 0x0F, 0x31, 
+    0x43, 0x44, 0x44, 0x54, 0x22, 0x44, 0x01, 0x01, 0x12, 0x10, 0x31, 0x45, 0x44, 0x44, 0x54, 0x31, 
+    0x44, 0x12, 0x01, 0x13, 0x0F, 0x51, 0x44, 0x44, 0x44, 0x11, 0x33, 0x23, 0x01, 0x01, 0x14, 0x0D, 
+    0x31, 0x44, 0x44, 0x13, 0x31, 0x13, 0x01, 0x01, 0x14, 0x0C, 0x31, 0x33, 0x33, 0x33, 0x44, 0x13, 
+    0x01, 0x13, 0x0D, 0x31, 0x33, 0x33, 0x33, 0x44, 0x34, 0x01, 0x01, 0x12, 0x0D, 0x41, 0x34, 0x33, 
+    0x43, 0x44, 0x34, 0x01, 0x01, 0x11, 0x0E, 0x31, 0x44, 0x44, 0x33, 0x44, 0x34, 0x13, 0x01, 0x11, 
+    0x0D, 0x31, 0x43, 0x44, 0x43, 0x44, 0x34, 0x01, 0x01, 0x11, 0x0D, 0x51, 0x43, 0x44, 0x44, 0x44, 
+    0x34, 0x01, 0x01, 0x11, 0x0D, 0x51, 0x43, 0x44, 0x34, 0x44, 0x23, 0x01, 0x01, 0x12, 0x0C, 0x21, 
+    0x43, 0x34, 0x33, 0x23, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x32, 0x33, 0x66, 0x26, 0x12, 0x01, 0x12, 
+    0x0D, 0x21, 0x62, 0x26, 0x66, 0x56, 0x55, 0x01, 0x01, 0x12, 0x0D, 0x31, 0x62, 0x66, 0x66, 0x56, 
+    0x55, 0x01, 0x01, 0x12, 0x0D, 0x31, 0x63, 0x26, 0x66, 0x56, 0x55, 0x01, 0x01, 0x12, 0x0D, 0x31, 
+    0x63, 0x16, 0x11, 0x11, 0x11, 0x01, 0x01, 0x12, 0x05, 0x31, 0x33, 0x01, 0x01, 0x12, 0x05, 0x31, 
+    0x33, 0x01, 0x01, 0x13, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 0x03, 0x11, 
+    0x01, 0x01, 0x14, 0x05, 0x21, 0x22, 0x01, 0x01, 0x13, 0x06, 0x21, 0x22, 0x12, 0x01, 0x12, 0x07, 
+    0x21, 0x22, 0x22, 0x01, 0x02, 0x10, 0x0A, 0x11, 0x22, 0x22, 0x12, 0x11, 0x02, 0x02, 0x11, 0x01, 
+    0x0F, 0x0F, 0x41, 0x24, 0x22, 0x42, 0x44, 0x14, 0x31, 0x01, 0x01, 0x0F, 0x0F, 0x41, 0x24, 0x52, 
+    0x44, 0x44, 0x44, 0x33, 0x01, 0x01, 0x0E, 0x10, 0x21, 0x44, 0x13, 0x45, 0x44, 0x44, 0x54, 0x13, 
+    0x01, 0x0E, 0x0F, 0x21, 0x33, 0x13, 0x41, 0x44, 0x44, 0x54, 0x01, 0x01, 0x0F, 0x0D, 0x11, 0x33, 
+    0x11, 0x43, 0x44, 0x34, 0x01, 0x01, 0x10, 0x0C, 0x31, 0x44, 0x33, 0x33, 0x33, 0x13, 0x01, 0x10, 
+    0x0D, 0x31, 0x44, 0x34, 0x33, 0x33, 0x33, 0x01, 0x01, 0x11, 0x0D, 0x31, 0x44, 0x44, 0x33, 0x33, 
+    0x44, 0x01, 0x01, 0x11, 0x0E, 0x31, 0x43, 0x44, 0x33, 0x44, 0x44, 0x13, 0x01, 0x12, 0x0D, 0x31, 
+    0x44, 0x44, 0x43, 0x44, 0x33, 0x01, 0x01, 0x12, 0x0D, 0x31, 0x44, 0x44, 0x44, 0x44, 0x53, 0x01, 
+    0x01, 0x12, 0x0D, 0x21, 0x43, 0x34, 0x44, 0x44, 0x53, 0x01, 0x01, 0x12, 0x0C, 0x21, 0x32, 0x33, 
+    0x43, 0x34, 0x12, 0x01, 0x12, 0x0C, 0x21, 0x62, 0x66, 0x33, 0x23, 0x12, 0x01, 0x11, 0x0D, 0x51, 
+    0x55, 0x66, 0x26, 0x66, 0x22, 0x01, 0x01, 0x11, 0x0D, 0x51, 0x55, 0x66, 0x66, 0x66, 0x32, 0x01, 
+    0x01, 0x11, 0x0D, 0x51, 0x55, 0x66, 0x26, 0x66, 0x33, 0x01, 0x01, 0x11, 0x0D, 0x11, 0x11, 0x11, 
+    0x11, 0x66, 0x33, 0x01, 0x01, 0x19, 0x05, 0x31, 0x33, 0x01, 0x01, 0x19, 0x05, 0x31, 0x33, 0x01, 
+    0x01, 0x1B, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
+    0x12, 0x02, 0x11, 0x08, 0x02, 0x21, 0x03, 0x12, 0x03, 0x31, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 
+    0x04, 0x31, 0x22, 0x01, 0x12, 0x0D, 0x31, 0x13, 0x44, 0x44, 0x31, 0x23, 0x02, 0x01, 0x12, 0x0D, 
+    0x31, 0x45, 0x44, 0x44, 0x54, 0x23, 0x02, 0x01, 0x13, 0x0C, 0x51, 0x44, 0x44, 0x44, 0x15, 0x22, 
+    0x02, 0x14, 0x08, 0x41, 0x44, 0x44, 0x14, 0x01, 0x03, 0x22, 0x02, 0x02, 0x14, 0x08, 0x31, 0x44, 
+    0x44, 0x13, 0x01, 0x03, 0x22, 0x02, 0x01, 0x12, 0x0E, 0x11, 0x33, 0x33, 0x33, 0x33, 0x21, 0x22, 
+    0x01, 0x11, 0x0F, 0x31, 0x44, 0x33, 0x33, 0x33, 0x44, 0x33, 0x02, 0x01, 0x10, 0x10, 0x41, 0x44, 
+    0x44, 0x34, 0x43, 0x44, 0x44, 0x23, 0x01, 0x0F, 0x11, 0x31, 0x44, 0x43, 0x44, 0x33, 0x44, 0x44, 
+    0x34, 0x02, 0x01, 0x0F, 0x11, 0x31, 0x33, 0x43, 0x44, 0x44, 0x44, 0x34, 0x23, 0x02, 0x01, 0x0E, 
+    0x12, 0x31, 0x33, 0x21, 0x44, 0x44, 0x44, 0x34, 0x22, 0x22, 0x01, 0x0E, 0x12, 0x41, 0x34, 0x21, 
+    0x42, 0x34, 0x43, 0x24, 0x22, 0x22, 0x01, 0x0E, 0x12, 0x41, 0x14, 0x21, 0x62, 0x26, 0x66, 0x26, 
+    0x22, 0x22, 0x02, 0x0E, 0x03, 0x11, 0x01, 0x01, 0x0E, 0x31, 0x62, 0x66, 0x66, 0x26, 0x23, 0x12, 
+    0x01, 0x12, 0x0E, 0x31, 0x63, 0x26, 0x66, 0x36, 0x23, 0x12, 0x01, 0x12, 0x0E, 0x31, 0x63, 0x26, 
+    0x66, 0x36, 0x23, 0x12, 0x01, 0x12, 0x0D, 0x31, 0x33, 0x11, 0x11, 0x33, 0x23, 0x01, 0x02, 0x12, 
+    0x05, 0x31, 0x33, 0x01, 0x02, 0x05, 0x31, 0x33, 0x01, 0x02, 0x13, 0x02, 0x33, 0x06, 0x02, 0x33, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x12, 0x08, 
+    0x02, 0x11, 0x03, 0x11, 0x04, 0x22, 0x13, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x31, 0x01, 0x01, 
+    0x11, 0x0D, 0x22, 0x33, 0x41, 0x44, 0x14, 0x33, 0x01, 0x01, 0x11, 0x0D, 0x22, 0x53, 0x44, 0x44, 
+    0x44, 0x35, 0x01, 0x01, 0x11, 0x0C, 0x22, 0x51, 0x44, 0x44, 0x44, 0x15, 0x02, 0x10, 0x03, 0x22, 
+    0x02, 0x01, 0x08, 0x41, 0x44, 0x44, 0x14, 0x02, 0x10, 0x03, 0x22, 0x02, 0x01, 0x08, 0x31, 0x44, 
+    0x44, 0x13, 0x01, 0x10, 0x0E, 0x22, 0x12, 0x33, 0x33, 0x33, 0x33, 0x11, 0x01, 0x10, 0x0F, 0x32, 
+    0x43, 0x34, 0x33, 0x33, 0x43, 0x34, 0x01, 0x01, 0x10, 0x10, 0x32, 0x44, 0x44, 0x34, 0x43, 0x44, 
+    0x44, 0x14, 0x01, 0x10, 0x11, 0x32, 0x44, 0x44, 0x34, 0x43, 0x44, 0x43, 0x34, 0x01, 0x01, 0x10, 
+    0x11, 0x22, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x01, 0x01, 0x10, 0x12, 0x22, 0x22, 0x43, 
+    0x44, 0x44, 0x44, 0x12, 0x33, 0x13, 0x01, 0x10, 0x12, 0x22, 0x22, 0x42, 0x34, 0x43, 0x24, 0x12, 
+    0x43, 0x14, 0x01, 0x10, 0x12, 0x22, 0x22, 0x62, 0x66, 0x62, 0x26, 0x12, 0x41, 0x14, 0x02, 0x10, 
+    0x0E, 0x21, 0x32, 0x62, 0x66, 0x66, 0x26, 0x13, 0x01, 0x03, 0x11, 0x01, 0x01, 0x10, 0x0E, 0x21, 
+    0x32, 0x63, 0x66, 0x62, 0x36, 0x13, 0x01, 0x10, 0x0E, 0x21, 0x32, 0x63, 0x66, 0x62, 0x36, 0x13, 
+    0x01, 0x11, 0x0D, 0x21, 0x33, 0x13, 0x11, 0x31, 0x33, 0x01, 0x02, 0x12, 0x05, 0x31, 0x33, 0x01, 
+    0x02, 0x05, 0x31, 0x33, 0x01, 0x02, 0x13, 0x02, 0x33, 0x06, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 
+    0x31, 0x01, 0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x31, 0x01, 0x01, 0x12, 0x0C, 0x31, 0x13, 0x44, 
+    0x44, 0x31, 0x13, 0x01, 0x12, 0x0C, 0x31, 0x45, 0x44, 0x44, 0x54, 0x13, 0x01, 0x13, 0x0A, 0x51, 
+    0x44, 0x44, 0x44, 0x15, 0x01, 0x14, 0x08, 0x41, 0x44, 0x44, 0x14, 0x01, 0x14, 0x08, 0x31, 0x44, 
+    0x44, 0x13, 0x01, 0x13, 0x0A, 0x31, 0x33, 0x33, 0x33, 0x13, 0x01, 0x12, 0x0C, 0x41, 0x34, 0x33, 
+    0x33, 0x43, 0x14, 0x01, 0x11, 0x0E, 0x41, 0x44, 0x44, 0x33, 0x44, 0x44, 0x14, 0x01, 0x10, 0x0F, 
+    0x31, 0x44, 0x44, 0x34, 0x43, 0x44, 0x44, 0x01, 0x01, 0x10, 0x10, 0x31, 0x33, 0x44, 0x44, 0x44, 
+    0x44, 0x33, 0x13, 0x01, 0x0F, 0x11, 0x31, 0x33, 0x43, 0x44, 0x44, 0x44, 0x34, 0x33, 0x01, 0x01, 
+    0x0F, 0x11, 0x31, 0x33, 0x32, 0x44, 0x33, 0x44, 0x23, 0x33, 0x01, 0x01, 0x0F, 0x11, 0x41, 0x34, 
+    0x22, 0x33, 0x33, 0x33, 0x22, 0x44, 0x01, 0x01, 0x0F, 0x12, 0x41, 0x14, 0x22, 0x66, 0x62, 0x66, 
+    0x22, 0x44, 0x12, 0x01, 0x0F, 0x13, 0x11, 0x11, 0x23, 0x66, 0x66, 0x66, 0x32, 0x22, 0x22, 0x01, 
+    0x01, 0x12, 0x11, 0x31, 0x63, 0x26, 0x66, 0x36, 0x23, 0x22, 0x22, 0x01, 0x01, 0x12, 0x11, 0x31, 
+    0x63, 0x26, 0x66, 0x36, 0x13, 0x22, 0x22, 0x01, 0x01, 0x12, 0x11, 0x31, 0x33, 0x11, 0x11, 0x33, 
+    0x13, 0x21, 0x22, 0x01, 0x03, 0x12, 0x05, 0x31, 0x33, 0x01, 0x02, 0x05, 0x31, 0x33, 0x01, 0x01, 
+    0x03, 0x11, 0x01, 0x02, 0x13, 0x02, 0x33, 0x06, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x12, 0x02, 0x11, 0x08, 0x02, 0x11, 0x03, 0x12, 0x03, 0x31, 0x01, 
+    0x01, 0x04, 0x11, 0x11, 0x01, 0x03, 0x31, 0x01, 0x01, 0x12, 0x0C, 0x31, 0x13, 0x44, 0x44, 0x31, 
+    0x13, 0x01, 0x12, 0x0C, 0x31, 0x45, 0x44, 0x44, 0x54, 0x13, 0x01, 0x13, 0x0A, 0x51, 0x44, 0x44, 
+    0x44, 0x15, 0x01, 0x14, 0x08, 0x41, 0x44, 0x44, 0x14, 0x01, 0x14, 0x08, 0x31, 0x44, 0x44, 0x13, 
+    0x01, 0x13, 0x0A, 0x31, 0x33, 0x33, 0x33, 0x13, 0x01, 0x12, 0x0C, 0x41, 0x34, 0x33, 0x33, 0x43, 
+    0x14, 0x01, 0x11, 0x0E, 0x41, 0x44, 0x44, 0x33, 0x44, 0x44, 0x14, 0x01, 0x11, 0x0F, 0x41, 0x44, 
+    0x44, 0x33, 0x44, 0x44, 0x34, 0x01, 0x01, 0x10, 0x10, 0x31, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 
+    0x13, 0x01, 0x10, 0x11, 0x31, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x01, 0x01, 0x10, 0x11, 
+    0x31, 0x23, 0x43, 0x34, 0x43, 0x34, 0x32, 0x33, 0x01, 0x01, 0x10, 0x11, 0x41, 0x24, 0x32, 0x33, 
+    0x33, 0x23, 0x32, 0x44, 0x01, 0x01, 0x0F, 0x12, 0x21, 0x44, 0x22, 0x66, 0x26, 0x66, 0x22, 0x41, 
+    0x14, 0x01, 0x0E, 0x13, 0x21, 0x22, 0x32, 0x62, 0x66, 0x66, 0x26, 0x13, 0x11, 0x01, 0x01, 0x0D, 
+    0x11, 0x21, 0x22, 0x22, 0x33, 0x66, 0x26, 0x66, 0x33, 0x01, 0x01, 0x0D, 0x11, 0x21, 0x22, 0x12, 
+    0x33, 0x66, 0x26, 0x66, 0x33, 0x01, 0x01, 0x0D, 0x11, 0x21, 0x22, 0x11, 0x33, 0x13, 0x11, 0x31, 
+    0x33, 0x01, 0x03, 0x0E, 0x03, 0x11, 0x01, 0x01, 0x05, 0x31, 0x33, 0x01, 0x02, 0x05, 0x31, 0x33, 
+    0x01, 0x02, 0x13, 0x02, 0x33, 0x06, 0x02, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 
+};
+const RLESprite goblin_U_Attack_rle[6] = {
+    {48, 48, 4, goblin_U_Attack_palette, {goblin_U_Attack_rle_data + 0, goblin_U_Attack_rle_data + 253}},
+    {48, 48, 4, goblin_U_Attack_palette, {goblin_U_Attack_rle_data + 506, goblin_U_Attack_rle_data + 779}},
+    {48, 48, 4, goblin_U_Attack_palette, {goblin_U_Attack_rle_data + 1052, goblin_U_Attack_rle_data + 1311}},
+    {48, 48, 4, goblin_U_Attack_palette, {goblin_U_Attack_rle_data + 1570, goblin_U_Attack_rle_data + 1824}},
+    {48, 48, 4, goblin_U_Attack_palette, {goblin_U_Attack_rle_data + 2078, goblin_U_Attack_rle_data + 2330}},
+    {48, 48, 4, goblin_U_Attack_palette, {goblin_U_Attack_rle_data + 2582, goblin_U_Attack_rle_data + 2836}},
+};
+
+// goblin_Death: 6 frames of 48x48, 7 colours
+static const unsigned short int goblin_Death_palette[8] = {
+    0x0000, 0x0865, 0x4385, 0xA589, 0x84A8, 0x7268, 0xFF17, 0xB2C8, 
+};
+static const unsigned char goblin_Death_rle_data[2568] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 
+    0x02, 0x11, 0x01, 0x14, 0x03, 0x21, 0x01, 0x02, 0x14, 0x06, 0x21, 0x11, 0x11, 0x02, 0x02, 0x11, 
+    0x01, 0x14, 0x0A, 0x21, 0x33, 0x33, 0x11, 0x14, 0x01, 0x14, 0x0A, 0x31, 0x33, 0x33, 0x43, 0x14, 
+    0x01, 0x14, 0x0A, 0x31, 0x33, 0x33, 0x23, 0x14, 0x02, 0x0B, 0x04, 0x11, 0x11, 0x05, 0x09, 0x41, 
+    0x33, 0x33, 0x24, 0x01, 0x02, 0x0A, 0x06, 0x51, 0x55, 0x15, 0x03, 0x09, 0x41, 0x34, 0x43, 0x44, 
+    0x01, 0x02, 0x0A, 0x07, 0x51, 0x55, 0x55, 0x01, 0x01, 0x0B, 0x41, 0x64, 0x47, 0x44, 0x44, 0x01, 
+    0x01, 0x0A, 0x14, 0x51, 0x55, 0x55, 0x15, 0x41, 0x44, 0x67, 0x44, 0x34, 0x13, 0x01, 0x0B, 0x14, 
+    0x11, 0x55, 0x55, 0x25, 0x44, 0x33, 0x44, 0x34, 0x33, 0x13, 0x01, 0x0D, 0x12, 0x11, 0x55, 0x55, 
+    0x34, 0x33, 0x33, 0x33, 0x33, 0x13, 0x01, 0x0F, 0x10, 0x11, 0x22, 0x34, 0x33, 0x33, 0x33, 0x43, 
+    0x14, 0x01, 0x11, 0x0E, 0x11, 0x44, 0x33, 0x33, 0x33, 0x43, 0x14, 0x01, 0x12, 0x0D, 0x51, 0x44, 
+    0x33, 0x33, 0x43, 0x44, 0x01, 0x01, 0x12, 0x0D, 0x51, 0x77, 0x47, 0x44, 0x44, 0x33, 0x01, 0x01, 
+    0x12, 0x0D, 0x51, 0x77, 0x57, 0x77, 0x55, 0x33, 0x01, 0x01, 0x12, 0x0D, 0x41, 0x77, 0x77, 0x77, 
+    0x55, 0x15, 0x01, 0x01, 0x12, 0x0C, 0x41, 0x77, 0x57, 0x77, 0x44, 0x14, 0x01, 0x12, 0x0C, 0x41, 
+    0x44, 0x11, 0x77, 0x44, 0x14, 0x02, 0x12, 0x05, 0x41, 0x44, 0x01, 0x01, 0x06, 0x11, 0x44, 0x14, 
+    0x02, 0x13, 0x02, 0x44, 0x04, 0x05, 0x41, 0x44, 0x01, 0x01, 0x19, 0x04, 0x41, 0x44, 0x01, 0x1A, 
+    0x02, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1A, 0x02, 0x11, 0x01, 0x19, 
+    0x03, 0x21, 0x01, 0x02, 0x12, 0x02, 0x11, 0x02, 0x06, 0x11, 0x11, 0x12, 0x01, 0x12, 0x0A, 0x41, 
+    0x11, 0x33, 0x33, 0x12, 0x01, 0x12, 0x0A, 0x41, 0x34, 0x33, 0x33, 0x13, 0x01, 0x12, 0x0A, 0x41, 
+    0x32, 0x33, 0x33, 0x13, 0x02, 0x13, 0x09, 0x21, 0x34, 0x33, 0x43, 0x01, 0x05, 0x04, 0x11, 0x11, 
+    0x02, 0x14, 0x09, 0x41, 0x44, 0x33, 0x44, 0x01, 0x03, 0x06, 0x51, 0x55, 0x15, 0x02, 0x13, 0x0B, 
+    0x41, 0x44, 0x44, 0x67, 0x44, 0x01, 0x01, 0x07, 0x51, 0x55, 0x55, 0x01, 0x01, 0x12, 0x14, 0x31, 
+    0x43, 0x44, 0x76, 0x44, 0x14, 0x51, 0x55, 0x55, 0x15, 0x01, 0x11, 0x14, 0x31, 0x33, 0x43, 0x44, 
+    0x33, 0x44, 0x52, 0x55, 0x55, 0x11, 0x01, 0x11, 0x12, 0x31, 0x33, 0x33, 0x33, 0x33, 0x43, 0x55, 
+    0x55, 0x11, 0x01, 0x11, 0x10, 0x41, 0x34, 0x33, 0x33, 0x33, 0x43, 0x22, 0x11, 0x01, 0x11, 0x0E, 
+    0x41, 0x34, 0x33, 0x33, 0x33, 0x44, 0x11, 0x01, 0x11, 0x0D, 0x41, 0x44, 0x33, 0x33, 0x43, 0x54, 
+    0x01, 0x01, 0x11, 0x0D, 0x31, 0x43, 0x44, 0x44, 0x77, 0x57, 0x01, 0x01, 0x11, 0x0D, 0x31, 0x53, 
+    0x75, 0x57, 0x77, 0x57, 0x01, 0x01, 0x11, 0x0D, 0x11, 0x55, 0x75, 0x77, 0x77, 0x47, 0x01, 0x01, 
+    0x12, 0x0C, 0x41, 0x44, 0x77, 0x75, 0x77, 0x14, 0x01, 0x12, 0x0C, 0x41, 0x44, 0x77, 0x11, 0x44, 
+    0x14, 0x02, 0x12, 0x06, 0x41, 0x44, 0x11, 0x01, 0x05, 0x41, 0x44, 0x01, 0x02, 0x12, 0x05, 0x41, 
+    0x44, 0x01, 0x04, 0x02, 0x44, 0x01, 0x13, 0x04, 0x44, 0x14, 0x01, 0x14, 0x02, 0x44, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x15, 0x02, 0x11, 0x01, 0x15, 0x03, 0x21, 0x01, 0x02, 
+    0x15, 0x06, 0x21, 0x11, 0x11, 0x02, 0x02, 0x11, 0x02, 0x0D, 0x03, 0x11, 0x01, 0x05, 0x0A, 0x21, 
+    0x33, 0x33, 0x11, 0x14, 0x02, 0x0C, 0x05, 0x51, 0x55, 0x01, 0x04, 0x0A, 0x31, 0x33, 0x33, 0x43, 
+    0x14, 0x02, 0x0C, 0x05, 0x51, 0x55, 0x01, 0x04, 0x0A, 0x31, 0x33, 0x33, 0x23, 0x14, 0x02, 0x0C, 
+    0x05, 0x51, 0x55, 0x01, 0x04, 0x09, 0x41, 0x33, 0x33, 0x24, 0x01, 0x02, 0x0C, 0x05, 0x51, 0x55, 
+    0x01, 0x03, 0x09, 0x41, 0x36, 0x43, 0x44, 0x01, 0x01, 0x0D, 0x11, 0x51, 0x55, 0x11, 0x41, 0x64, 
+    0x77, 0x46, 0x44, 0x01, 0x01, 0x0D, 0x12, 0x51, 0x55, 0x44, 0x42, 0x44, 0x77, 0x46, 0x33, 0x13, 
+    0x01, 0x0E, 0x12, 0x41, 0x45, 0x24, 0x44, 0x33, 0x44, 0x33, 0x33, 0x13, 0x01, 0x0E, 0x13, 0x41, 
+    0x55, 0x22, 0x34, 0x33, 0x33, 0x33, 0x33, 0x43, 0x01, 0x01, 0x0F, 0x12, 0x51, 0x15, 0x41, 0x33, 
+    0x33, 0x33, 0x33, 0x44, 0x14, 0x02, 0x10, 0x02, 0x11, 0x01, 0x0F, 0x51, 0x34, 0x33, 0x33, 0x33, 
+    0x44, 0x44, 0x01, 0x01, 0x13, 0x0F, 0x51, 0x75, 0x77, 0x33, 0x43, 0x44, 0x33, 0x01, 0x01, 0x13, 
+    0x0F, 0x51, 0x75, 0x77, 0x77, 0x55, 0x15, 0x33, 0x01, 0x01, 0x13, 0x0F, 0x41, 0x77, 0x57, 0x77, 
+    0x55, 0x15, 0x11, 0x01, 0x01, 0x12, 0x0D, 0x41, 0x74, 0x77, 0x77, 0x41, 0x44, 0x01, 0x01, 0x12, 
+    0x0D, 0x41, 0x44, 0x11, 0x77, 0x41, 0x44, 0x01, 0x02, 0x12, 0x05, 0x41, 0x44, 0x01, 0x01, 0x07, 
+    0x11, 0x44, 0x44, 0x01, 0x02, 0x12, 0x04, 0x11, 0x11, 0x03, 0x05, 0x41, 0x44, 0x01, 0x01, 0x19, 
+    0x05, 0x41, 0x44, 0x01, 0x01, 0x19, 0x04, 0x41, 0x44, 0x01, 0x1A, 0x02, 0x44, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x19, 0x02, 0x11, 0x01, 0x18, 0x03, 0x21, 0x01, 0x02, 0x11, 
+    0x02, 0x11, 0x02, 0x06, 0x11, 0x11, 0x12, 0x02, 0x11, 0x0A, 0x41, 0x11, 0x33, 0x33, 0x12, 0x05, 
+    0x03, 0x11, 0x01, 0x02, 0x11, 0x0A, 0x41, 0x34, 0x33, 0x33, 0x13, 0x04, 0x05, 0x51, 0x55, 0x01, 
+    0x02, 0x11, 0x0A, 0x41, 0x32, 0x33, 0x33, 0x13, 0x04, 0x05, 0x51, 0x55, 0x01, 0x02, 0x12, 0x09, 
+    0x21, 0x34, 0x33, 0x43, 0x01, 0x04, 0x05, 0x51, 0x55, 0x01, 0x02, 0x13, 0x09, 0x41, 0x44, 0x33, 
+    0x46, 0x01, 0x03, 0x05, 0x51, 0x55, 0x01, 0x01, 0x12, 0x11, 0x41, 0x44, 0x76, 0x67, 0x44, 0x11, 
+    0x51, 0x55, 0x01, 0x01, 0x11, 0x12, 0x31, 0x33, 0x64, 0x77, 0x44, 0x24, 0x44, 0x55, 0x15, 0x01, 
+    0x10, 0x12, 0x31, 0x33, 0x33, 0x44, 0x33, 0x44, 0x42, 0x54, 0x14, 0x01, 0x0F, 0x13, 0x41, 0x33, 
+    0x33, 0x33, 0x33, 0x33, 0x24, 0x52, 0x45, 0x01, 0x01, 0x0F, 0x12, 0x41, 0x44, 0x33, 0x33, 0x33, 
+    0x33, 0x14, 0x51, 0x15, 0x02, 0x0E, 0x0F, 0x41, 0x44, 0x34, 0x33, 0x33, 0x33, 0x54, 0x01, 0x01, 
+    0x02, 0x11, 0x01, 0x0E, 0x0F, 0x31, 0x43, 0x44, 0x33, 0x73, 0x77, 0x55, 0x01, 0x01, 0x0E, 0x0F, 
+    0x31, 0x13, 0x55, 0x75, 0x77, 0x77, 0x55, 0x01, 0x01, 0x0E, 0x0F, 0x11, 0x11, 0x55, 0x75, 0x57, 
+    0x77, 0x47, 0x01, 0x01, 0x11, 0x0D, 0x41, 0x44, 0x71, 0x77, 0x77, 0x44, 0x01, 0x01, 0x11, 0x0D, 
+    0x41, 0x44, 0x71, 0x17, 0x41, 0x44, 0x01, 0x02, 0x11, 0x07, 0x41, 0x44, 0x14, 0x01, 0x01, 0x05, 
+    0x41, 0x44, 0x01, 0x02, 0x12, 0x05, 0x41, 0x44, 0x01, 0x03, 0x04, 0x11, 0x11, 0x01, 0x12, 0x05, 
+    0x41, 0x44, 0x01, 0x01, 0x13, 0x04, 0x44, 0x14, 0x01, 0x14, 0x02, 0x44, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1E, 0x02, 0x11, 0x01, 0x1D, 0x03, 0x41, 0x01, 
+    0x02, 0x1C, 0x05, 0x41, 0x12, 0x01, 0x02, 0x02, 0x11, 0x01, 0x1C, 0x09, 0x21, 0x33, 0x13, 0x41, 
+    0x01, 0x01, 0x1C, 0x09, 0x41, 0x33, 0x33, 0x42, 0x01, 0x01, 0x19, 0x0B, 0x11, 0x41, 0x33, 0x33, 
+    0x23, 0x01, 0x02, 0x0C, 0x03, 0x11, 0x01, 0x06, 0x0E, 0x11, 0x11, 0x22, 0x64, 0x37, 0x33, 0x14, 
+    0x02, 0x0B, 0x05, 0x51, 0x55, 0x01, 0x04, 0x0F, 0x41, 0x24, 0x22, 0x44, 0x76, 0x67, 0x14, 0x01, 
+    0x02, 0x0B, 0x05, 0x51, 0x55, 0x01, 0x04, 0x0F, 0x41, 0x24, 0x42, 0x33, 0x33, 0x67, 0x44, 0x01, 
+    0x02, 0x0B, 0x05, 0x51, 0x55, 0x01, 0x04, 0x0F, 0x11, 0x11, 0x44, 0x33, 0x33, 0x33, 0x33, 0x01, 
+    0x02, 0x0C, 0x04, 0x51, 0x15, 0x07, 0x0D, 0x51, 0x34, 0x33, 0x33, 0x33, 0x33, 0x01, 0x02, 0x0C, 
+    0x05, 0x51, 0x55, 0x01, 0x05, 0x0E, 0x51, 0x75, 0x77, 0x33, 0x43, 0x33, 0x13, 0x02, 0x0D, 0x04, 
+    0x51, 0x15, 0x04, 0x0F, 0x41, 0x54, 0x77, 0x77, 0x47, 0x44, 0x44, 0x01, 0x02, 0x0D, 0x04, 0x51, 
+    0x15, 0x03, 0x11, 0x41, 0x44, 0x77, 0x57, 0x77, 0x55, 0x41, 0x44, 0x01, 0x02, 0x0E, 0x02, 0x55, 
+    0x03, 0x12, 0x41, 0x44, 0x74, 0x77, 0x77, 0x55, 0x15, 0x31, 0x13, 0x02, 0x13, 0x0D, 0x41, 0x44, 
+    0x11, 0x11, 0x77, 0x44, 0x01, 0x01, 0x04, 0x31, 0x13, 0x03, 0x13, 0x04, 0x11, 0x11, 0x03, 0x06, 
+    0x41, 0x44, 0x14, 0x02, 0x03, 0x11, 0x01, 0x01, 0x1A, 0x05, 0x41, 0x44, 0x01, 0x01, 0x19, 0x06, 
+    0x41, 0x44, 0x14, 0x01, 0x19, 0x05, 0x41, 0x44, 0x01, 0x01, 0x1A, 0x03, 0x44, 0x04, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x02, 0x11, 0x01, 0x10, 0x03, 
+    0x41, 0x01, 0x02, 0x0B, 0x02, 0x11, 0x02, 0x05, 0x11, 0x42, 0x01, 0x01, 0x0B, 0x09, 0x41, 0x11, 
+    0x33, 0x23, 0x01, 0x01, 0x0B, 0x09, 0x41, 0x32, 0x33, 0x43, 0x01, 0x01, 0x0C, 0x0B, 0x21, 0x33, 
+    0x33, 0x43, 0x11, 0x01, 0x02, 0x0D, 0x0E, 0x41, 0x33, 0x73, 0x46, 0x22, 0x11, 0x11, 0x06, 0x03, 
+    0x11, 0x01, 0x02, 0x0D, 0x0F, 0x11, 0x64, 0x77, 0x46, 0x24, 0x22, 0x44, 0x01, 0x04, 0x05, 0x51, 
+    0x55, 0x01, 0x02, 0x0D, 0x0F, 0x41, 0x64, 0x37, 0x33, 0x43, 0x22, 0x44, 0x01, 0x04, 0x05, 0x51, 
+    0x55, 0x01, 0x02, 0x0D, 0x0F, 0x31, 0x33, 0x33, 0x33, 0x43, 0x14, 0x11, 0x01, 0x04, 0x05, 0x51, 
+    0x55, 0x01, 0x02, 0x0C, 0x0D, 0x31, 0x33, 0x33, 0x33, 0x33, 0x54, 0x01, 0x07, 0x04, 0x51, 0x15, 
+    0x02, 0x0C, 0x0E, 0x31, 0x33, 0x34, 0x33, 0x77, 0x57, 0x15, 0x05, 0x05, 0x51, 0x55, 0x01, 0x02, 
+    0x0C, 0x0F, 0x41, 0x44, 0x44, 0x77, 0x77, 0x57, 0x44, 0x01, 0x04, 0x04, 0x51, 0x15, 0x02, 0x0B, 
+    0x11, 0x41, 0x44, 0x51, 0x75, 0x57, 0x77, 0x47, 0x44, 0x01, 0x03, 0x04, 0x51, 0x15, 0x02, 0x0B, 
+    0x12, 0x31, 0x13, 0x51, 0x55, 0x77, 0x77, 0x47, 0x44, 0x14, 0x03, 0x02, 0x55, 0x02, 0x0B, 0x04, 
+    0x31, 0x13, 0x01, 0x0D, 0x41, 0x74, 0x17, 0x11, 0x41, 0x44, 0x01, 0x03, 0x0B, 0x03, 0x11, 0x01, 
+    0x02, 0x06, 0x41, 0x44, 0x14, 0x03, 0x04, 0x11, 0x11, 0x01, 0x11, 0x05, 0x41, 0x44, 0x01, 0x01, 
+    0x11, 0x06, 0x41, 0x44, 0x14, 0x01, 0x12, 0x05, 0x41, 0x44, 0x01, 0x01, 0x13, 0x03, 0x44, 0x04, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x24, 0x02, 
+    0x11, 0x01, 0x23, 0x03, 0x41, 0x01, 0x01, 0x22, 0x04, 0x41, 0x11, 0x02, 0x19, 0x04, 0x11, 0x11, 
+    0x04, 0x06, 0x41, 0x33, 0x13, 0x03, 0x09, 0x03, 0x11, 0x01, 0x0D, 0x06, 0x41, 0x44, 0x11, 0x02, 
+    0x08, 0x41, 0x33, 0x33, 0x11, 0x02, 0x08, 0x05, 0x51, 0x55, 0x01, 0x0D, 0x0F, 0x44, 0x44, 0x14, 
+    0x41, 0x36, 0x33, 0x13, 0x04, 0x02, 0x08, 0x06, 0x51, 0x55, 0x15, 0x0E, 0x0C, 0x44, 0x44, 0x64, 
+    0x77, 0x33, 0x43, 0x02, 0x09, 0x05, 0x55, 0x55, 0x01, 0x0E, 0x0B, 0x41, 0x33, 0x43, 0x77, 0x46, 
+    0x04, 0x02, 0x0A, 0x05, 0x55, 0x55, 0x01, 0x0C, 0x0B, 0x41, 0x33, 0x33, 0x43, 0x46, 0x01, 0x02, 
+    0x0B, 0x05, 0x55, 0x55, 0x01, 0x0A, 0x0C, 0x51, 0x34, 0x33, 0x33, 0x33, 0x13, 0x02, 0x0C, 0x04, 
+    0x55, 0x15, 0x09, 0x0E, 0x41, 0x75, 0x34, 0x33, 0x33, 0x33, 0x14, 0x02, 0x0D, 0x03, 0x55, 0x05, 
+    0x08, 0x10, 0x41, 0x74, 0x77, 0x34, 0x33, 0x44, 0x44, 0x14, 0x03, 0x0E, 0x02, 0x55, 0x07, 0x0C, 
+    0x41, 0x74, 0x77, 0x57, 0x44, 0x44, 0x02, 0x04, 0x34, 0x13, 0x02, 0x17, 0x0B, 0x44, 0x74, 0x77, 
+    0x75, 0x57, 0x05, 0x04, 0x03, 0x33, 0x01, 0x02, 0x17, 0x03, 0x44, 0x04, 0x02, 0x05, 0x75, 0x77, 
+    0x05, 0x01, 0x1B, 0x05, 0x41, 0x47, 0x04, 0x01, 0x1A, 0x05, 0x41, 0x44, 0x04, 0x01, 0x1A, 0x04, 
+    0x44, 0x44, 0x01, 0x1A, 0x03, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x02, 0x11, 0x01, 0x0A, 0x03, 0x41, 0x01, 0x01, 0x0A, 0x04, 
+    0x11, 0x14, 0x02, 0x09, 0x06, 0x31, 0x33, 0x14, 0x04, 0x04, 0x11, 0x11, 0x03, 0x07, 0x08, 0x11, 
+    0x33, 0x33, 0x14, 0x02, 0x06, 0x11, 0x44, 0x14, 0x0D, 0x03, 0x11, 0x01, 0x02, 0x07, 0x0F, 0x14, 
+    0x33, 0x33, 0x46, 0x11, 0x44, 0x44, 0x04, 0x0D, 0x05, 0x51, 0x55, 0x01, 0x02, 0x08, 0x0C, 0x34, 
+    0x33, 0x77, 0x46, 0x44, 0x44, 0x0E, 0x06, 0x51, 0x55, 0x15, 0x02, 0x09, 0x0B, 0x44, 0x76, 0x47, 
+    0x33, 0x43, 0x01, 0x0E, 0x05, 0x51, 0x55, 0x05, 0x02, 0x0A, 0x0B, 0x41, 0x46, 0x33, 0x33, 0x43, 
+    0x01, 0x0C, 0x05, 0x51, 0x55, 0x05, 0x02, 0x0A, 0x0C, 0x31, 0x33, 0x33, 0x33, 0x43, 0x15, 0x0A, 
+    0x05, 0x51, 0x55, 0x05, 0x02, 0x09, 0x0E, 0x41, 0x33, 0x33, 0x33, 0x43, 0x57, 0x14, 0x09, 0x04, 
+    0x51, 0x55, 0x02, 0x08, 0x10, 0x41, 0x44, 0x44, 0x33, 0x43, 0x77, 0x47, 0x14, 0x08, 0x03, 0x55, 
+    0x05, 0x03, 0x07, 0x04, 0x31, 0x43, 0x02, 0x0C, 0x44, 0x44, 0x75, 0x77, 0x47, 0x14, 0x07, 0x02, 
+    0x55, 0x02, 0x07, 0x03, 0x31, 0x03, 0x04, 0x0B, 0x55, 0x77, 0x75, 0x77, 0x44, 0x04, 0x02, 0x0F, 
+    0x05, 0x75, 0x77, 0x05, 0x02, 0x03, 0x44, 0x04, 0x01, 0x10, 0x05, 0x44, 0x47, 0x01, 0x01, 0x11, 
+    0x05, 0x44, 0x44, 0x01, 0x01, 0x12, 0x04, 0x44, 0x44, 0x01, 0x13, 0x03, 0x44, 0x04, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+    0x23, 0x02, 0x33, 0x03, 0x09, 0x02, 0x55, 0x0F, 0x02, 0x44, 0x06, 0x04, 0x33, 0x33, 0x03, 0x09, 
+    0x03, 0x55, 0x05, 0x0E, 0x04, 0x44, 0x44, 0x03, 0x05, 0x34, 0x33, 0x03, 0x03, 0x09, 0x03, 0x55, 
+    0x05, 0x10, 0x02, 0x44, 0x03, 0x04, 0x77, 0x33, 0x02, 0x0A, 0x02, 0x55, 0x12, 0x06, 0x34, 0x73, 
+    0x47, 0x01, 0x1D, 0x06, 0x34, 0x33, 0x43, 0x03, 0x0D, 0x02, 0x55, 0x0D, 0x07, 0x45, 0x33, 0x33, 
+    0x03, 0x01, 0x02, 0x44, 0x03, 0x0D, 0x02, 0x55, 0x0D, 0x07, 0x77, 0x33, 0x33, 0x03, 0x01, 0x03, 
+    0x44, 0x04, 0x02, 0x1C, 0x06, 0x77, 0x35, 0x33, 0x03, 0x03, 0x34, 0x03, 0x03, 0x19, 0x01, 0x04, 
+    0x02, 0x05, 0x77, 0x77, 0x05, 0x05, 0x02, 0x33, 0x02, 0x18, 0x02, 0x44, 0x03, 0x03, 0x75, 0x07, 
+    0x02, 0x18, 0x01, 0x04, 0x04, 0x03, 0x44, 0x04, 0x01, 0x1C, 0x03, 0x44, 0x04, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x0B, 0x02, 0x33, 0x03, 0x0A, 0x04, 0x33, 0x33, 0x06, 0x02, 0x44, 0x0F, 0x02, 0x55, 0x03, 
+    0x0A, 0x05, 0x33, 0x33, 0x04, 0x03, 0x04, 0x44, 0x44, 0x0E, 0x03, 0x55, 0x05, 0x03, 0x0B, 0x04, 
+    0x33, 0x77, 0x03, 0x02, 0x44, 0x10, 0x03, 0x55, 0x05, 0x02, 0x0C, 0x06, 0x74, 0x37, 0x43, 0x12, 
+    0x02, 0x55, 0x01, 0x0D, 0x06, 0x34, 0x33, 0x43, 0x03, 0x0A, 0x02, 0x44, 0x01, 0x07, 0x33, 0x33, 
+    0x43, 0x05, 0x0D, 0x02, 0x55, 0x03, 0x09, 0x03, 0x44, 0x04, 0x01, 0x07, 0x33, 0x33, 0x73, 0x07, 
+    0x0D, 0x02, 0x55, 0x02, 0x08, 0x03, 0x33, 0x04, 0x03, 0x06, 0x33, 0x53, 0x77, 0x03, 0x08, 0x02, 
+    0x33, 0x05, 0x05, 0x75, 0x77, 0x07, 0x02, 0x01, 0x04, 0x02, 0x10, 0x03, 0x77, 0x05, 0x03, 0x02, 
+    0x44, 0x02, 0x10, 0x03, 0x44, 0x04, 0x04, 0x01, 0x04, 0x01, 0x11, 0x03, 0x44, 0x04, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x02, 0x1B, 0x01, 0x04, 0x07, 0x02, 0x33, 0x03, 0x0A, 0x01, 0x05, 0x10, 0x02, 0x44, 
+    0x05, 0x03, 0x34, 0x03, 0x03, 0x09, 0x03, 0x55, 0x05, 0x10, 0x01, 0x04, 0x06, 0x02, 0x44, 0x01, 
+    0x0A, 0x01, 0x05, 0x01, 0x1F, 0x02, 0x44, 0x01, 0x1E, 0x04, 0x34, 0x33, 0x02, 0x1D, 0x05, 0x35, 
+    0x33, 0x03, 0x04, 0x01, 0x04, 0x02, 0x1D, 0x04, 0x75, 0x37, 0x04, 0x02, 0x44, 0x01, 0x1E, 0x02, 
+    0x77, 0x01, 0x19, 0x01, 0x04, 0x01, 0x1D, 0x02, 0x44, 0x01, 0x1D, 0x01, 0x04, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x02, 0x0B, 0x02, 0x33, 0x07, 0x01, 0x04, 0x03, 0x0B, 0x03, 0x33, 0x04, 0x05, 0x02, 0x44, 
+    0x10, 0x01, 0x05, 0x03, 0x0B, 0x02, 0x44, 0x06, 0x01, 0x04, 0x10, 0x03, 0x55, 0x05, 0x01, 0x25, 
+    0x01, 0x05, 0x01, 0x0F, 0x02, 0x44, 0x01, 0x0E, 0x04, 0x33, 0x43, 0x02, 0x09, 0x01, 0x04, 0x04, 
+    0x05, 0x33, 0x33, 0x05, 0x02, 0x09, 0x02, 0x44, 0x04, 0x04, 0x73, 0x57, 0x01, 0x10, 0x02, 0x77, 
+    0x01, 0x16, 0x01, 0x04, 0x01, 0x11, 0x02, 0x44, 0x01, 0x12, 0x01, 0x04, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+};
+const RLESprite goblin_Death_rle[6] = {
+    {48, 48, 4, goblin_Death_palette, {goblin_Death_rle_data + 0, goblin_Death_rle_data + 252}},
+    {48, 48, 4, goblin_Death_palette, {goblin_Death_rle_data + 504, goblin_Death_rle_data + 775}},
+    {48, 48, 4, goblin_Death_palette, {goblin_Death_rle_data + 1046, goblin_Death_rle_data + 1304}},
+    {48, 48, 4, goblin_Death_palette, {goblin_Death_rle_data + 1562, goblin_Death_rle_data + 1793}},
+    {48, 48, 4, goblin_Death_palette, {goblin_Death_rle_data + 2024, goblin_Death_rle_data + 2185}},
+    {48, 48, 4, goblin_Death_palette, {goblin_Death_rle_data + 2346, goblin_Death_rle_data + 2457}},
+};
+
+// wizard_idle: 6 frames of 16x16, 4 colours
+static const unsigned short int wizard_idle_palette[5] = {
+    0x0000, 0x10A3, 0x910D, 0xFC24, 0x7920, 
+};
+static const unsigned char wizard_idle_rle_data[1368] = {
+    0x00, 0x01, 0x06, 0x06, 0x11, 0x11, 0x11, 0x01, 0x05, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x04, 
+    0x09, 0x21, 0x22, 0x11, 0x21, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 0x01, 0x03, 
+    0x0A, 0x21, 0x21, 0x11, 0x11, 0x12, 0x01, 0x04, 0x09, 0x11, 0x22, 0x13, 0x23, 0x01, 0x01, 0x06, 
+    0x06, 0x21, 0x12, 0x12, 0x01, 0x05, 0x08, 0x21, 0x22, 0x23, 0x12, 0x01, 0x04, 0x09, 0x21, 0x22, 
+    0x22, 0x22, 0x01, 0x01, 0x04, 0x09, 0x21, 0x22, 0x32, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 
+    0x22, 0x22, 0x12, 0x01, 0x03, 0x0A, 0x31, 0x22, 0x22, 0x22, 0x12, 0x01, 0x04, 0x09, 0x31, 0x33, 
+    0x33, 0x33, 0x01, 0x01, 0x03, 0x0A, 0x41, 0x11, 0x11, 0x11, 0x11, 0x02, 0x02, 0x04, 0x41, 0x14, 
+    0x03, 0x04, 0x41, 0x14, 0x00, 0x01, 0x04, 0x06, 0x11, 0x11, 0x11, 0x01, 0x03, 0x08, 0x21, 0x22, 
+    0x22, 0x12, 0x01, 0x03, 0x09, 0x21, 0x11, 0x21, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x11, 0x11, 
+    0x22, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x11, 0x11, 0x12, 0x12, 0x01, 0x03, 0x09, 0x21, 0x13, 0x23, 
+    0x12, 0x01, 0x01, 0x04, 0x06, 0x21, 0x21, 0x12, 0x01, 0x03, 0x08, 0x21, 0x32, 0x22, 0x12, 0x01, 
+    0x03, 0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x03, 0x09, 0x21, 0x32, 0x22, 0x22, 0x01, 0x01, 
+    0x03, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x13, 0x01, 
+    0x03, 0x09, 0x31, 0x33, 0x33, 0x33, 0x01, 0x01, 0x03, 0x0A, 0x11, 0x11, 0x11, 0x11, 0x14, 0x02, 
+    0x03, 0x04, 0x41, 0x14, 0x03, 0x04, 0x41, 0x14, 0x00, 0x01, 0x06, 0x06, 0x11, 0x11, 0x11, 0x01, 
+    0x05, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x04, 0x09, 0x21, 0x22, 0x11, 0x21, 0x01, 0x01, 0x03, 
+    0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x21, 0x31, 0x31, 0x12, 0x01, 0x04, 
+    0x09, 0x11, 0x22, 0x11, 0x21, 0x01, 0x01, 0x06, 0x06, 0x21, 0x12, 0x12, 0x01, 0x05, 0x08, 0x21, 
+    0x22, 0x23, 0x12, 0x01, 0x04, 0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x04, 0x09, 0x21, 0x22, 
+    0x32, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x03, 0x0A, 0x31, 0x22, 
+    0x22, 0x22, 0x12, 0x01, 0x04, 0x09, 0x31, 0x33, 0x33, 0x33, 0x01, 0x01, 0x03, 0x0A, 0x41, 0x11, 
+    0x11, 0x11, 0x11, 0x02, 0x02, 0x04, 0x41, 0x14, 0x03, 0x04, 0x41, 0x14, 0x00, 0x01, 0x04, 0x06, 
+    0x11, 0x11, 0x11, 0x01, 0x03, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x03, 0x09, 0x21, 0x11, 0x21, 
+    0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x11, 0x11, 0x22, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x13, 0x13, 
+    0x12, 0x12, 0x01, 0x03, 0x09, 0x21, 0x11, 0x21, 0x12, 0x01, 0x01, 0x04, 0x06, 0x21, 0x21, 0x12, 
+    0x01, 0x03, 0x08, 0x21, 0x32, 0x22, 0x12, 0x01, 0x03, 0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 
+    0x03, 0x09, 0x21, 0x32, 0x22, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 
+    0x03, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x13, 0x01, 0x03, 0x09, 0x31, 0x33, 0x33, 0x33, 0x01, 0x01, 
+    0x03, 0x0A, 0x11, 0x11, 0x11, 0x11, 0x14, 0x02, 0x03, 0x04, 0x41, 0x14, 0x03, 0x04, 0x41, 0x14, 
+    0x00, 0x00, 0x01, 0x06, 0x06, 0x11, 0x11, 0x11, 0x01, 0x05, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 
+    0x04, 0x09, 0x21, 0x22, 0x11, 0x21, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 0x01, 
+    0x03, 0x0A, 0x21, 0x21, 0x31, 0x31, 0x12, 0x01, 0x04, 0x09, 0x11, 0x22, 0x11, 0x21, 0x01, 0x01, 
+    0x05, 0x08, 0x11, 0x22, 0x21, 0x11, 0x01, 0x04, 0x09, 0x21, 0x22, 0x32, 0x22, 0x01, 0x01, 0x04, 
+    0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x22, 0x23, 0x12, 0x01, 0x03, 
+    0x0A, 0x31, 0x22, 0x22, 0x22, 0x12, 0x01, 0x04, 0x09, 0x31, 0x33, 0x33, 0x33, 0x01, 0x01, 0x03, 
+    0x0A, 0x41, 0x11, 0x11, 0x11, 0x11, 0x02, 0x02, 0x04, 0x41, 0x14, 0x03, 0x04, 0x41, 0x14, 0x00, 
+    0x00, 0x01, 0x04, 0x06, 0x11, 0x11, 0x11, 0x01, 0x03, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x03, 
+    0x09, 0x21, 0x11, 0x21, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x11, 0x11, 0x22, 0x12, 0x01, 0x03, 
+    0x0A, 0x21, 0x13, 0x13, 0x12, 0x12, 0x01, 0x03, 0x09, 0x21, 0x11, 0x21, 0x12, 0x01, 0x01, 0x03, 
+    0x08, 0x11, 0x12, 0x22, 0x11, 0x01, 0x03, 0x09, 0x21, 0x32, 0x22, 0x22, 0x01, 0x01, 0x03, 0x09, 
+    0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x32, 0x22, 0x22, 0x12, 0x01, 0x03, 0x0A, 
+    0x21, 0x22, 0x22, 0x22, 0x13, 0x01, 0x03, 0x09, 0x31, 0x33, 0x33, 0x33, 0x01, 0x01, 0x03, 0x0A, 
+    0x11, 0x11, 0x11, 0x11, 0x14, 0x02, 0x03, 0x04, 0x41, 0x14, 0x03, 0x04, 0x41, 0x14, 0x00, 0x00, 
+    0x01, 0x06, 0x06, 0x11, 0x11, 0x11, 0x01, 0x05, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x04, 0x09, 
+    0x21, 0x22, 0x11, 0x21, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 0x01, 0x03, 0x0A, 
+    0x21, 0x21, 0x31, 0x31, 0x12, 0x01, 0x04, 0x09, 0x11, 0x22, 0x11, 0x21, 0x01, 0x01, 0x05, 0x07, 
+    0x11, 0x22, 0x21, 0x01, 0x01, 0x04, 0x09, 0x21, 0x22, 0x32, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 
+    0x22, 0x22, 0x22, 0x12, 0x01, 0x03, 0x0B, 0x21, 0x22, 0x22, 0x23, 0x22, 0x01, 0x01, 0x03, 0x0B, 
+    0x31, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x04, 0x0A, 0x31, 0x33, 0x33, 0x33, 0x13, 0x01, 0x03, 
+    0x0B, 0x41, 0x11, 0x11, 0x11, 0x11, 0x01, 0x02, 0x02, 0x04, 0x41, 0x14, 0x03, 0x04, 0x41, 0x14, 
+    0x00, 0x00, 0x01, 0x04, 0x06, 0x11, 0x11, 0x11, 0x01, 0x03, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 
+    0x03, 0x09, 0x21, 0x11, 0x21, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x11, 0x11, 0x22, 0x12, 0x01, 
+    0x03, 0x0A, 0x21, 0x13, 0x13, 0x12, 0x12, 0x01, 0x03, 0x09, 0x21, 0x11, 0x21, 0x12, 0x01, 0x01, 
+    0x04, 0x07, 0x21, 0x21, 0x12, 0x01, 0x01, 0x03, 0x09, 0x21, 0x32, 0x22, 0x22, 0x01, 0x01, 0x03, 
+    0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x02, 0x0B, 0x21, 0x22, 0x23, 0x22, 0x22, 0x01, 0x01, 
+    0x02, 0x0B, 0x21, 0x22, 0x22, 0x22, 0x32, 0x01, 0x01, 0x02, 0x0A, 0x31, 0x33, 0x33, 0x33, 0x13, 
+    0x01, 0x02, 0x0B, 0x11, 0x11, 0x11, 0x11, 0x41, 0x01, 0x02, 0x03, 0x04, 0x41, 0x14, 0x03, 0x04, 
+    0x41, 0x14, 0x00, 0x00, 0x01, 0x06, 0x06, 0x11, 0x11, 0x11, 0x01, 0x05, 0x08, 0x21, 0x22, 0x22, 
+    0x12, 0x01, 0x04, 0x09, 0x21, 0x22, 0x11, 0x21, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x11, 0x11, 
+    0x12, 0x01, 0x03, 0x0A, 0x21, 0x21, 0x31, 0x31, 0x12, 0x01, 0x04, 0x09, 0x11, 0x22, 0x11, 0x21, 
+    0x01, 0x01, 0x05, 0x07, 0x11, 0x22, 0x21, 0x01, 0x01, 0x04, 0x09, 0x21, 0x22, 0x32, 0x22, 0x01, 
+    0x01, 0x03, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x03, 0x0B, 0x21, 0x22, 0x22, 0x23, 0x22, 
+    0x01, 0x01, 0x03, 0x0B, 0x31, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x04, 0x0A, 0x31, 0x33, 0x33, 
+    0x33, 0x13, 0x01, 0x03, 0x0B, 0x41, 0x11, 0x11, 0x11, 0x11, 0x01, 0x02, 0x02, 0x04, 0x41, 0x14, 
+    0x03, 0x04, 0x41, 0x14, 0x00, 0x00, 0x01, 0x04, 0x06, 0x11, 0x11, 0x11, 0x01, 0x03, 0x08, 0x21, 
+    0x22, 0x22, 0x12, 0x01, 0x03, 0x09, 0x21, 0x11, 0x21, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x11, 
+    0x11, 0x22, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x13, 0x13, 0x12, 0x12, 0x01, 0x03, 0x09, 0x21, 0x11, 
+    0x21, 0x12, 0x01, 0x01, 0x04, 0x07, 0x21, 0x21, 0x12, 0x01, 0x01, 0x03, 0x09, 0x21, 0x32, 0x22, 
+    0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x02, 0x0B, 0x21, 0x22, 0x23, 
+    0x22, 0x22, 0x01, 0x01, 0x02, 0x0B, 0x21, 0x22, 0x22, 0x22, 0x32, 0x01, 0x01, 0x02, 0x0A, 0x31, 
+    0x33, 0x33, 0x33, 0x13, 0x01, 0x02, 0x0B, 0x11, 0x11, 0x11, 0x11, 0x41, 0x01, 0x02, 0x03, 0x04, 
+    0x41, 0x14, 0x03, 0x04, 0x41, 0x14, 0x00, 0x00, 0x01, 0x06, 0x06, 0x11, 0x11, 0x11, 0x01, 0x05, 
+    0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x04, 0x09, 0x21, 0x22, 0x11, 0x21, 0x01, 0x01, 0x03, 0x0A, 
+    0x21, 0x22, 0x11, 0x11, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x21, 0x31, 0x31, 0x12, 0x01, 0x04, 0x09, 
+    0x11, 0x22, 0x11, 0x21, 0x01, 0x01, 0x05, 0x07, 0x11, 0x22, 0x21, 0x01, 0x01, 0x04, 0x09, 0x21, 
+    0x22, 0x32, 0x22, 0x01, 0x01, 0x04, 0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 
+    0x22, 0x22, 0x23, 0x12, 0x01, 0x03, 0x0B, 0x31, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x04, 0x0A, 
+    0x31, 0x33, 0x33, 0x33, 0x13, 0x01, 0x03, 0x0B, 0x41, 0x11, 0x11, 0x11, 0x11, 0x01, 0x02, 0x02, 
+    0x04, 0x41, 0x14, 0x03, 0x04, 0x41, 0x14, 0x00, 0x00, 0x01, 0x04, 0x06, 0x11, 0x11, 0x11, 0x01, 
+    0x03, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x03, 0x09, 0x21, 0x11, 0x21, 0x22, 0x01, 0x01, 0x03, 
+    0x0A, 0x21, 0x11, 0x11, 0x22, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x13, 0x13, 0x12, 0x12, 0x01, 0x03, 
+    0x09, 0x21, 0x11, 0x21, 0x12, 0x01, 0x01, 0x04, 0x07, 0x21, 0x21, 0x12, 0x01, 0x01, 0x03, 0x09, 
+    0x21, 0x32, 0x22, 0x22, 0x01, 0x01, 0x03, 0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x03, 0x0A, 
+    0x21, 0x32, 0x22, 0x22, 0x12, 0x01, 0x02, 0x0B, 0x21, 0x22, 0x22, 0x22, 0x32, 0x01, 0x01, 0x02, 
+    0x0A, 0x31, 0x33, 0x33, 0x33, 0x13, 0x01, 0x02, 0x0B, 0x11, 0x11, 0x11, 0x11, 0x41, 0x01, 0x02, 
+    0x03, 0x04, 0x41, 0x14, 0x03, 0x04, 0x41, 0x14, 
+};
+const RLESprite wizard_idle_rle[6] = {
+    {16, 16, 4, wizard_idle_palette, {wizard_idle_rle_data + 0, wizard_idle_rle_data + 116}},
+    {16, 16, 4, wizard_idle_palette, {wizard_idle_rle_data + 232, wizard_idle_rle_data + 348}},
+    {16, 16, 4, wizard_idle_palette, {wizard_idle_rle_data + 464, wizard_idle_rle_data + 575}},
+    {16, 16, 4, wizard_idle_palette, {wizard_idle_rle_data + 686, wizard_idle_rle_data + 800}},
+    {16, 16, 4, wizard_idle_palette, {wizard_idle_rle_data + 914, wizard_idle_rle_data + 1028}},
+    {16, 16, 4, wizard_idle_palette, {wizard_idle_rle_data + 1142, wizard_idle_rle_data + 1255}},
+};
+
+// wizard_run: 6 frames of 16x16, 4 colours
+static const unsigned short int wizard_run_palette[5] = {
+    0x0000, 0x10A3, 0x910D, 0xFC24, 0x7920, 
+};
+static const unsigned char wizard_run_rle_data[1360] = {
+    0x01, 0x06, 0x06, 0x11, 0x11, 0x11, 0x01, 0x05, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x04, 0x09, 
+    0x21, 0x22, 0x11, 0x21, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 0x01, 0x03, 0x0A, 
+    0x21, 0x21, 0x11, 0x11, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x21, 0x32, 0x31, 0x12, 0x01, 0x04, 0x08, 
+    0x11, 0x21, 0x12, 0x12, 0x01, 0x05, 0x08, 0x21, 0x22, 0x23, 0x12, 0x01, 0x04, 0x09, 0x21, 0x22, 
+    0x22, 0x22, 0x01, 0x01, 0x04, 0x09, 0x21, 0x22, 0x32, 0x22, 0x01, 0x01, 0x03, 0x0B, 0x21, 0x22, 
+    0x22, 0x22, 0x12, 0x01, 0x01, 0x03, 0x0C, 0x31, 0x23, 0x22, 0x22, 0x41, 0x14, 0x01, 0x03, 0x0B, 
+    0x11, 0x31, 0x33, 0x13, 0x44, 0x01, 0x01, 0x02, 0x0B, 0x41, 0x44, 0x11, 0x11, 0x11, 0x01, 0x01, 
+    0x02, 0x04, 0x11, 0x11, 0x00, 0x01, 0x04, 0x06, 0x11, 0x11, 0x11, 0x01, 0x03, 0x08, 0x21, 0x22, 
+    0x22, 0x12, 0x01, 0x03, 0x09, 0x21, 0x11, 0x21, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x11, 0x11, 
+    0x22, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x11, 0x11, 0x12, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x13, 0x23, 
+    0x12, 0x12, 0x01, 0x04, 0x08, 0x21, 0x21, 0x12, 0x11, 0x01, 0x03, 0x08, 0x21, 0x32, 0x22, 0x12, 
+    0x01, 0x03, 0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x03, 0x09, 0x21, 0x32, 0x22, 0x22, 0x01, 
+    0x01, 0x02, 0x0B, 0x11, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x01, 0x0C, 0x41, 0x14, 0x22, 0x22, 
+    0x32, 0x13, 0x01, 0x02, 0x0B, 0x41, 0x14, 0x33, 0x33, 0x11, 0x01, 0x01, 0x03, 0x0B, 0x11, 0x11, 
+    0x11, 0x41, 0x44, 0x01, 0x01, 0x0A, 0x04, 0x11, 0x11, 0x00, 0x00, 0x01, 0x06, 0x06, 0x11, 0x11, 
+    0x11, 0x01, 0x05, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x04, 0x09, 0x21, 0x22, 0x11, 0x21, 0x01, 
+    0x01, 0x03, 0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x21, 0x31, 0x31, 0x12, 
+    0x01, 0x04, 0x09, 0x11, 0x22, 0x11, 0x21, 0x01, 0x01, 0x05, 0x07, 0x11, 0x22, 0x21, 0x01, 0x01, 
+    0x04, 0x09, 0x21, 0x22, 0x32, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 
+    0x03, 0x0B, 0x21, 0x22, 0x22, 0x23, 0x22, 0x01, 0x01, 0x03, 0x0B, 0x31, 0x23, 0x22, 0x22, 0x22, 
+    0x01, 0x01, 0x04, 0x0A, 0x11, 0x33, 0x33, 0x33, 0x13, 0x01, 0x03, 0x0B, 0x41, 0x14, 0x11, 0x11, 
+    0x11, 0x01, 0x02, 0x03, 0x04, 0x11, 0x11, 0x02, 0x05, 0x41, 0x44, 0x01, 0x01, 0x0A, 0x04, 0x41, 
+    0x14, 0x00, 0x01, 0x04, 0x06, 0x11, 0x11, 0x11, 0x01, 0x03, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 
+    0x03, 0x09, 0x21, 0x11, 0x21, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x11, 0x11, 0x22, 0x12, 0x01, 
+    0x03, 0x0A, 0x21, 0x13, 0x13, 0x12, 0x12, 0x01, 0x03, 0x09, 0x21, 0x11, 0x21, 0x12, 0x01, 0x01, 
+    0x04, 0x07, 0x21, 0x21, 0x12, 0x01, 0x01, 0x03, 0x09, 0x21, 0x32, 0x22, 0x22, 0x01, 0x01, 0x03, 
+    0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x02, 0x0B, 0x21, 0x22, 0x23, 0x22, 0x22, 0x01, 0x01, 
+    0x02, 0x0B, 0x21, 0x22, 0x22, 0x22, 0x33, 0x01, 0x01, 0x02, 0x0A, 0x31, 0x33, 0x33, 0x33, 0x11, 
+    0x01, 0x02, 0x0B, 0x11, 0x11, 0x11, 0x11, 0x44, 0x01, 0x02, 0x02, 0x05, 0x41, 0x44, 0x01, 0x02, 
+    0x04, 0x11, 0x11, 0x01, 0x02, 0x04, 0x41, 0x14, 0x00, 0x00, 0x00, 0x01, 0x06, 0x06, 0x11, 0x11, 
+    0x11, 0x01, 0x05, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x04, 0x09, 0x21, 0x22, 0x11, 0x21, 0x01, 
+    0x01, 0x03, 0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x21, 0x31, 0x31, 0x12, 
+    0x01, 0x04, 0x09, 0x11, 0x22, 0x11, 0x21, 0x01, 0x01, 0x04, 0x09, 0x11, 0x21, 0x12, 0x12, 0x01, 
+    0x01, 0x03, 0x0A, 0x21, 0x22, 0x22, 0x23, 0x12, 0x01, 0x03, 0x0B, 0x21, 0x22, 0x22, 0x23, 0x22, 
+    0x01, 0x01, 0x03, 0x0B, 0x31, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x04, 0x0A, 0x31, 0x33, 0x33, 
+    0x33, 0x13, 0x01, 0x04, 0x0A, 0x11, 0x11, 0x11, 0x11, 0x11, 0x02, 0x04, 0x04, 0x41, 0x14, 0x01, 
+    0x05, 0x41, 0x44, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x06, 0x11, 0x11, 0x11, 0x01, 0x03, 0x08, 
+    0x21, 0x22, 0x22, 0x12, 0x01, 0x03, 0x09, 0x21, 0x11, 0x21, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 
+    0x11, 0x11, 0x22, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x13, 0x13, 0x12, 0x12, 0x01, 0x03, 0x09, 0x21, 
+    0x11, 0x21, 0x12, 0x01, 0x01, 0x03, 0x09, 0x11, 0x12, 0x22, 0x11, 0x01, 0x01, 0x03, 0x0A, 0x21, 
+    0x32, 0x22, 0x22, 0x12, 0x01, 0x02, 0x0B, 0x21, 0x22, 0x23, 0x22, 0x22, 0x01, 0x01, 0x02, 0x0B, 
+    0x21, 0x22, 0x22, 0x22, 0x32, 0x01, 0x01, 0x02, 0x0A, 0x31, 0x33, 0x33, 0x33, 0x13, 0x01, 0x02, 
+    0x0A, 0x11, 0x11, 0x11, 0x11, 0x11, 0x02, 0x02, 0x05, 0x41, 0x44, 0x01, 0x01, 0x04, 0x41, 0x14, 
+    0x01, 0x06, 0x06, 0x11, 0x11, 0x11, 0x01, 0x05, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x04, 0x09, 
+    0x21, 0x22, 0x11, 0x21, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 0x01, 0x03, 0x0A, 
+    0x21, 0x21, 0x11, 0x11, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x21, 0x32, 0x31, 0x12, 0x01, 0x04, 0x08, 
+    0x11, 0x21, 0x12, 0x12, 0x01, 0x05, 0x08, 0x21, 0x22, 0x23, 0x12, 0x01, 0x04, 0x09, 0x21, 0x22, 
+    0x22, 0x22, 0x01, 0x01, 0x04, 0x09, 0x21, 0x22, 0x32, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x12, 
+    0x21, 0x22, 0x12, 0x01, 0x03, 0x0A, 0x31, 0x41, 0x14, 0x22, 0x12, 0x01, 0x04, 0x09, 0x41, 0x14, 
+    0x33, 0x33, 0x01, 0x01, 0x04, 0x09, 0x11, 0x11, 0x11, 0x11, 0x01, 0x01, 0x08, 0x03, 0x41, 0x01, 
+    0x00, 0x01, 0x04, 0x06, 0x11, 0x11, 0x11, 0x01, 0x03, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x03, 
+    0x09, 0x21, 0x11, 0x21, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x11, 0x11, 0x22, 0x12, 0x01, 0x03, 
+    0x0A, 0x21, 0x11, 0x11, 0x12, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x13, 0x23, 0x12, 0x12, 0x01, 0x04, 
+    0x08, 0x21, 0x21, 0x12, 0x11, 0x01, 0x03, 0x08, 0x21, 0x32, 0x22, 0x12, 0x01, 0x03, 0x09, 0x21, 
+    0x22, 0x22, 0x22, 0x01, 0x01, 0x03, 0x09, 0x21, 0x32, 0x22, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 
+    0x22, 0x12, 0x21, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x41, 0x14, 0x13, 0x01, 0x03, 0x09, 0x31, 
+    0x33, 0x13, 0x44, 0x01, 0x01, 0x03, 0x09, 0x11, 0x11, 0x11, 0x11, 0x01, 0x01, 0x05, 0x03, 0x41, 
+    0x01, 0x00, 0x00, 0x01, 0x06, 0x06, 0x11, 0x11, 0x11, 0x01, 0x05, 0x08, 0x21, 0x22, 0x22, 0x12, 
+    0x01, 0x04, 0x09, 0x21, 0x22, 0x11, 0x21, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 
+    0x01, 0x03, 0x0A, 0x21, 0x21, 0x31, 0x31, 0x12, 0x01, 0x04, 0x09, 0x11, 0x22, 0x11, 0x21, 0x01, 
+    0x01, 0x05, 0x07, 0x11, 0x22, 0x21, 0x01, 0x01, 0x04, 0x09, 0x21, 0x22, 0x32, 0x22, 0x01, 0x01, 
+    0x03, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x03, 0x0B, 0x21, 0x22, 0x22, 0x23, 0x22, 0x01, 
+    0x01, 0x03, 0x0B, 0x21, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x03, 0x0B, 0x31, 0x33, 0x33, 0x33, 
+    0x33, 0x01, 0x01, 0x04, 0x0A, 0x11, 0x11, 0x11, 0x11, 0x11, 0x02, 0x04, 0x04, 0x41, 0x14, 0x01, 
+    0x04, 0x41, 0x14, 0x01, 0x05, 0x03, 0x41, 0x01, 0x00, 0x01, 0x04, 0x06, 0x11, 0x11, 0x11, 0x01, 
+    0x03, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x03, 0x09, 0x21, 0x11, 0x21, 0x22, 0x01, 0x01, 0x03, 
+    0x0A, 0x21, 0x11, 0x11, 0x22, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x13, 0x13, 0x12, 0x12, 0x01, 0x03, 
+    0x09, 0x21, 0x11, 0x21, 0x12, 0x01, 0x01, 0x04, 0x07, 0x21, 0x21, 0x12, 0x01, 0x01, 0x03, 0x09, 
+    0x21, 0x32, 0x22, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x02, 0x0B, 
+    0x21, 0x22, 0x23, 0x22, 0x22, 0x01, 0x01, 0x02, 0x0B, 0x21, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 
+    0x02, 0x0B, 0x31, 0x33, 0x33, 0x33, 0x33, 0x01, 0x01, 0x02, 0x0A, 0x11, 0x11, 0x11, 0x11, 0x11, 
+    0x02, 0x03, 0x04, 0x41, 0x14, 0x01, 0x04, 0x41, 0x14, 0x01, 0x08, 0x03, 0x41, 0x01, 0x00, 0x00, 
+    0x00, 0x01, 0x06, 0x06, 0x11, 0x11, 0x11, 0x01, 0x05, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x04, 
+    0x09, 0x21, 0x22, 0x11, 0x21, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 0x01, 0x03, 
+    0x0A, 0x21, 0x21, 0x31, 0x31, 0x12, 0x01, 0x04, 0x09, 0x11, 0x22, 0x11, 0x21, 0x01, 0x01, 0x04, 
+    0x09, 0x11, 0x21, 0x12, 0x12, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x22, 0x23, 0x12, 0x01, 0x03, 
+    0x0B, 0x21, 0x22, 0x22, 0x23, 0x22, 0x01, 0x01, 0x03, 0x0B, 0x31, 0x22, 0x22, 0x22, 0x22, 0x01, 
+    0x01, 0x04, 0x0A, 0x31, 0x33, 0x33, 0x33, 0x13, 0x01, 0x04, 0x0A, 0x11, 0x11, 0x11, 0x11, 0x11, 
+    0x01, 0x04, 0x07, 0x41, 0x44, 0x41, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x06, 0x11, 0x11, 0x11, 
+    0x01, 0x03, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x03, 0x09, 0x21, 0x11, 0x21, 0x22, 0x01, 0x01, 
+    0x03, 0x0A, 0x21, 0x11, 0x11, 0x22, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x13, 0x13, 0x12, 0x12, 0x01, 
+    0x03, 0x09, 0x21, 0x11, 0x21, 0x12, 0x01, 0x01, 0x03, 0x09, 0x11, 0x12, 0x22, 0x11, 0x01, 0x01, 
+    0x03, 0x0A, 0x21, 0x32, 0x22, 0x22, 0x12, 0x01, 0x02, 0x0B, 0x21, 0x22, 0x23, 0x22, 0x22, 0x01, 
+    0x01, 0x02, 0x0B, 0x21, 0x22, 0x22, 0x22, 0x32, 0x01, 0x01, 0x02, 0x0A, 0x31, 0x33, 0x33, 0x33, 
+    0x13, 0x01, 0x02, 0x0A, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0x05, 0x07, 0x41, 0x41, 0x44, 0x01, 
+};
+const RLESprite wizard_run_rle[6] = {
+    {16, 16, 4, wizard_run_palette, {wizard_run_rle_data + 0, wizard_run_rle_data + 117}},
+    {16, 16, 4, wizard_run_palette, {wizard_run_rle_data + 234, wizard_run_rle_data + 353}},
+    {16, 16, 4, wizard_run_palette, {wizard_run_rle_data + 472, wizard_run_rle_data + 580}},
+    {16, 16, 4, wizard_run_palette, {wizard_run_rle_data + 688, wizard_run_rle_data + 801}},
+    {16, 16, 4, wizard_run_palette, {wizard_run_rle_data + 914, wizard_run_rle_data + 1032}},
+    {16, 16, 4, wizard_run_palette, {wizard_run_rle_data + 1150, wizard_run_rle_data + 1255}},
+};
+
+// wizard_evade: 6 frames of 16x16, 4 colours
+static const unsigned short int wizard_evade_palette[5] = {
+    0x0000, 0x10A3, 0x910D, 0x7920, 0xFC24, 
+};
+static const unsigned char wizard_evade_rle_data[1418] = {
+    0x00, 0x01, 0x08, 0x03, 0x11, 0x01, 0x01, 0x08, 0x04, 0x21, 0x12, 0x01, 0x07, 0x07, 0x11, 0x22, 
+    0x12, 0x01, 0x01, 0x06, 0x09, 0x41, 0x21, 0x22, 0x22, 0x01, 0x01, 0x05, 0x0A, 0x41, 0x12, 0x22, 
+    0x22, 0x12, 0x01, 0x04, 0x0C, 0x41, 0x22, 0x22, 0x22, 0x22, 0x12, 0x01, 0x03, 0x0D, 0x41, 0x22, 
+    0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x03, 0x0D, 0x41, 0x22, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 
+    0x03, 0x0D, 0x41, 0x22, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x03, 0x0C, 0x41, 0x22, 0x12, 0x11, 
+    0x11, 0x11, 0x01, 0x03, 0x0B, 0x41, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x11, 0x44, 
+    0x44, 0x44, 0x14, 0x01, 0x03, 0x09, 0x31, 0x11, 0x11, 0x11, 0x01, 0x02, 0x04, 0x02, 0x11, 0x03, 
+    0x03, 0x31, 0x01, 0x00, 0x00, 0x01, 0x05, 0x03, 0x11, 0x01, 0x01, 0x04, 0x04, 0x21, 0x12, 0x01, 
+    0x02, 0x07, 0x11, 0x22, 0x12, 0x01, 0x01, 0x01, 0x09, 0x21, 0x22, 0x22, 0x41, 0x01, 0x01, 0x01, 
+    0x0A, 0x21, 0x22, 0x22, 0x21, 0x14, 0x01, 0x00, 0x0C, 0x21, 0x22, 0x22, 0x22, 0x22, 0x14, 0x01, 
+    0x00, 0x0D, 0x21, 0x22, 0x22, 0x22, 0x22, 0x42, 0x01, 0x01, 0x00, 0x0D, 0x21, 0x22, 0x22, 0x22, 
+    0x21, 0x42, 0x01, 0x01, 0x00, 0x0D, 0x21, 0x22, 0x22, 0x22, 0x21, 0x42, 0x01, 0x01, 0x01, 0x0C, 
+    0x11, 0x11, 0x11, 0x21, 0x22, 0x14, 0x01, 0x02, 0x0B, 0x21, 0x22, 0x22, 0x22, 0x42, 0x01, 0x01, 
+    0x03, 0x0A, 0x41, 0x44, 0x44, 0x44, 0x11, 0x01, 0x04, 0x09, 0x11, 0x11, 0x11, 0x31, 0x01, 0x02, 
+    0x04, 0x03, 0x31, 0x01, 0x03, 0x02, 0x11, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x03, 0x11, 0x01, 0x01, 
+    0x0A, 0x04, 0x31, 0x13, 0x02, 0x03, 0x04, 0x11, 0x11, 0x01, 0x06, 0x11, 0x11, 0x11, 0x01, 0x03, 
+    0x0C, 0x31, 0x13, 0x41, 0x44, 0x44, 0x14, 0x01, 0x04, 0x0C, 0x11, 0x44, 0x22, 0x22, 0x22, 0x14, 
+    0x01, 0x04, 0x0C, 0x41, 0x22, 0x22, 0x22, 0x22, 0x12, 0x01, 0x04, 0x0C, 0x21, 0x22, 0x22, 0x22, 
+    0x22, 0x12, 0x01, 0x04, 0x0C, 0x21, 0x22, 0x22, 0x22, 0x22, 0x12, 0x01, 0x04, 0x0C, 0x11, 0x22, 
+    0x22, 0x22, 0x22, 0x12, 0x01, 0x03, 0x0D, 0x21, 0x21, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x03, 
+    0x0D, 0x21, 0x12, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x03, 0x0C, 0x21, 0x22, 0x22, 0x22, 0x22, 
+    0x12, 0x01, 0x04, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x05, 0x08, 0x11, 0x11, 0x11, 0x11, 
+    0x00, 0x00, 0x01, 0x03, 0x03, 0x11, 0x01, 0x01, 0x02, 0x04, 0x31, 0x13, 0x02, 0x02, 0x06, 0x11, 
+    0x11, 0x11, 0x01, 0x04, 0x11, 0x11, 0x01, 0x01, 0x0C, 0x41, 0x44, 0x44, 0x14, 0x31, 0x13, 0x01, 
+    0x00, 0x0C, 0x41, 0x22, 0x22, 0x22, 0x44, 0x11, 0x01, 0x00, 0x0C, 0x21, 0x22, 0x22, 0x22, 0x22, 
+    0x14, 0x01, 0x00, 0x0C, 0x21, 0x22, 0x22, 0x22, 0x22, 0x12, 0x01, 0x00, 0x0C, 0x21, 0x22, 0x22, 
+    0x22, 0x22, 0x12, 0x01, 0x00, 0x0C, 0x21, 0x22, 0x22, 0x22, 0x22, 0x11, 0x01, 0x00, 0x0D, 0x21, 
+    0x22, 0x22, 0x22, 0x22, 0x21, 0x01, 0x01, 0x00, 0x0D, 0x21, 0x22, 0x22, 0x22, 0x12, 0x22, 0x01, 
+    0x01, 0x01, 0x0C, 0x21, 0x22, 0x22, 0x22, 0x22, 0x12, 0x01, 0x02, 0x0A, 0x21, 0x22, 0x22, 0x22, 
+    0x12, 0x01, 0x03, 0x08, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x01, 0x04, 0x05, 0x11, 0x11, 
+    0x01, 0x01, 0x03, 0x07, 0x21, 0x22, 0x22, 0x01, 0x01, 0x02, 0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 
+    0x01, 0x01, 0x0A, 0x21, 0x22, 0x12, 0x11, 0x12, 0x02, 0x01, 0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 
+    0x01, 0x02, 0x11, 0x02, 0x01, 0x0A, 0x21, 0x21, 0x41, 0x31, 0x11, 0x01, 0x03, 0x31, 0x01, 0x01, 
+    0x02, 0x0D, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x01, 0x01, 0x03, 0x0C, 0x21, 0x11, 0x44, 0x44, 
+    0x44, 0x14, 0x01, 0x03, 0x0D, 0x21, 0x42, 0x22, 0x22, 0x22, 0x42, 0x01, 0x01, 0x03, 0x0D, 0x21, 
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x04, 0x0C, 0x21, 0x22, 0x22, 0x22, 0x22, 0x12, 0x01, 
+    0x05, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x06, 0x08, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 
+    0x00, 0x01, 0x07, 0x05, 0x11, 0x11, 0x01, 0x01, 0x06, 0x07, 0x21, 0x22, 0x22, 0x01, 0x01, 0x05, 
+    0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x05, 0x0A, 0x21, 0x11, 0x21, 0x22, 0x12, 0x02, 0x02, 
+    0x02, 0x11, 0x01, 0x0A, 0x21, 0x11, 0x11, 0x22, 0x12, 0x02, 0x01, 0x03, 0x31, 0x01, 0x01, 0x0A, 
+    0x11, 0x13, 0x14, 0x12, 0x12, 0x01, 0x01, 0x0D, 0x11, 0x11, 0x11, 0x11, 0x11, 0x12, 0x01, 0x01, 
+    0x01, 0x0C, 0x41, 0x44, 0x44, 0x44, 0x11, 0x12, 0x01, 0x00, 0x0D, 0x41, 0x22, 0x22, 0x22, 0x42, 
+    0x22, 0x01, 0x01, 0x00, 0x0D, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x00, 0x0C, 0x21, 
+    0x22, 0x22, 0x22, 0x22, 0x12, 0x01, 0x01, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x02, 0x08, 
+    0x11, 0x11, 0x11, 0x11, 0x00, 0x01, 0x05, 0x06, 0x11, 0x11, 0x11, 0x01, 0x04, 0x08, 0x21, 0x22, 
+    0x22, 0x12, 0x01, 0x03, 0x09, 0x21, 0x22, 0x11, 0x21, 0x01, 0x01, 0x02, 0x0A, 0x21, 0x22, 0x11, 
+    0x11, 0x12, 0x01, 0x02, 0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 0x01, 0x02, 0x0A, 0x21, 0x21, 0x42, 
+    0x41, 0x12, 0x01, 0x03, 0x09, 0x11, 0x21, 0x12, 0x22, 0x01, 0x01, 0x05, 0x07, 0x21, 0x42, 0x12, 
+    0x01, 0x01, 0x04, 0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x04, 0x0A, 0x21, 0x22, 0x42, 0x22, 
+    0x12, 0x01, 0x04, 0x0B, 0x21, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x04, 0x0B, 0x21, 0x22, 0x22, 
+    0x22, 0x42, 0x01, 0x01, 0x04, 0x0B, 0x41, 0x44, 0x44, 0x44, 0x14, 0x01, 0x01, 0x03, 0x0D, 0x31, 
+    0x11, 0x11, 0x11, 0x11, 0x33, 0x01, 0x02, 0x02, 0x04, 0x31, 0x13, 0x06, 0x03, 0x11, 0x01, 0x00, 
+    0x01, 0x05, 0x06, 0x11, 0x11, 0x11, 0x01, 0x04, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x04, 0x09, 
+    0x21, 0x11, 0x21, 0x22, 0x01, 0x01, 0x04, 0x0A, 0x21, 0x11, 0x11, 0x22, 0x12, 0x01, 0x04, 0x0A, 
+    0x21, 0x11, 0x11, 0x22, 0x12, 0x01, 0x04, 0x0A, 0x21, 0x14, 0x24, 0x12, 0x12, 0x01, 0x04, 0x09, 
+    0x21, 0x12, 0x22, 0x11, 0x01, 0x01, 0x04, 0x07, 0x11, 0x42, 0x22, 0x01, 0x01, 0x03, 0x09, 0x21, 
+    0x22, 0x22, 0x22, 0x01, 0x01, 0x02, 0x0A, 0x21, 0x22, 0x24, 0x22, 0x12, 0x01, 0x01, 0x0B, 0x21, 
+    0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x01, 0x0B, 0x41, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 0x01, 
+    0x0B, 0x11, 0x44, 0x44, 0x44, 0x44, 0x01, 0x01, 0x00, 0x0D, 0x31, 0x13, 0x11, 0x11, 0x11, 0x31, 
+    0x01, 0x02, 0x01, 0x03, 0x11, 0x01, 0x06, 0x04, 0x31, 0x13, 0x00, 0x01, 0x06, 0x06, 0x11, 0x11, 
+    0x11, 0x01, 0x05, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x04, 0x09, 0x21, 0x22, 0x11, 0x21, 0x01, 
+    0x01, 0x03, 0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x21, 0x41, 0x41, 0x12, 
+    0x01, 0x04, 0x09, 0x11, 0x22, 0x11, 0x21, 0x01, 0x01, 0x06, 0x06, 0x21, 0x12, 0x12, 0x01, 0x05, 
+    0x08, 0x21, 0x22, 0x24, 0x12, 0x01, 0x04, 0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x04, 0x09, 
+    0x21, 0x22, 0x42, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x03, 0x0A, 
+    0x41, 0x22, 0x22, 0x22, 0x12, 0x01, 0x04, 0x09, 0x41, 0x44, 0x44, 0x44, 0x01, 0x01, 0x03, 0x0A, 
+    0x31, 0x11, 0x11, 0x11, 0x11, 0x02, 0x02, 0x04, 0x31, 0x13, 0x03, 0x04, 0x31, 0x13, 0x00, 0x01, 
+    0x04, 0x06, 0x11, 0x11, 0x11, 0x01, 0x03, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x03, 0x09, 0x21, 
+    0x11, 0x21, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x11, 0x11, 0x22, 0x12, 0x01, 0x03, 0x0A, 0x21, 
+    0x14, 0x14, 0x12, 0x12, 0x01, 0x03, 0x09, 0x21, 0x11, 0x21, 0x12, 0x01, 0x01, 0x04, 0x06, 0x21, 
+    0x21, 0x12, 0x01, 0x03, 0x08, 0x21, 0x42, 0x22, 0x12, 0x01, 0x03, 0x09, 0x21, 0x22, 0x22, 0x22, 
+    0x01, 0x01, 0x03, 0x09, 0x21, 0x42, 0x22, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x22, 0x22, 
+    0x12, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x14, 0x01, 0x03, 0x09, 0x41, 0x44, 0x44, 0x44, 
+    0x01, 0x01, 0x03, 0x0A, 0x11, 0x11, 0x11, 0x11, 0x13, 0x02, 0x03, 0x04, 0x31, 0x13, 0x03, 0x04, 
+    0x31, 0x13, 0x00, 0x01, 0x06, 0x06, 0x11, 0x11, 0x11, 0x01, 0x05, 0x08, 0x21, 0x22, 0x22, 0x12, 
+    0x01, 0x04, 0x09, 0x21, 0x22, 0x11, 0x21, 0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 
+    0x01, 0x03, 0x0A, 0x21, 0x21, 0x41, 0x41, 0x12, 0x01, 0x04, 0x09, 0x11, 0x22, 0x11, 0x21, 0x01, 
+    0x01, 0x06, 0x06, 0x21, 0x12, 0x12, 0x01, 0x05, 0x08, 0x21, 0x22, 0x24, 0x12, 0x01, 0x04, 0x09, 
+    0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x04, 0x09, 0x21, 0x22, 0x42, 0x22, 0x01, 0x01, 0x03, 0x0A, 
+    0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x03, 0x0A, 0x41, 0x22, 0x22, 0x22, 0x12, 0x01, 0x04, 0x09, 
+    0x41, 0x44, 0x44, 0x44, 0x01, 0x01, 0x03, 0x0A, 0x31, 0x11, 0x11, 0x11, 0x11, 0x02, 0x02, 0x04, 
+    0x31, 0x13, 0x03, 0x04, 0x31, 0x13, 0x00, 0x01, 0x04, 0x06, 0x11, 0x11, 0x11, 0x01, 0x03, 0x08, 
+    0x21, 0x22, 0x22, 0x12, 0x01, 0x03, 0x09, 0x21, 0x11, 0x21, 0x22, 0x01, 0x01, 0x03, 0x0A, 0x21, 
+    0x11, 0x11, 0x22, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x14, 0x14, 0x12, 0x12, 0x01, 0x03, 0x09, 0x21, 
+    0x11, 0x21, 0x12, 0x01, 0x01, 0x04, 0x06, 0x21, 0x21, 0x12, 0x01, 0x03, 0x08, 0x21, 0x42, 0x22, 
+    0x12, 0x01, 0x03, 0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x03, 0x09, 0x21, 0x42, 0x22, 0x22, 
+    0x01, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x22, 0x22, 
+    0x14, 0x01, 0x03, 0x09, 0x41, 0x44, 0x44, 0x44, 0x01, 0x01, 0x03, 0x0A, 0x11, 0x11, 0x11, 0x11, 
+    0x13, 0x02, 0x03, 0x04, 0x31, 0x13, 0x03, 0x04, 0x31, 0x13, 
+};
+const RLESprite wizard_evade_rle[6] = {
+    {16, 16, 4, wizard_evade_palette, {wizard_evade_rle_data + 0, wizard_evade_rle_data + 116}},
+    {16, 16, 4, wizard_evade_palette, {wizard_evade_rle_data + 232, wizard_evade_rle_data + 352}},
+    {16, 16, 4, wizard_evade_palette, {wizard_evade_rle_data + 472, wizard_evade_rle_data + 590}},
+    {16, 16, 4, wizard_evade_palette, {wizard_evade_rle_data + 708, wizard_evade_rle_data + 831}},
+    {16, 16, 4, wizard_evade_palette, {wizard_evade_rle_data + 954, wizard_evade_rle_data + 1070}},
+    {16, 16, 4, wizard_evade_palette, {wizard_evade_rle_data + 1186, wizard_evade_rle_data + 1302}},
+};
+
+// wizard_hit: 3 frames of 16x16, 4 colours
+static const unsigned short int wizard_hit_palette[5] = {
+    0x0000, 0x10A3, 0x910D, 0xFC24, 0x7920, 
+};
+static const unsigned char wizard_hit_rle_data[726] = {
+    0x01, 0x03, 0x06, 0x11, 0x11, 0x11, 0x01, 0x02, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x01, 0x0A, 
+    0x21, 0x22, 0x12, 0x21, 0x12, 0x01, 0x01, 0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 0x01, 0x02, 0x09, 
+    0x11, 0x22, 0x11, 0x21, 0x01, 0x01, 0x03, 0x08, 0x21, 0x22, 0x11, 0x12, 0x01, 0x04, 0x06, 0x21, 
+    0x22, 0x13, 0x01, 0x04, 0x07, 0x21, 0x22, 0x22, 0x01, 0x01, 0x03, 0x09, 0x21, 0x22, 0x22, 0x22, 
+    0x01, 0x01, 0x02, 0x0A, 0x21, 0x22, 0x22, 0x32, 0x12, 0x01, 0x02, 0x0A, 0x21, 0x22, 0x22, 0x22, 
+    0x12, 0x01, 0x02, 0x0A, 0x31, 0x23, 0x22, 0x22, 0x12, 0x01, 0x03, 0x09, 0x11, 0x33, 0x33, 0x33, 
+    0x01, 0x01, 0x03, 0x08, 0x41, 0x11, 0x11, 0x11, 0x02, 0x03, 0x03, 0x41, 0x01, 0x02, 0x03, 0x41, 
+    0x01, 0x02, 0x04, 0x01, 0x01, 0x03, 0x04, 0x41, 0x14, 0x01, 0x07, 0x06, 0x11, 0x11, 0x11, 0x01, 
+    0x06, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x05, 0x0A, 0x21, 0x12, 0x21, 0x22, 0x12, 0x01, 0x05, 
+    0x0A, 0x21, 0x11, 0x11, 0x22, 0x12, 0x01, 0x05, 0x09, 0x21, 0x11, 0x21, 0x12, 0x01, 0x01, 0x05, 
+    0x08, 0x21, 0x11, 0x22, 0x12, 0x01, 0x06, 0x06, 0x31, 0x22, 0x12, 0x01, 0x05, 0x07, 0x21, 0x22, 
+    0x22, 0x01, 0x01, 0x04, 0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x04, 0x0A, 0x21, 0x23, 0x22, 
+    0x22, 0x12, 0x01, 0x04, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x04, 0x0A, 0x21, 0x22, 0x22, 
+    0x32, 0x13, 0x01, 0x04, 0x09, 0x31, 0x33, 0x33, 0x13, 0x01, 0x01, 0x05, 0x08, 0x11, 0x11, 0x11, 
+    0x14, 0x02, 0x05, 0x03, 0x41, 0x01, 0x02, 0x03, 0x41, 0x01, 0x02, 0x04, 0x04, 0x41, 0x14, 0x03, 
+    0x01, 0x01, 0x01, 0x05, 0x06, 0x11, 0x11, 0x11, 0x01, 0x04, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 
+    0x03, 0x0A, 0x21, 0x22, 0x12, 0x21, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 0x01, 
+    0x04, 0x09, 0x11, 0x22, 0x11, 0x21, 0x01, 0x01, 0x05, 0x08, 0x21, 0x22, 0x11, 0x12, 0x01, 0x06, 
+    0x06, 0x21, 0x22, 0x13, 0x01, 0x06, 0x07, 0x21, 0x22, 0x22, 0x01, 0x01, 0x05, 0x09, 0x21, 0x22, 
+    0x22, 0x22, 0x01, 0x01, 0x04, 0x0A, 0x21, 0x22, 0x22, 0x32, 0x12, 0x01, 0x04, 0x0A, 0x21, 0x22, 
+    0x22, 0x22, 0x12, 0x01, 0x04, 0x0A, 0x31, 0x23, 0x22, 0x22, 0x12, 0x01, 0x05, 0x09, 0x11, 0x33, 
+    0x33, 0x33, 0x01, 0x01, 0x05, 0x08, 0x41, 0x11, 0x11, 0x11, 0x02, 0x05, 0x03, 0x41, 0x01, 0x02, 
+    0x03, 0x41, 0x01, 0x02, 0x06, 0x01, 0x01, 0x03, 0x04, 0x41, 0x14, 0x01, 0x05, 0x06, 0x11, 0x11, 
+    0x11, 0x01, 0x04, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x12, 0x21, 0x22, 0x12, 
+    0x01, 0x03, 0x0A, 0x21, 0x11, 0x11, 0x22, 0x12, 0x01, 0x03, 0x09, 0x21, 0x11, 0x21, 0x12, 0x01, 
+    0x01, 0x03, 0x08, 0x21, 0x11, 0x22, 0x12, 0x01, 0x04, 0x06, 0x31, 0x22, 0x12, 0x01, 0x03, 0x07, 
+    0x21, 0x22, 0x22, 0x01, 0x01, 0x02, 0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x02, 0x0A, 0x21, 
+    0x23, 0x22, 0x22, 0x12, 0x01, 0x02, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x02, 0x0A, 0x21, 
+    0x22, 0x22, 0x32, 0x13, 0x01, 0x02, 0x09, 0x31, 0x33, 0x33, 0x13, 0x01, 0x01, 0x03, 0x08, 0x11, 
+    0x11, 0x11, 0x14, 0x02, 0x03, 0x03, 0x41, 0x01, 0x02, 0x03, 0x41, 0x01, 0x02, 0x02, 0x04, 0x41, 
+    0x14, 0x03, 0x01, 0x01, 0x01, 0x03, 0x06, 0x11, 0x11, 0x11, 0x01, 0x02, 0x08, 0x21, 0x22, 0x22, 
+    0x12, 0x01, 0x01, 0x0A, 0x21, 0x22, 0x12, 0x21, 0x12, 0x01, 0x01, 0x0A, 0x21, 0x22, 0x11, 0x11, 
+    0x12, 0x01, 0x02, 0x09, 0x11, 0x22, 0x11, 0x21, 0x01, 0x01, 0x03, 0x08, 0x21, 0x22, 0x11, 0x12, 
+    0x01, 0x04, 0x06, 0x21, 0x22, 0x13, 0x01, 0x04, 0x07, 0x21, 0x22, 0x22, 0x01, 0x01, 0x03, 0x09, 
+    0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x02, 0x0A, 0x21, 0x22, 0x22, 0x32, 0x12, 0x01, 0x02, 0x0A, 
+    0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x02, 0x0A, 0x31, 0x23, 0x22, 0x22, 0x12, 0x01, 0x03, 0x09, 
+    0x11, 0x33, 0x33, 0x33, 0x01, 0x01, 0x03, 0x08, 0x41, 0x11, 0x11, 0x11, 0x02, 0x03, 0x03, 0x41, 
+    0x01, 0x02, 0x03, 0x41, 0x01, 0x02, 0x04, 0x01, 0x01, 0x03, 0x04, 0x41, 0x14, 0x01, 0x07, 0x06, 
+    0x11, 0x11, 0x11, 0x01, 0x06, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x05, 0x0A, 0x21, 0x12, 0x21, 
+    0x22, 0x12, 0x01, 0x05, 0x0A, 0x21, 0x11, 0x11, 0x22, 0x12, 0x01, 0x05, 0x09, 0x21, 0x11, 0x21, 
+    0x12, 0x01, 0x01, 0x05, 0x08, 0x21, 0x11, 0x22, 0x12, 0x01, 0x06, 0x06, 0x31, 0x22, 0x12, 0x01, 
+    0x05, 0x07, 0x21, 0x22, 0x22, 0x01, 0x01, 0x04, 0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x04, 
+    0x0A, 0x21, 0x23, 0x22, 0x22, 0x12, 0x01, 0x04, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x04, 
+    0x0A, 0x21, 0x22, 0x22, 0x32, 0x13, 0x01, 0x04, 0x09, 0x31, 0x33, 0x33, 0x13, 0x01, 0x01, 0x05, 
+    0x08, 0x11, 0x11, 0x11, 0x14, 0x02, 0x05, 0x03, 0x41, 0x01, 0x02, 0x03, 0x41, 0x01, 0x02, 0x04, 
+    0x04, 0x41, 0x14, 0x03, 0x01, 0x01, 
+};
+const RLESprite wizard_hit_rle[3] = {
+    {16, 16, 4, wizard_hit_palette, {wizard_hit_rle_data + 0, wizard_hit_rle_data + 121}},
+    {16, 16, 4, wizard_hit_palette, {wizard_hit_rle_data + 242, wizard_hit_rle_data + 363}},
+    {16, 16, 4, wizard_hit_palette, {wizard_hit_rle_data + 484, wizard_hit_rle_data + 605}},
+};
+
+// wizard_attack: 6 frames of 16x16, 255 colours
+static const unsigned short int wizard_attack_palette[256] = {
+    0x0000, 0x0841, 0x18E4, 0x2966, 0x20E3, 0x0861, 0x4A6A, 0x636D, 0x528A, 0x10C3, 0x630C, 0xBB85, 
+    0x4A07, 0x4AAB, 0x4A8A, 0x31A6, 0x5B0C, 0x52CB, 0x3A08, 0x322A, 0x9B88, 0x8A84, 0x0021, 0x10A3, 
+    0x6B8E, 0x31A7, 0x1904, 0x1082, 0x7C10, 0x9D55, 0x632C, 0x638E, 0x0882, 0x18A2, 0x0820, 0x6BD0, 
+    0x6A67, 0x8329, 0x84B4, 0x7A03, 0x6AEA, 0x10E4, 0x18E3, 0x8CB4, 0x732B, 0x7A65, 0x3A2A, 0x1062, 
+    0x1863, 0x0020, 0x1042, 0x5B2D, 0x736D, 0xAAC3, 0x52AB, 0x0862, 0x1862, 0x3885, 0x810C, 0x6128, 
+    0x6909, 0x0821, 0x38A5, 0x790A, 0x5107, 0x60E9, 0x52EC, 0x73CF, 0xDC88, 0x62AA, 0x690A, 0x48E8, 
+    0x2885, 0x50C8, 0x40C7, 0x2884, 0x78CB, 0x5965, 0x5908, 0x790B, 0x912C, 0x7987, 0x1063, 0x1022, 
+    0x5AEC, 0x73EF, 0xD4A9, 0x5AAA, 0x912D, 0x5927, 0x40A6, 0x890D, 0x4906, 0x4125, 0x48E7, 0x70EB, 
+    0x3103, 0x70EA, 0x90ED, 0x5907, 0x1021, 0x28C4, 0x68CA, 0xB16E, 0x9A27, 0x38C2, 0x1061, 0x58C9, 
+    0x7129, 0x5108, 0x48A5, 0x63D0, 0xCC68, 0x68EA, 0x30A6, 0x3923, 0x71A6, 0x40E6, 0x58E9, 0x5966, 
+    0x5184, 0x58E8, 0x1041, 0x3962, 0x7988, 0x890C, 0xA14C, 0x99AA, 0x0842, 0x2084, 0x990E, 0x6127, 
+    0x7940, 0x1861, 0x78EC, 0x6986, 0x0881, 0x3942, 0x73F0, 0x8B49, 0xEBA3, 0x5ACB, 0x3084, 0xA12D, 
+    0x998A, 0x4868, 0x18A3, 0x1883, 0x68A9, 0x90EC, 0x8148, 0x38E7, 0x3229, 0x40C6, 0x88AC, 0x914A, 
+    0x60C8, 0x2187, 0x4A8B, 0x2986, 0x812B, 0x90CF, 0xB20B, 0x6925, 0x48E1, 0x810B, 0x90AF, 0xBA0B, 
+    0x5163, 0x30A1, 0x0840, 0x0041, 0x90CD, 0x61AA, 0x538E, 0x6C52, 0x5983, 0x6A04, 0x7C32, 0x10A2, 
+    0x40A5, 0x616A, 0x50A6, 0x41E8, 0x5B0B, 0x40C5, 0x60EA, 0x3A4A, 0x59EA, 0x71AA, 0x636E, 0x70E9, 
+    0x4169, 0x426B, 0x718A, 0x49EA, 0x8349, 0x838B, 0x9A47, 0xBA69, 0x71E4, 0x30C1, 0x28A1, 0xC289, 
+    0x4962, 0x30A4, 0xA98D, 0xB1AC, 0xAA49, 0x71A9, 0x81C8, 0x28E2, 0x0042, 0x31C7, 0xA267, 0x3249, 
+    0x428A, 0xBB65, 0xBA88, 0x82C5, 0x62A8, 0x3A6A, 0x2103, 0x8284, 0xA247, 0x9AA7, 0x82C6, 0x4AAA, 
+    0x29A7, 0x5141, 0x8309, 0x2166, 0x5901, 0x3901, 0x18C1, 0x81C3, 0x9284, 0x8244, 0x8A24, 0x9244, 
+    0x9245, 0x6162, 0x2081, 0x20A2, 0x1925, 0x40C1, 0x5143, 0x20E1, 0x28C1, 0x40A0, 0x6101, 0x0022, 
+    0x3101, 0x20C1, 0x20A1, 0x7900, 
+};
+static const unsigned char wizard_attack_rle_data[1200] = {
+    0x00, 0x00, 0x01, 0x0A, 0x03, 0x01, 0x02, 0x01, 0x01, 0x0A, 0x04, 0x06, 0x07, 0x08, 0x05, 0x01, 
+    0x0A, 0x04, 0x13, 0x14, 0x15, 0x16, 0x01, 0x0A, 0x03, 0x20, 0x08, 0x21, 0x01, 0x0B, 0x02, 0x02, 
+    0x0E, 0x01, 0x0C, 0x02, 0x0D, 0x2A, 0x02, 0x07, 0x03, 0x2F, 0x30, 0x31, 0x02, 0x02, 0x0E, 0x2A, 
+    0x02, 0x06, 0x05, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x01, 0x01, 0x05, 0x01, 0x05, 0x06, 0x2F, 0x46, 
+    0x4C, 0x4D, 0x4E, 0x30, 0x01, 0x05, 0x06, 0x16, 0x05, 0x61, 0x62, 0x63, 0x3D, 0x01, 0x06, 0x05, 
+    0x4B, 0x7D, 0x7E, 0x7F, 0x80, 0x01, 0x05, 0x06, 0x01, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0x01, 0x05, 
+    0x06, 0x6A, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0x01, 0x04, 0x04, 0x22, 0xE8, 0xE9, 0xEA, 0x00, 0x00, 
+    0x01, 0x03, 0x03, 0x01, 0x02, 0x01, 0x01, 0x02, 0x04, 0x05, 0x08, 0x07, 0x06, 0x01, 0x02, 0x04, 
+    0x16, 0x15, 0x14, 0x13, 0x01, 0x03, 0x03, 0x21, 0x08, 0x20, 0x01, 0x03, 0x02, 0x0E, 0x02, 0x01, 
+    0x02, 0x02, 0x2A, 0x0D, 0x02, 0x02, 0x02, 0x2A, 0x0E, 0x02, 0x03, 0x31, 0x30, 0x2F, 0x02, 0x03, 
+    0x01, 0x05, 0x01, 0x05, 0x3D, 0x3C, 0x3B, 0x3A, 0x39, 0x01, 0x05, 0x06, 0x30, 0x4E, 0x4D, 0x4C, 
+    0x46, 0x2F, 0x01, 0x05, 0x06, 0x3D, 0x63, 0x62, 0x61, 0x05, 0x16, 0x01, 0x05, 0x05, 0x80, 0x7F, 
+    0x7E, 0x7D, 0x4B, 0x01, 0x05, 0x06, 0xA4, 0xA3, 0xA2, 0xA1, 0xA0, 0x01, 0x01, 0x05, 0x06, 0xCA, 
+    0xC9, 0xC8, 0xC7, 0xC6, 0x6A, 0x01, 0x08, 0x04, 0xEA, 0xE9, 0xE8, 0x22, 0x00, 0x00, 0x02, 0x02, 
+    0x02, 0x03, 0x04, 0x01, 0x02, 0x02, 0x05, 0x01, 0x01, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 
+    0x0E, 0x01, 0x02, 0x01, 0x04, 0x17, 0x18, 0x10, 0x19, 0x01, 0x03, 0x01, 0x1A, 0x16, 0x01, 0x02, 
+    0x02, 0x17, 0x09, 0x00, 0x00, 0x01, 0x07, 0x03, 0x32, 0x30, 0x22, 0x01, 0x06, 0x05, 0x3E, 0x3F, 
+    0x40, 0x41, 0x3D, 0x01, 0x05, 0x06, 0x2F, 0x4F, 0x50, 0x51, 0x4F, 0x52, 0x01, 0x05, 0x07, 0x64, 
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x01, 0x06, 0x06, 0x81, 0x7D, 0x82, 0x83, 0x84, 0x85, 0x01, 
+    0x05, 0x07, 0x01, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0x01, 0x05, 0x04, 0x6A, 0xC6, 0xCB, 0xCC, 
+    0x01, 0x04, 0x04, 0x22, 0xE8, 0xE9, 0xEA, 0x00, 0x00, 0x02, 0x09, 0x02, 0x05, 0x02, 0x01, 0x02, 
+    0x04, 0x03, 0x01, 0x07, 0x08, 0x01, 0x0E, 0x0E, 0x0D, 0x0C, 0x0B, 0x0A, 0x09, 0x02, 0x07, 0x03, 
+    0x16, 0x1A, 0x01, 0x01, 0x04, 0x19, 0x10, 0x18, 0x17, 0x01, 0x0C, 0x02, 0x09, 0x17, 0x00, 0x00, 
+    0x01, 0x06, 0x03, 0x22, 0x30, 0x32, 0x01, 0x05, 0x05, 0x3D, 0x41, 0x40, 0x3F, 0x3E, 0x01, 0x05, 
+    0x06, 0x52, 0x4F, 0x51, 0x50, 0x4F, 0x2F, 0x01, 0x04, 0x07, 0x6A, 0x69, 0x68, 0x67, 0x66, 0x65, 
+    0x64, 0x01, 0x04, 0x06, 0x85, 0x84, 0x83, 0x82, 0x7D, 0x81, 0x01, 0x04, 0x07, 0xAA, 0xA9, 0xA8, 
+    0xA7, 0xA6, 0xA5, 0x01, 0x01, 0x07, 0x04, 0xCC, 0xCB, 0xC6, 0x6A, 0x01, 0x08, 0x04, 0xEA, 0xE9, 
+    0xE8, 0x22, 0x00, 0x00, 0x00, 0x01, 0x08, 0x04, 0x0F, 0x10, 0x11, 0x12, 0x01, 0x08, 0x06, 0x1B, 
+    0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x01, 0x09, 0x05, 0x22, 0x23, 0x24, 0x25, 0x0D, 0x01, 0x0A, 0x05, 
+    0x0F, 0x26, 0x27, 0x28, 0x29, 0x01, 0x0A, 0x05, 0x05, 0x2B, 0x2C, 0x2D, 0x2E, 0x01, 0x0B, 0x05, 
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x01, 0x0B, 0x05, 0x42, 0x43, 0x44, 0x45, 0x1A, 0x01, 0x08, 0x08, 
+    0x32, 0x30, 0x53, 0x54, 0x55, 0x56, 0x57, 0x02, 0x01, 0x06, 0x0A, 0x3D, 0x6B, 0x6C, 0x6D, 0x6E, 
+    0x54, 0x6F, 0x70, 0x45, 0x02, 0x01, 0x06, 0x0A, 0x5E, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 
+    0x8D, 0x02, 0x01, 0x06, 0x0A, 0xAB, 0x72, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0x01, 
+    0x06, 0x09, 0xCD, 0xCE, 0xCF, 0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0x01, 0x04, 0x0A, 0x22, 0x69, 
+    0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0xF1, 0xF2, 0x00, 0x00, 0x00, 0x01, 0x04, 0x04, 0x12, 0x11, 
+    0x10, 0x0F, 0x01, 0x02, 0x06, 0x20, 0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x01, 0x02, 0x05, 0x0D, 0x25, 
+    0x24, 0x23, 0x22, 0x01, 0x01, 0x05, 0x29, 0x28, 0x27, 0x26, 0x0F, 0x01, 0x01, 0x05, 0x2E, 0x2D, 
+    0x2C, 0x2B, 0x05, 0x01, 0x00, 0x05, 0x37, 0x36, 0x35, 0x34, 0x33, 0x01, 0x00, 0x05, 0x1A, 0x45, 
+    0x44, 0x43, 0x42, 0x01, 0x00, 0x08, 0x02, 0x57, 0x56, 0x55, 0x54, 0x53, 0x30, 0x32, 0x01, 0x00, 
+    0x0A, 0x02, 0x45, 0x70, 0x6F, 0x54, 0x6E, 0x6D, 0x6C, 0x6B, 0x3D, 0x01, 0x00, 0x0A, 0x02, 0x8D, 
+    0x8C, 0x8B, 0x8A, 0x89, 0x88, 0x87, 0x86, 0x5E, 0x01, 0x00, 0x0A, 0xB3, 0xB2, 0xB1, 0xB0, 0xAF, 
+    0xAE, 0xAD, 0xAC, 0x72, 0xAB, 0x01, 0x01, 0x09, 0xD5, 0xD4, 0xD3, 0xD2, 0xD1, 0xD0, 0xCF, 0xCE, 
+    0xCD, 0x01, 0x02, 0x0A, 0xF2, 0xF1, 0xF0, 0xEF, 0xEE, 0xED, 0xEC, 0xEB, 0x69, 0x22, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x02, 0x2F, 0x38, 0x01, 0x05, 0x04, 0x3E, 0x46, 
+    0x47, 0x48, 0x01, 0x04, 0x06, 0x2F, 0x58, 0x17, 0x04, 0x59, 0x31, 0x01, 0x04, 0x06, 0x31, 0x71, 
+    0x72, 0x73, 0x74, 0x22, 0x01, 0x04, 0x07, 0x8E, 0x4C, 0x8F, 0x90, 0x91, 0x09, 0x92, 0x01, 0x03, 
+    0x09, 0xB4, 0x5F, 0xB5, 0x4E, 0xB6, 0xB7, 0xB8, 0x18, 0x17, 0x01, 0x02, 0x0A, 0x05, 0xD6, 0xD2, 
+    0xD7, 0xD8, 0xD8, 0x0C, 0xD9, 0x10, 0x09, 0x02, 0x01, 0x04, 0x31, 0xE8, 0xE9, 0xF3, 0x01, 0x05, 
+    0x1B, 0xF4, 0xF5, 0xF6, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x02, 
+    0x38, 0x2F, 0x01, 0x07, 0x04, 0x48, 0x47, 0x46, 0x3E, 0x01, 0x06, 0x06, 0x31, 0x59, 0x04, 0x17, 
+    0x58, 0x2F, 0x01, 0x06, 0x06, 0x22, 0x74, 0x73, 0x72, 0x71, 0x31, 0x01, 0x05, 0x07, 0x92, 0x09, 
+    0x91, 0x90, 0x8F, 0x4C, 0x8E, 0x01, 0x04, 0x09, 0x17, 0x18, 0xB8, 0xB7, 0xB6, 0x4E, 0xB5, 0x5F, 
+    0xB4, 0x01, 0x04, 0x0A, 0x09, 0x10, 0xD9, 0x0C, 0xD8, 0xD8, 0xD7, 0xD2, 0xD6, 0x05, 0x02, 0x05, 
+    0x05, 0x9F, 0xF6, 0xF5, 0xF4, 0x1B, 0x01, 0x04, 0xF3, 0xE9, 0xE8, 0x31, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x04, 0x2F, 0x49, 0x4A, 0x3D, 0x01, 0x04, 0x06, 0x31, 
+    0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x01, 0x04, 0x06, 0x01, 0x75, 0x76, 0x77, 0x78, 0x79, 0x01, 0x05, 
+    0x08, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x06, 0x01, 0x01, 0x04, 0x09, 0xB9, 0xBA, 0xBB, 0xBC, 
+    0xBD, 0x08, 0x14, 0xBE, 0x02, 0x01, 0x04, 0x09, 0x78, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF, 0x08, 
+    0x05, 0x01, 0x03, 0x09, 0xCA, 0xE8, 0xF7, 0xF8, 0x6A, 0xF9, 0xFA, 0xFB, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x04, 0x3D, 0x4A, 0x49, 0x2F, 0x01, 0x06, 0x06, 
+    0x5E, 0x5D, 0x5C, 0x5B, 0x5A, 0x31, 0x01, 0x06, 0x06, 0x79, 0x78, 0x77, 0x76, 0x75, 0x01, 0x01, 
+    0x03, 0x08, 0x01, 0x06, 0x98, 0x97, 0x96, 0x95, 0x94, 0x93, 0x01, 0x03, 0x09, 0x02, 0xBE, 0x14, 
+    0x08, 0xBD, 0xBC, 0xBB, 0xBA, 0xB9, 0x01, 0x03, 0x09, 0x05, 0x08, 0xDF, 0xDE, 0xDD, 0xDC, 0xDB, 
+    0xDA, 0x78, 0x01, 0x04, 0x09, 0x01, 0xFB, 0xFA, 0xF9, 0x6A, 0xF8, 0xF7, 0xE8, 0xCA, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x04, 0x31, 0x3E, 0x49, 0x4B, 0x01, 0x05, 
+    0x06, 0x3D, 0x5F, 0x3F, 0x60, 0x3B, 0x38, 0x01, 0x05, 0x06, 0x7A, 0x4A, 0x6C, 0x7B, 0x7C, 0x53, 
+    0x01, 0x05, 0x08, 0x31, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F, 0x01, 0x04, 0x09, 0x01, 0xBF, 
+    0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0x0D, 0x01, 0x04, 0x09, 0x6A, 0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 
+    0xE5, 0xE6, 0xE7, 0x01, 0x03, 0x09, 0x22, 0xE8, 0xFC, 0xFD, 0xFE, 0xF9, 0xFF, 0x16, 0xD4, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x04, 0x4B, 0x49, 0x3E, 0x31, 0x01, 
+    0x05, 0x06, 0x38, 0x3B, 0x60, 0x3F, 0x5F, 0x3D, 0x01, 0x05, 0x06, 0x53, 0x7C, 0x7B, 0x6C, 0x4A, 
+    0x7A, 0x01, 0x03, 0x08, 0x9F, 0x9E, 0x9D, 0x9C, 0x9B, 0x9A, 0x99, 0x31, 0x01, 0x03, 0x09, 0x0D, 
+    0xC5, 0xC4, 0xC3, 0xC2, 0xC1, 0xC0, 0xBF, 0x01, 0x01, 0x03, 0x09, 0xE7, 0xE6, 0xE5, 0xE4, 0xE3, 
+    0xE2, 0xE1, 0xE0, 0x6A, 0x01, 0x04, 0x09, 0xD4, 0x16, 0xFF, 0xF9, 0xFE, 0xFD, 0xFC, 0xE8, 0x22, 
+};
+const RLESprite wizard_attack_rle[6] = {
+    {16, 16, 8, wizard_attack_palette, {wizard_attack_rle_data + 0, wizard_attack_rle_data + 110}},
+    {16, 16, 8, wizard_attack_palette, {wizard_attack_rle_data + 220, wizard_attack_rle_data + 327}},
+    {16, 16, 8, wizard_attack_palette, {wizard_attack_rle_data + 434, wizard_attack_rle_data + 568}},
+    {16, 16, 8, wizard_attack_palette, {wizard_attack_rle_data + 702, wizard_attack_rle_data + 789}},
+    {16, 16, 8, wizard_attack_palette, {wizard_attack_rle_data + 876, wizard_attack_rle_data + 957}},
+    {16, 16, 8, wizard_attack_palette, {wizard_attack_rle_data + 1038, wizard_attack_rle_data + 1119}},
+};
+
+// wizard_dying: 6 frames of 16x16, 4 colours
+static const unsigned short int wizard_dying_palette[5] = {
+    0x0000, 0x10A3, 0x910D, 0xFC24, 0x7920, 
+};
+static const unsigned char wizard_dying_rle_data[1278] = {
+    0x01, 0x03, 0x06, 0x11, 0x11, 0x11, 0x01, 0x02, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x01, 0x0A, 
+    0x21, 0x22, 0x12, 0x21, 0x12, 0x01, 0x01, 0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 0x01, 0x02, 0x09, 
+    0x11, 0x22, 0x11, 0x21, 0x01, 0x01, 0x03, 0x08, 0x21, 0x22, 0x11, 0x12, 0x01, 0x04, 0x06, 0x21, 
+    0x22, 0x13, 0x01, 0x04, 0x07, 0x21, 0x22, 0x22, 0x01, 0x01, 0x03, 0x09, 0x21, 0x22, 0x22, 0x22, 
+    0x01, 0x01, 0x02, 0x0A, 0x21, 0x22, 0x22, 0x32, 0x12, 0x01, 0x02, 0x0A, 0x21, 0x22, 0x22, 0x22, 
+    0x12, 0x01, 0x02, 0x0A, 0x31, 0x23, 0x22, 0x22, 0x12, 0x01, 0x03, 0x09, 0x11, 0x33, 0x33, 0x33, 
+    0x01, 0x01, 0x03, 0x08, 0x41, 0x11, 0x11, 0x11, 0x02, 0x03, 0x03, 0x41, 0x01, 0x02, 0x03, 0x41, 
+    0x01, 0x02, 0x04, 0x01, 0x01, 0x03, 0x04, 0x41, 0x14, 0x01, 0x07, 0x06, 0x11, 0x11, 0x11, 0x01, 
+    0x06, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x05, 0x0A, 0x21, 0x12, 0x21, 0x22, 0x12, 0x01, 0x05, 
+    0x0A, 0x21, 0x11, 0x11, 0x22, 0x12, 0x01, 0x05, 0x09, 0x21, 0x11, 0x21, 0x12, 0x01, 0x01, 0x05, 
+    0x08, 0x21, 0x11, 0x22, 0x12, 0x01, 0x06, 0x06, 0x31, 0x22, 0x12, 0x01, 0x05, 0x07, 0x21, 0x22, 
+    0x22, 0x01, 0x01, 0x04, 0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x04, 0x0A, 0x21, 0x23, 0x22, 
+    0x22, 0x12, 0x01, 0x04, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x04, 0x0A, 0x21, 0x22, 0x22, 
+    0x32, 0x13, 0x01, 0x04, 0x09, 0x31, 0x33, 0x33, 0x13, 0x01, 0x01, 0x05, 0x08, 0x11, 0x11, 0x11, 
+    0x14, 0x02, 0x05, 0x03, 0x41, 0x01, 0x02, 0x03, 0x41, 0x01, 0x02, 0x04, 0x04, 0x41, 0x14, 0x03, 
+    0x01, 0x01, 0x01, 0x05, 0x06, 0x11, 0x11, 0x11, 0x01, 0x04, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 
+    0x03, 0x0A, 0x21, 0x22, 0x12, 0x21, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x22, 0x11, 0x11, 0x12, 0x01, 
+    0x04, 0x09, 0x11, 0x22, 0x11, 0x21, 0x01, 0x01, 0x05, 0x08, 0x21, 0x22, 0x11, 0x12, 0x01, 0x06, 
+    0x06, 0x21, 0x22, 0x13, 0x01, 0x06, 0x07, 0x21, 0x22, 0x22, 0x01, 0x01, 0x05, 0x09, 0x21, 0x22, 
+    0x22, 0x22, 0x01, 0x01, 0x04, 0x0A, 0x21, 0x22, 0x22, 0x32, 0x12, 0x01, 0x04, 0x0A, 0x21, 0x22, 
+    0x22, 0x22, 0x12, 0x01, 0x04, 0x0A, 0x31, 0x23, 0x22, 0x22, 0x12, 0x01, 0x05, 0x09, 0x11, 0x33, 
+    0x33, 0x33, 0x01, 0x01, 0x05, 0x08, 0x41, 0x11, 0x11, 0x11, 0x02, 0x05, 0x03, 0x41, 0x01, 0x02, 
+    0x03, 0x41, 0x01, 0x02, 0x06, 0x01, 0x01, 0x03, 0x04, 0x41, 0x14, 0x01, 0x05, 0x06, 0x11, 0x11, 
+    0x11, 0x01, 0x04, 0x08, 0x21, 0x22, 0x22, 0x12, 0x01, 0x03, 0x0A, 0x21, 0x12, 0x21, 0x22, 0x12, 
+    0x01, 0x03, 0x0A, 0x21, 0x11, 0x11, 0x22, 0x12, 0x01, 0x03, 0x09, 0x21, 0x11, 0x21, 0x12, 0x01, 
+    0x01, 0x03, 0x08, 0x21, 0x11, 0x22, 0x12, 0x01, 0x04, 0x06, 0x31, 0x22, 0x12, 0x01, 0x03, 0x07, 
+    0x21, 0x22, 0x22, 0x01, 0x01, 0x02, 0x09, 0x21, 0x22, 0x22, 0x22, 0x01, 0x01, 0x02, 0x0A, 0x21, 
+    0x23, 0x22, 0x22, 0x12, 0x01, 0x02, 0x0A, 0x21, 0x22, 0x22, 0x22, 0x12, 0x01, 0x02, 0x0A, 0x21, 
+    0x22, 0x22, 0x32, 0x13, 0x01, 0x02, 0x09, 0x31, 0x33, 0x33, 0x13, 0x01, 0x01, 0x03, 0x08, 0x11, 
+    0x11, 0x11, 0x14, 0x02, 0x03, 0x03, 0x41, 0x01, 0x02, 0x03, 0x41, 0x01, 0x02, 0x02, 0x04, 0x41, 
+    0x14, 0x03, 0x01, 0x01, 0x00, 0x01, 0x04, 0x04, 0x11, 0x11, 0x01, 0x03, 0x06, 0x21, 0x22, 0x12, 
+    0x01, 0x02, 0x08, 0x21, 0x12, 0x21, 0x12, 0x01, 0x02, 0x09, 0x21, 0x11, 0x11, 0x22, 0x01, 0x01, 
+    0x02, 0x0A, 0x21, 0x12, 0x11, 0x12, 0x12, 0x01, 0x02, 0x0A, 0x21, 0x22, 0x21, 0x12, 0x11, 0x01, 
+    0x03, 0x0B, 0x21, 0x32, 0x12, 0x22, 0x12, 0x01, 0x01, 0x04, 0x0B, 0x21, 0x22, 0x22, 0x22, 0x32, 
+    0x01, 0x01, 0x04, 0x0C, 0x21, 0x22, 0x23, 0x22, 0x32, 0x11, 0x01, 0x04, 0x0C, 0x21, 0x22, 0x22, 
+    0x22, 0x32, 0x41, 0x01, 0x05, 0x0B, 0x21, 0x22, 0x22, 0x32, 0x11, 0x01, 0x01, 0x05, 0x08, 0x31, 
+    0x33, 0x33, 0x13, 0x01, 0x06, 0x06, 0x11, 0x11, 0x11, 0x01, 0x09, 0x03, 0x41, 0x01, 0x01, 0x0A, 
+    0x01, 0x01, 0x00, 0x01, 0x08, 0x04, 0x11, 0x11, 0x01, 0x07, 0x06, 0x21, 0x22, 0x12, 0x01, 0x06, 
+    0x08, 0x21, 0x12, 0x21, 0x12, 0x01, 0x05, 0x09, 0x21, 0x12, 0x11, 0x21, 0x01, 0x01, 0x04, 0x0A, 
+    0x21, 0x21, 0x11, 0x21, 0x12, 0x01, 0x04, 0x0A, 0x11, 0x21, 0x12, 0x22, 0x12, 0x01, 0x02, 0x0B, 
+    0x11, 0x22, 0x12, 0x32, 0x22, 0x01, 0x01, 0x01, 0x0B, 0x31, 0x22, 0x22, 0x22, 0x22, 0x01, 0x01, 
+    0x00, 0x0C, 0x11, 0x23, 0x22, 0x32, 0x22, 0x12, 0x01, 0x00, 0x0C, 0x14, 0x23, 0x22, 0x22, 0x22, 
+    0x12, 0x01, 0x00, 0x0B, 0x11, 0x31, 0x22, 0x22, 0x22, 0x01, 0x01, 0x03, 0x08, 0x31, 0x33, 0x33, 
+    0x13, 0x01, 0x04, 0x06, 0x11, 0x11, 0x11, 0x01, 0x04, 0x03, 0x41, 0x01, 0x01, 0x05, 0x01, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x02, 0x11, 0x02, 0x03, 0x04, 0x21, 0x12, 0x04, 
+    0x02, 0x11, 0x02, 0x02, 0x05, 0x21, 0x22, 0x01, 0x03, 0x05, 0x21, 0x13, 0x01, 0x02, 0x02, 0x05, 
+    0x21, 0x22, 0x01, 0x01, 0x08, 0x11, 0x22, 0x13, 0x14, 0x01, 0x01, 0x0E, 0x21, 0x22, 0x22, 0x21, 
+    0x22, 0x32, 0x11, 0x01, 0x00, 0x0E, 0x21, 0x11, 0x11, 0x22, 0x22, 0x22, 0x13, 0x01, 0x00, 0x0F, 
+    0x21, 0x11, 0x11, 0x22, 0x22, 0x23, 0x13, 0x01, 0x01, 0x00, 0x10, 0x21, 0x11, 0x11, 0x31, 0x22, 
+    0x22, 0x13, 0x14, 0x01, 0x00, 0x10, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x13, 0x11, 0x01, 0x01, 
+    0x0D, 0x21, 0x22, 0x22, 0x22, 0x22, 0x32, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0A, 
+    0x02, 0x11, 0x02, 0x03, 0x02, 0x11, 0x04, 0x04, 0x21, 0x12, 0x02, 0x01, 0x05, 0x11, 0x23, 0x01, 
+    0x03, 0x05, 0x21, 0x22, 0x01, 0x02, 0x00, 0x08, 0x41, 0x31, 0x22, 0x11, 0x01, 0x05, 0x21, 0x22, 
+    0x01, 0x01, 0x01, 0x0E, 0x11, 0x23, 0x22, 0x12, 0x22, 0x22, 0x12, 0x01, 0x02, 0x0E, 0x31, 0x22, 
+    0x22, 0x22, 0x11, 0x11, 0x12, 0x01, 0x01, 0x0F, 0x11, 0x23, 0x23, 0x22, 0x12, 0x11, 0x21, 0x01, 
+    0x01, 0x00, 0x10, 0x41, 0x31, 0x22, 0x22, 0x13, 0x11, 0x11, 0x12, 0x01, 0x00, 0x10, 0x11, 0x31, 
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x12, 0x01, 0x02, 0x0D, 0x31, 0x22, 0x22, 0x22, 0x22, 0x22, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x02, 0x11, 0x02, 0x03, 0x04, 0x21, 0x12, 0x04, 
+    0x03, 0x11, 0x01, 0x02, 0x02, 0x05, 0x21, 0x22, 0x01, 0x01, 0x06, 0x11, 0x21, 0x13, 0x01, 0x01, 
+    0x0D, 0x21, 0x22, 0x11, 0x21, 0x22, 0x32, 0x01, 0x01, 0x00, 0x0F, 0x21, 0x12, 0x21, 0x22, 0x22, 
+    0x22, 0x13, 0x01, 0x01, 0x00, 0x10, 0x21, 0x11, 0x11, 0x22, 0x22, 0x22, 0x13, 0x14, 0x01, 0x00, 
+    0x10, 0x21, 0x11, 0x11, 0x31, 0x22, 0x22, 0x13, 0x41, 0x01, 0x00, 0x10, 0x21, 0x12, 0x11, 0x22, 
+    0x22, 0x23, 0x13, 0x14, 0x01, 0x01, 0x0F, 0x21, 0x22, 0x22, 0x22, 0x22, 0x32, 0x41, 0x01, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x02, 0x11, 0x02, 0x02, 0x03, 0x11, 0x01, 0x04, 
+    0x04, 0x21, 0x12, 0x02, 0x02, 0x06, 0x31, 0x12, 0x11, 0x01, 0x05, 0x21, 0x22, 0x01, 0x01, 0x02, 
+    0x0D, 0x31, 0x22, 0x22, 0x11, 0x21, 0x22, 0x01, 0x01, 0x01, 0x0F, 0x11, 0x23, 0x22, 0x22, 0x22, 
+    0x11, 0x22, 0x01, 0x01, 0x00, 0x10, 0x41, 0x31, 0x22, 0x22, 0x22, 0x11, 0x11, 0x12, 0x01, 0x00, 
+    0x10, 0x14, 0x31, 0x22, 0x22, 0x13, 0x11, 0x11, 0x12, 0x01, 0x00, 0x10, 0x41, 0x31, 0x32, 0x22, 
+    0x22, 0x11, 0x21, 0x12, 0x01, 0x00, 0x0F, 0x41, 0x31, 0x22, 0x22, 0x22, 0x22, 0x22, 0x01, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x04, 0x11, 0x11, 0x02, 0x02, 0x05, 
+    0x21, 0x22, 0x01, 0x01, 0x06, 0x11, 0x11, 0x11, 0x01, 0x01, 0x0D, 0x21, 0x22, 0x11, 0x21, 0x22, 
+    0x32, 0x01, 0x01, 0x00, 0x0E, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x13, 0x01, 0x00, 0x0E, 0x21, 
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x13, 0x01, 0x00, 0x0F, 0x21, 0x11, 0x11, 0x21, 0x22, 0x22, 0x13, 
+    0x01, 0x01, 0x00, 0x10, 0x21, 0x12, 0x11, 0x32, 0x22, 0x22, 0x13, 0x14, 0x01, 0x01, 0x0F, 0x21, 
+    0x22, 0x22, 0x22, 0x32, 0x32, 0x41, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+    0x09, 0x04, 0x11, 0x11, 0x02, 0x02, 0x06, 0x11, 0x11, 0x11, 0x01, 0x05, 0x21, 0x22, 0x01, 0x01, 
+    0x02, 0x0D, 0x31, 0x22, 0x22, 0x11, 0x21, 0x22, 0x01, 0x01, 0x02, 0x0E, 0x31, 0x22, 0x22, 0x22, 
+    0x22, 0x22, 0x12, 0x01, 0x02, 0x0E, 0x31, 0x22, 0x22, 0x22, 0x22, 0x22, 0x12, 0x01, 0x01, 0x0F, 
+    0x11, 0x23, 0x22, 0x22, 0x11, 0x11, 0x21, 0x01, 0x01, 0x00, 0x10, 0x41, 0x31, 0x22, 0x22, 0x23, 
+    0x11, 0x21, 0x12, 0x01, 0x00, 0x0F, 0x41, 0x31, 0x32, 0x22, 0x22, 0x22, 0x22, 0x01, 
+};
+const RLESprite wizard_dying_rle[6] = {
+    {16, 16, 4, wizard_dying_palette, {wizard_dying_rle_data + 0, wizard_dying_rle_data + 121}},
+    {16, 16, 4, wizard_dying_palette, {wizard_dying_rle_data + 242, wizard_dying_rle_data + 363}},
+    {16, 16, 4, wizard_dying_palette, {wizard_dying_rle_data + 484, wizard_dying_rle_data + 594}},
+    {16, 16, 4, wizard_dying_palette, {wizard_dying_rle_data + 704, wizard_dying_rle_data + 808}},
+    {16, 16, 4, wizard_dying_palette, {wizard_dying_rle_data + 912, wizard_dying_rle_data + 1008}},
+    {16, 16, 4, wizard_dying_palette, {wizard_dying_rle_data + 1104, wizard_dying_rle_data + 1191}},
+};
+
+// wizard_decomposing: 6 frames of 16x16, 4 colours
+static const unsigned short int wizard_decomposing_palette[5] = {
+    0x0000, 0x10A3, 0x910D, 0xFC24, 0x7920, 
+};
+static const unsigned char wizard_decomposing_rle_data[996] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x11, 0x01, 0x02, 0x01, 
+    0x01, 0x01, 0x02, 0x0A, 0x12, 0x11, 0x11, 0x11, 0x11, 0x02, 0x00, 0x01, 0x01, 0x02, 0x0B, 0x22, 
+    0x22, 0x22, 0x22, 0x32, 0x01, 0x01, 0x00, 0x0E, 0x21, 0x22, 0x22, 0x22, 0x22, 0x22, 0x13, 0x01, 
+    0x00, 0x0F, 0x21, 0x11, 0x11, 0x21, 0x22, 0x22, 0x13, 0x01, 0x01, 0x00, 0x10, 0x21, 0x11, 0x11, 
+    0x22, 0x22, 0x22, 0x13, 0x14, 0x01, 0x01, 0x0F, 0x21, 0x11, 0x21, 0x32, 0x32, 0x32, 0x41, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0B, 0x03, 0x11, 0x01, 0x02, 0x02, 
+    0x0A, 0x11, 0x11, 0x11, 0x11, 0x21, 0x02, 0x01, 0x01, 0x02, 0x02, 0x0B, 0x31, 0x22, 0x22, 0x22, 
+    0x22, 0x02, 0x02, 0x01, 0x01, 0x01, 0x02, 0x0E, 0x31, 0x22, 0x22, 0x22, 0x22, 0x22, 0x12, 0x01, 
+    0x01, 0x0F, 0x11, 0x23, 0x22, 0x22, 0x11, 0x11, 0x21, 0x01, 0x01, 0x00, 0x10, 0x41, 0x31, 0x22, 
+    0x22, 0x22, 0x11, 0x11, 0x12, 0x01, 0x00, 0x0F, 0x41, 0x31, 0x32, 0x32, 0x22, 0x11, 0x21, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x11, 0x11, 0x04, 0x01, 
+    0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x11, 0x04, 0x00, 0x01, 0x01, 0x04, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x11, 0x12, 0x01, 0x04, 0x00, 0x01, 0x01, 0x02, 0x02, 
+    0x11, 0x01, 0x02, 0x11, 0x01, 0x05, 0x21, 0x32, 0x01, 0x03, 0x00, 0x02, 0x11, 0x01, 0x02, 0x11, 
+    0x01, 0x09, 0x11, 0x11, 0x22, 0x13, 0x01, 0x03, 0x00, 0x03, 0x21, 0x01, 0x02, 0x09, 0x21, 0x22, 
+    0x22, 0x12, 0x01, 0x01, 0x01, 0x01, 0x03, 0x00, 0x0C, 0x21, 0x12, 0x21, 0x22, 0x22, 0x13, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0A, 
+    0x04, 0x11, 0x11, 0x04, 0x04, 0x02, 0x11, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 
+    0x04, 0x02, 0x05, 0x11, 0x12, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x04, 
+    0x02, 0x05, 0x31, 0x22, 0x01, 0x01, 0x02, 0x11, 0x01, 0x02, 0x11, 0x02, 0x01, 0x01, 0x03, 0x01, 
+    0x09, 0x11, 0x23, 0x12, 0x11, 0x01, 0x01, 0x02, 0x11, 0x01, 0x02, 0x11, 0x03, 0x00, 0x01, 0x01, 
+    0x01, 0x09, 0x11, 0x22, 0x22, 0x22, 0x01, 0x02, 0x03, 0x21, 0x01, 0x03, 0x00, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x0C, 0x31, 0x22, 0x22, 0x12, 0x21, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x11, 0x11, 0x04, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 
+    0x01, 0x01, 0x01, 0x02, 0x11, 0x05, 0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x03, 0x11, 0x01, 0x06, 0x00, 0x01, 0x01, 0x02, 0x02, 0x11, 0x01, 0x02, 0x11, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x00, 0x01, 0x01, 0x02, 0x02, 0x11, 
+    0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x11, 0x01, 0x01, 0x01, 0x04, 0x00, 0x01, 0x01, 
+    0x05, 0x06, 0x11, 0x11, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x01, 0x01, 0x01, 0x01, 
+    0x02, 0x11, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x04, 0x11, 0x11, 0x04, 
+    0x04, 0x02, 0x11, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x05, 0x02, 0x03, 0x11, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x06, 0x02, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x11, 0x01, 0x02, 0x11, 0x02, 0x01, 0x01, 
+    0x06, 0x01, 0x01, 0x01, 0x01, 0x02, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x11, 
+    0x02, 0x01, 0x01, 0x04, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x11, 0x11, 0x11, 0x05, 
+    0x01, 0x01, 0x07, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x02, 0x02, 0x11, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x01, 0x02, 0x04, 0x11, 0x11, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x04, 0x00, 0x01, 
+    0x01, 0x04, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x00, 0x02, 0x11, 0x01, 0x02, 
+    0x11, 0x01, 0x02, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x00, 0x01, 0x01, 0x02, 0x02, 
+    0x11, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x11, 0x03, 0x00, 0x01, 0x01, 0x05, 0x06, 
+    0x11, 0x11, 0x11, 0x01, 0x01, 0x01, 0x06, 0x01, 0x01, 0x01, 0x01, 0x02, 0x11, 0x02, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x01, 0x0A, 0x04, 0x11, 0x11, 0x02, 0x0A, 0x01, 0x01, 0x03, 0x01, 0x01, 0x04, 0x05, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x04, 0x01, 0x01, 0x05, 0x04, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x02, 0x11, 0x01, 0x02, 0x11, 0x01, 0x02, 0x11, 0x05, 0x03, 0x02, 0x11, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x11, 0x02, 0x01, 0x01, 0x03, 0x02, 0x01, 0x01, 0x01, 
+    0x06, 0x11, 0x11, 0x11, 0x05, 0x01, 0x01, 0x06, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x11, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x11, 0x11, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 
+    0x00, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x00, 0x02, 0x11, 0x01, 0x02, 0x11, 0x01, 0x02, 0x11, 
+    0x03, 0x00, 0x01, 0x01, 0x01, 0x03, 0x11, 0x01, 0x02, 0x01, 0x01, 0x02, 0x00, 0x01, 0x01, 0x05, 
+    0x03, 0x11, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x02, 0x11, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x04, 0x11, 0x11, 0x02, 0x0A, 
+    0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x0A, 0x01, 0x01, 0x04, 0x01, 0x01, 0x03, 0x08, 0x02, 0x11, 
+    0x01, 0x02, 0x11, 0x01, 0x02, 0x11, 0x03, 0x08, 0x01, 0x01, 0x02, 0x03, 0x11, 0x01, 0x01, 0x01, 
+    0x01, 0x02, 0x07, 0x03, 0x11, 0x01, 0x05, 0x01, 0x01, 0x04, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x02, 0x02, 0x11, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x01, 0x04, 0x02, 0x11, 0x02, 0x03, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x02, 
+    0x01, 0x01, 0x04, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x01, 0x0A, 0x02, 0x11, 0x02, 0x09, 0x01, 0x01, 0x02, 0x01, 0x01, 0x02, 0x08, 0x01, 
+    0x01, 0x04, 0x01, 0x01, 
+};
+const RLESprite wizard_decomposing_rle[6] = {
+    {16, 16, 4, wizard_decomposing_palette, {wizard_decomposing_rle_data + 0, wizard_decomposing_rle_data + 80}},
+    {16, 16, 4, wizard_decomposing_palette, {wizard_decomposing_rle_data + 160, wizard_decomposing_rle_data + 261}},
+    {16, 16, 4, wizard_decomposing_palette, {wizard_decomposing_rle_data + 362, wizard_decomposing_rle_data + 481}},
+    {16, 16, 4, wizard_decomposing_palette, {wizard_decomposing_rle_data + 600, wizard_decomposing_rle_data + 697}},
+    {16, 16, 4, wizard_decomposing_palette, {wizard_decomposing_rle_data + 794, wizard_decomposing_rle_data + 864}},
+    {16, 16, 4, wizard_decomposing_palette, {wizard_decomposing_rle_data + 934, wizard_decomposing_rle_data + 965}},
+};
+
+// bg: 396 tiles of 8x8
+static const unsigned short int bg_tiles[396][64] = {
+    {0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x54A8, 0x6D29, 
+     0x4C49, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x3C08, 0x5CC8, 0x856A, 
+     0x33C9, 0x5449, 0x856A, 0x6D09, 0x43A8, 0x5B69, 0x856A, 0x856A, 
+     0x5449, 0x856A, 0x856A, 0x64C9, 0x3329, 0x3AC9, 0x5449, 0x856A, 
+     0x5B69, 0x856A, 0x856A, 0x6C29, 0x4249, 0x4249, 0x4249, 0x5B69, 
+     0x5B69, 0x856A, 0x748A, 0x4ACB, 0x4A8A, 0x530C, 0x530C, 0x4ACB, 
+     0x6BEE, 0x6BEE, 0x5B4C, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x6BEE, 0x638D, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, },
+    {0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 
+     0x64C9, 0x33C9, 0x3C08, 0x54A8, 0x7549, 0x6D09, 0x4467, 0x4467, 
+     0x856A, 0x64C9, 0x33C9, 0x3C08, 0x5CC8, 0x856A, 0x64C9, 0x33C9, 
+     0x856A, 0x6C29, 0x3AC9, 0x5449, 0x856A, 0x856A, 0x64C9, 0x3329, 
+     0x856A, 0x6C29, 0x4249, 0x5B69, 0x856A, 0x64C9, 0x3329, 0x4249, 
+     0x4A8A, 0x530C, 0x4ACB, 0x4249, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x8C8E, 0x530C, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0xAD8F, 0x8C8E, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, },
+    {0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x4467, 0x4467, 
+     0x4467, 0x5CC8, 0x856A, 0x6D09, 0x4467, 0x3C28, 0x3C08, 0x6CCA, 
+     0x5449, 0x856A, 0x856A, 0x856A, 0x64C9, 0x33C9, 0x3B8A, 0x73ED, 
+     0x3AC9, 0x5449, 0x856A, 0x856A, 0x6C29, 0x4249, 0x4A8A, 0x738D, 
+     0x4249, 0x4249, 0x5B69, 0x856A, 0x6C29, 0x52CB, 0x638D, 0x5B6D, 
+     0x8C8E, 0x530C, 0x4ACB, 0x4A8A, 0x5B6D, 0x6BEE, 0x5B4C, 0x4A8A, 
+     0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 
+     0xAD8F, 0xAD0E, 0x83ED, 0x5B6D, 0x6BEE, 0x848F, 0xAD8F, 0xAD8F, },
+    {0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAD8F, 0x850C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAD8F, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA4CE, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7C0E, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5B6D, 0x5C0C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x850C, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAD0E, 0x7C6C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0x9E18, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x652F, 0xAE79, 0x8DB7, 0x544F, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x652F, 
+     0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x54CD, 
+     0x3C68, 0x4CA8, 0x85AF, 0xAE79, 0xAE79, 0x95F3, 0x5CE9, 0x3C68, 
+     0x4CA8, 0x85AF, 0xAE79, 0xAE79, 0x9E18, 0x6511, 0x3C68, 0x4CA8, 
+     0x3C68, 0x54CD, 0x8DD7, 0x8DB7, 0x544F, 0x3C68, 0x4CA8, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x754E, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 
+     0x6D29, 0x754E, 0x7D76, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 
+     0x85AF, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x7D76, 0x74F5, 0x6490, 
+     0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x74F5, 0x6454, 0x544F, 0x4CA8, 
+     0x8DD7, 0x9E18, 0x74F5, 0x6454, 0x544F, 0x3C68, 0x3C68, 0x3C68, 
+     0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x85AF, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x5CE9, 0x54CD, 0x8DD7, 
+     0x85AF, 0xAE79, 0x85B3, 0x4CA8, 0x5CE9, 0x3C68, 0x54CD, 0x7D76, },
+    {0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0x9E18, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x652F, 0xAE79, 0x9E18, 0x6511, 
+     0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 
+     0xAE79, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAE79, 0x9E18, 0x6511, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0x74F5, 0x544F, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x5449, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x33C9, 0x5C6B, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x8D0B, 
+     0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x856A, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5449, 0x856A, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, },
+    {0x6D09, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x850C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7CCB, 0x5C0C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D09, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D09, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAD8F, 0x956D, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 
+     0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 
+     0xA5EA, 0x7D4A, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 
+     0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 
+     0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x53A8, 
+     0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x8B07, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 
+     0x6D29, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0x9C6C, 0x8B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0x9C6C, 0x8B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0x9C6C, 0x8B07, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x93AB, 0x8AC7, 0x9B07, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x8B6A, 0x736C, 0x8AC7, 0x9B47, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8AC7, 0x9B47, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x92E7, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x9E18, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x940E, 0xAE79, 0x8DB7, 0x73CF, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x844D, 0x4A8A, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x844D, 0x4A8A, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x7CAD, 0xA5EA, 0xA54C, 0xA46E, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 
+     0xA5EA, 0xA5EA, 0xA54C, 0xA46E, 0xA46E, 0x8C2E, 0x638D, 0x6C2B, 
+     0xA5EA, 0x84CB, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x6C2B, 
+     0x64E9, 0x84CB, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 
+     0x3C68, 0x3C68, 0x4C2B, 0x6BEE, 0x638D, 0x530C, 0x4ACB, 0x3B09, 
+     0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, },
+    {0xAD8F, 0x844D, 0x4A8A, 0x5B6D, 0x848F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x94EF, 0x638D, 0x4ACB, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 
+     0x6BEE, 0x638D, 0x4ACB, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 
+     0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 
+     0xA5EA, 0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x638D, 
+     0x63AA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3B89, 0x4249, 0x4A8A, 0x530C, 
+     0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, },
+    {0xAD8F, 0xAD0E, 0x7B8C, 0x4A8A, 0x5B6D, 0x638D, 0x5B6D, 0x7C0E, 
+     0xA46E, 0xA46E, 0xA4ED, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 
+     0x7C0E, 0xA46E, 0xA4ED, 0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x530C, 
+     0x5B6D, 0x6BEE, 0x638D, 0x6C2B, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 
+     0x5B6D, 0x6BEE, 0x5C0C, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 
+     0x5B6D, 0x5C0C, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x4CA8, 
+     0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA46E, 0x7C6C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6BEE, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5B6D, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x652F, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x85AF, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x5CE9, 0x54CD, 
+     0x85AF, 0xAE79, 0x9E18, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0xAE79, 0x8DB7, 0x544F, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 
+     0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xAE79, 0x9E18, 0x7551, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 
+     0x74F5, 0x544F, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x652F, 0xAE79, 0x8DB7, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x9E18, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x544F, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x3C28, 0x5C6B, 0xAD8F, 
+     0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x956B, 0xAD8F, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7549, 0x856A, 0x7CCB, 0x6BEE, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x856A, 0x748A, 
+     0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5449, 0x856A, 0x956B, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5C6B, 0xAD8F, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5C0B, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x3B8A, },
+    {0xAD8F, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAD8F, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7C0E, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5B6D, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x850C, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAD0E, 0x7C6C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5B6D, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 
+     0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 
+     0x6D29, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x53A8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8B07, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0x9C6C, 0x8AC7, 
+     0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xA48C, 0x9B47, 
+     0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x736C, 0x8287, 0x8AC7, 
+     0xA3C8, 0xA3C8, 0x9348, 0x7B0A, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xA48C, 0x9B47, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA4CE, 0xAD8F, 0xA48C, 0x9B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x9BEB, 0x92E7, 0x8B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x7B8C, 0x9B07, 0x9B47, 0xA3C8, },
+    {0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C28, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x94A9, 0xA3C8, 0x9C49, 0x8509, 0x7C28, 0x9B07, 0x9B47, 0xA3C8, 
+     0x9469, 0x9B07, 0x83A7, 0x7408, 0x8B88, 0x94A9, 0xA3C8, 0x9C49, 
+     0x7509, 0x94A9, 0x9348, 0x8B88, 0x8D4A, 0x94A9, 0x9B88, 0x83A7, 
+     0x83A7, 0x7408, 0x8287, 0x8B88, 0x8509, 0x7C68, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x83A7, 0x7408, 0x8AC7, 0x9B47, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x7408, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x9469, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C28, 0x7509, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x83A7, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0x9C49, 0x8509, 0x7C28, 0x9B07, 0x9B47, 0xA3C8, 0x9C49, 
+     0x9B07, 0x83A7, 0x7408, 0x8B88, 0x94A9, 0xA3C8, 0x9C49, 0x8D4A, 
+     0x94A9, 0x9348, 0x8B88, 0x8D4A, 0x94A9, 0x9B88, 0x83A7, 0x7408, 
+     0x7408, 0x8287, 0x8B88, 0x8509, 0x7C68, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0x9B88, 0x83A7, 0x7408, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xBE52, 0x6D29, 
+     0xE6F8, 0xBE52, 0x6D29, 0x9DCF, 0xE6F8, 0xE6F8, 0xBE52, 0x6D29, 
+     0xE6F8, 0xE6F8, 0xE615, 0xDD93, 0xE6F8, 0xE6F8, 0xBE52, 0x6D29, 
+     0xDD93, 0xE6F8, 0xE615, 0xDCD0, 0xDD93, 0xE615, 0x9CAD, 0x3C68, 
+     0x63CA, 0xBBAE, 0xC42F, 0xAB0C, 0xAB0C, 0x7B8B, 0x3C68, 0x4CA8, 
+     0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x7D4E, 0xE6F8, 
+     0x6D29, 0x5CE9, 0x4CA8, 0x5CE9, 0x3C68, 0x748B, 0xDD93, 0xE6F8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x6D09, 
+     0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x856A, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5449, 0x856A, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x64E8, 0x4467, 0x54A8, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 
+     0x4467, 0x4467, 0x4467, 0x4467, 0x4467, 0x5CC8, 0x6D09, 0x54A8, 
+     0x6D09, 0x4467, 0x4467, 0x4467, 0x5CC8, 0x856A, 0x856A, 0x6D09, 
+     0x64C9, 0x33C9, 0x33C9, 0x33C9, 0x5449, 0x856A, 0x6D09, 0x4467, 
+     0x64C9, 0x3329, 0x4249, 0x3AC9, 0x5449, 0x856A, 0x64C9, 0x4C49, 
+     0xAD8F, 0x844D, 0x4249, 0x6B6B, 0xAD8F, 0x7CCD, 0x33C9, 0x4C49, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4467, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 
+     0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x7549, 0x6D09, 0x4467, 0x4467, 
+     0x6D29, 0x64E8, 0x3C28, 0x3C08, 0x5CC8, 0x856A, 0x64C9, 0x33C9, 
+     0x4467, 0x4467, 0x3C28, 0x5449, 0x856A, 0x856A, 0x64C9, 0x3329, 
+     0x6D09, 0x4467, 0x43A8, 0x5B69, 0x856A, 0x64C9, 0x3329, 0x4249, 
+     0x64C9, 0x33C9, 0x3329, 0x4249, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x64C9, 0x3329, 0x4249, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0xAD8F, 0x844D, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, },
+    {0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAD8F, 0x850C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAD8F, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA4CE, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7C0E, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5B6D, 0x5C0C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x850C, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0xAD0E, 0x7C6C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0x9BA8, 0x9BA8, 0x9BA8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xCEB2, 0xCEB2, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xCEB2, 0xCEB2, 0xCEB2, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA54B, 0xA54B, 0xB5CE, 0xB5AE, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA449, 0xB5CE, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B47, 0x9B88, 0x9B07, 0x9BE9, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8AC7, 0x9B07, 0x92E7, 0x8287, },
+    {0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x63CA, 0xBBAE, 0x9CAD, 
+     0x7D4E, 0xE6F8, 0xBE52, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 
+     0xE6F8, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xDD93, 0xE6F8, 0xA5F2, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAB0C, 0xBBAE, 0x9CAD, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x3C28, 0x5C6B, 0xAD8F, 
+     0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x956B, 0xAD8F, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7549, 0x856A, 0x7CCB, 0x6BEE, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x856A, 0x6C29, 
+     0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5449, 0x856A, 0x956B, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5C6B, 0xAD8F, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5C0B, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x3B8A, },
+    {0xAD8F, 0xAD0E, 0xA46E, 0xA4CE, 0xAD8F, 0xAD8F, 0x7CCD, 0x3C08, 
+     0xAD8F, 0xAD0E, 0xA46E, 0xA4CE, 0xAD8F, 0xAD8F, 0x9D6D, 0x6D09, 
+     0x7C0E, 0xA46E, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 0x746D, 0x856A, 
+     0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x5B4C, 0x5B69, 0x856A, 0x6D09, 
+     0x8C8E, 0x6C2B, 0xA5EA, 0x84CB, 0x73ED, 0x9D6D, 0x856A, 0x64C9, 
+     0xADAD, 0xA5EA, 0xA5EA, 0xA54C, 0xA4CE, 0xAD8F, 0x7CCD, 0x4C49, 
+     0x8C2E, 0x7CAD, 0x7D4A, 0x646A, 0xA46E, 0x742C, 0x3C08, 0x54A8, 
+     0x4B8A, 0x4448, 0x5449, 0x5C2B, 0x638D, 0x434B, 0x3C08, 0x4467, },
+    {0x4467, 0x4467, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4467, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7D49, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C08, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xAD8F, 0xAD0E, 0x83ED, 0x5B6D, 0x848F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0xAD8F, 0xAD0E, 0x7B8C, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 
+     0x7C0E, 0xA46E, 0x7B8C, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 
+     0x52CB, 0x6BEE, 0x5B4C, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 
+     0x8C8E, 0x6C2B, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x638D, 
+     0xADAD, 0xA5EA, 0xA5EA, 0x7D4A, 0x3B89, 0x4249, 0x4A8A, 0x530C, 
+     0x8C2E, 0x7CAD, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 
+     0x4B8A, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, },
+    {0xAD8F, 0xAD0E, 0x7B8C, 0x4A8A, 0x5B6D, 0x638D, 0x5B6D, 0x7C0E, 
+     0xA46E, 0xA46E, 0xA4ED, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 
+     0x7C0E, 0xA46E, 0xA4ED, 0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x530C, 
+     0x5B6D, 0x6BEE, 0x638D, 0x6C2B, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 
+     0x5B6D, 0x6BEE, 0x5C0C, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 
+     0x5B6D, 0x5C0C, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 
+     0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0x8DAA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x8287, 0x8B07, },
+    {0xA46E, 0x7C6C, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x856A, 
+     0x6BEE, 0x6C6C, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x64E9, 
+     0x5B6D, 0x6C6C, 0x5CE9, 0x64E9, 0xA5EA, 0x7D4A, 0x53A8, 0x8BC8, 
+     0x3C68, 0x3C68, 0x53A8, 0x8BC8, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 
+     0x3C68, 0x64E9, 0xA509, 0x9348, 0x8BC8, 0xA5EA, 0x94A9, 0x8B07, 
+     0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 
+     0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 
+     0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 
+     0xA5EA, 0x8DAA, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 
+     0x8287, 0x7B88, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8BC8, 
+     0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8287, 0x8287, 
+     0xA3C8, 0xA489, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 
+     0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x64E9, 
+     0xA5EA, 0x94A9, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 
+     0xA5EA, 0xA509, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8287, 0x8BC8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0x8C48, },
+    {0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xAD8F, 0xA48C, 0x9BE9, 0xA54B, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xAD8F, 0xBDF0, 0xB5AE, 0x946A, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB54F, 0xB5AE, 0xA4EC, 0xCEB2, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8CF0, 0xCEB2, 0xCEB2, 0xBD4E, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x846E, 0xBE2F, 0x9C6A, 0x9B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4AD, 0x9C6A, 0x9B07, 0x9B47, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46E, 0x93AB, 0x8B07, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, },
+    {0x6D09, 0x3C68, 0x3C68, 0x3C68, 0x43E9, 0x4BAA, 0x4467, 0x4467, 
+     0x850C, 0x4448, 0x4C49, 0x64CB, 0xAD8F, 0x852C, 0x3C28, 0x3C08, 
+     0xAD0E, 0x844C, 0x744B, 0xA4CE, 0xAD8F, 0x8C8E, 0x434B, 0x33C9, 
+     0xA46E, 0x844C, 0x744B, 0xA4CE, 0xAD0E, 0x83ED, 0x4ACB, 0x4249, 
+     0x7CCB, 0x5C0C, 0x646A, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 0x5B4C, 
+     0x6D09, 0x3C68, 0x3C68, 0x4C2B, 0x638D, 0x4ACB, 0x52CB, 0x6BEE, 
+     0x6D09, 0x4448, 0x5449, 0x4C49, 0x64CB, 0xAD8F, 0xAD8F, 0x8C8E, 
+     0xAD8F, 0x8D0C, 0x4C49, 0x646A, 0xA4CE, 0xAD8F, 0xAD8F, 0x94EF, },
+    {0x4467, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 
+     0x4467, 0x5CC8, 0x856A, 0x6D09, 0x4467, 0x4467, 0x4467, 0x5CC8, 
+     0x5449, 0x856A, 0x856A, 0x856A, 0x64C9, 0x33C9, 0x5449, 0x856A, 
+     0x5B69, 0x856A, 0x856A, 0x64C9, 0x3329, 0x3AC9, 0x5449, 0x856A, 
+     0x5B69, 0x856A, 0x6C29, 0x4249, 0x4249, 0x4249, 0x3AC9, 0x5449, 
+     0x638D, 0x4ACB, 0x4A8A, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x4ACB, 0x4A8A, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x6BEE, 0x638D, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, },
+    {0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x64E8, 0x4467, 
+     0x7D49, 0x64E8, 0x4467, 0x3C28, 0x5449, 0x6D09, 0x3C28, 0x33C9, 
+     0x6D09, 0x3C28, 0x33C9, 0x5449, 0x856A, 0x64C9, 0x3329, 0x3AC9, 
+     0x856A, 0x64C9, 0x3329, 0x5B69, 0x856A, 0x856A, 0x6C29, 0x3AC9, 
+     0x856A, 0x6C29, 0x4249, 0x4249, 0x5B69, 0x856A, 0x6C29, 0x4249, 
+     0x844D, 0x4249, 0x4249, 0x52CB, 0x6BEE, 0x638D, 0x530C, 0x4ACB, 
+     0xAD8F, 0x844D, 0x52CB, 0x6BEE, 0x6BEE, 0x5B4C, 0x4A8A, 0x5B6D, 
+     0xAD8F, 0x8C8E, 0x5B6D, 0x6BEE, 0x638D, 0x4ACB, 0x4A8A, 0x5B6D, },
+    {0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 
+     0xAD8F, 0x850C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 
+     0xAD8F, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 
+     0xA4CE, 0xAD0E, 0x8CAC, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 
+     0x7C0E, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5B6D, 0x5C0C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x850C, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAD0E, 0x7C6C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, },
+    {0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8287, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 0x64E9, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x7B88, },
+    {0x7B88, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 
+     0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 
+     0x8DAA, 0x5CE9, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, },
+    {0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 
+     0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 
+     0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8B07, 
+     0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 
+     0x64E9, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 
+     0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x53A8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0xA48C, 0x92E7, 0x8B07, 
+     0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0x9C6C, 0x8287, 0x8AC7, 
+     0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD0E, 0x83ED, 0x62EA, 0x8287, 
+     0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x638D, 0x530C, 0x5B6D, 
+     0xA3C8, 0xA3C8, 0x9348, 0x7B0A, 0x638D, 0x4ACB, 0x4A8A, 0x5B6D, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0xAD8F, 0x8C8E, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA4CE, 0xAD8F, 0xAD8F, 0x94EF, },
+    {0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B07, 0xA3EA, 0xAD8F, 0xAD8F, 0xACEC, 0x9B88, 0x9B47, 0xA3C8, 
+     0x8B2A, 0xA4CE, 0xAD8F, 0xAD8F, 0xA48C, 0x92E7, 0x8B07, 0xA3C8, 
+     0x7C0E, 0xA46E, 0xA46E, 0x9BEB, 0x92E7, 0x8287, 0x8AC7, 0x9B07, 
+     0x6BEE, 0x6BEE, 0x638D, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x4ACB, 0x4A8A, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x6BEE, 0x638D, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B07, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9C6C, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAD8F, 0x9C6C, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAD8F, 0x8C8E, 0x62EA, 0x8287, 0x93AA, 0xAD8F, 0xACEC, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, },
+    {0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x92E7, 0x8AC7, 0x9B47, 
+     0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x93AA, 0xAD8F, 0xAD8F, 0xA48C, 
+     0xA3C8, 0xA3C8, 0x9348, 0x8B2A, 0xA46E, 0xA4CE, 0xAD8F, 0xAD8F, 
+     0xA3C8, 0x9B88, 0x7B09, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x6BEE, 
+     0x9B88, 0x9B07, 0x7B09, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x5B6D, 
+     0xAD8F, 0x9C6C, 0x72C9, 0x530C, 0x530C, 0x530C, 0x530C, 0x5B6D, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0x9348, 0x8B07, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B07, 
+     0x9B07, 0x92E7, 0x8287, 0x8AC7, 0xA3EA, 0xAD8F, 0xAD8F, 0x94EF, 
+     0x8C8E, 0x62EA, 0x8287, 0x8B2A, 0xA4CE, 0xAD8F, 0xAD0E, 0x83ED, 
+     0x6BEE, 0x638D, 0x62EA, 0x8B2A, 0xA46E, 0x8C2E, 0x6BEE, 0x638D, 
+     0x6BEE, 0x6BEE, 0x5B4C, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x6BEE, 0x638D, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, },
+    {0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0x9348, 0x8AC7, 0x9B47, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 
+     0x92E7, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x92E7, 0x8AC7, 0x9B47, 
+     0x638D, 0x62EA, 0x8287, 0x8287, 0x93AA, 0xAD8F, 0xAD8F, 0xA48C, 
+     0x530C, 0x4ACB, 0x5A48, 0x8B2A, 0xA46E, 0xA4CE, 0xAD8F, 0xAD8F, 
+     0x4ACB, 0x4A8A, 0x530C, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x6BEE, 
+     0x844D, 0x4A8A, 0x530C, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x5B6D, 
+     0xAD8F, 0x8C8E, 0x530C, 0x530C, 0x530C, 0x530C, 0x530C, 0x5B6D, },
+    {0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x92E7, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x638D, 0x62EA, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x530C, 0x4ACB, 0x62C9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x4ACB, 0x4A8A, 0x6B0A, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x844D, 0x4A8A, 0x6B0A, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAD8F, 0x8C8E, 0x62EA, 0x8287, 0x93AA, 0xAD8F, 0xACEC, 0xA3C8, },
+    {0xAD8F, 0xAD0E, 0x7C6C, 0x646A, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 
+     0xAD8F, 0xAD0E, 0x844C, 0x5C2B, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 
+     0x7C0E, 0xA46E, 0x844C, 0x5C2B, 0x638D, 0x530C, 0x4ACB, 0x63AA, 
+     0x5B6D, 0x640C, 0x4C49, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x64E9, 
+     0x850C, 0x3C68, 0x4448, 0x5449, 0x5449, 0x4C49, 0x3C68, 0x3C68, 
+     0xAD0E, 0x7C6C, 0x4448, 0x5449, 0x5449, 0x4C49, 0x4448, 0x5449, 
+     0xA46E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5B6D, 0x640C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, },
+    {0x638D, 0x4ACB, 0x630B, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x63AA, 0xA5EA, 0xA54C, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 
+     0xA5EA, 0xA5EA, 0xA54C, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x6BEE, 
+     0xA5EA, 0x84CB, 0x5B6D, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x7CAD, 
+     0x64E9, 0x7D4A, 0x4C2B, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x7CAD, 
+     0x4C49, 0x4448, 0x5449, 0x5C2B, 0x638D, 0x530C, 0x4ACB, 0x4249, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C49, 0x3C68, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C49, 0x3C68, 0x3C68, },
+    {0x94EF, 0x638D, 0x5B6D, 0x638D, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 
+     0x6BEE, 0x5B4C, 0x4A8A, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 
+     0x6BEE, 0x5B4C, 0x4249, 0x52CB, 0x7C0E, 0xA46E, 0xA46E, 0x8C2E, 
+     0xA5EA, 0xA5EA, 0x84CB, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x7CAD, 
+     0xA5EA, 0xA5EA, 0xA5EA, 0x84CB, 0x5B6D, 0x6BEE, 0x638D, 0x6C2B, 
+     0x63AA, 0xA5EA, 0xA5EA, 0x7D4A, 0x43E9, 0x530C, 0x530C, 0x4B8A, 
+     0x64E9, 0xA5EA, 0x854A, 0x4C49, 0x4448, 0x5449, 0x4C49, 0x3C68, 
+     0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, },
+    {0x844D, 0x4A8A, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x844D, 0x4A8A, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x7CAD, 0xA5EA, 0xA54C, 0xA46E, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 
+     0xA5EA, 0xA5EA, 0xA54C, 0xA46E, 0xA46E, 0x8C2E, 0x638D, 0x6C2B, 
+     0xA5EA, 0x84CB, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x6C2B, 
+     0x64E9, 0x84CB, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 
+     0x3C68, 0x3C68, 0x4C2B, 0x6BEE, 0x638D, 0x530C, 0x4ACB, 0x3B09, 
+     0x4C49, 0x4448, 0x5449, 0x5449, 0x5449, 0x4C49, 0x3C68, 0x3C68, },
+    {0xAD8F, 0x844D, 0x4A8A, 0x5B6D, 0x848F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x94EF, 0x638D, 0x4ACB, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 
+     0x6BEE, 0x638D, 0x4ACB, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 
+     0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 
+     0xA5EA, 0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x638D, 
+     0x63AA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3B89, 0x4249, 0x4A8A, 0x530C, 
+     0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C08, 0x3BC8, 
+     0x3C68, 0x4448, 0x5449, 0x4C49, 0x3C68, 0x3C68, 0x3C68, 0x3C08, },
+    {0xAD8F, 0xAD0E, 0x7B8C, 0x4A8A, 0x5B6D, 0x638D, 0x5B6D, 0x7C0E, 
+     0xA46E, 0xA46E, 0xA4ED, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 
+     0x7C0E, 0xA46E, 0xA4ED, 0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x530C, 
+     0x5B6D, 0x6BEE, 0x638D, 0x6C2B, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 
+     0x5B6D, 0x6BEE, 0x5C0C, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 
+     0x5B6D, 0x5C0C, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x4CA8, 
+     0x4CA8, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5428, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA46E, 0x7C6C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6BEE, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x5B6D, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 
+     0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8287, 0x8287, 
+     0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 
+     0xA509, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 
+     0x94A9, 0x8B07, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x8287, 0x8287, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0x9348, 0x8AC7, 
+     0x92E7, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 
+     0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x9B07, 0x9B07, 0x92E7, 0x8287, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x7B88, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 
+     0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x5CE9, 0x4CA8, 
+     0x8BC8, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x8287, 0x6B28, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0x7D4A, 0x4CA8, 
+     0x9348, 0x8287, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0x94A9, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0x94A9, 0x8B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 
+     0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 
+     0x7428, 0x8287, 0x8B07, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 
+     0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA5EA, 0xA5EA, 0x94A9, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 
+     0x856A, 0xA5EA, 0x94A9, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0xA509, 
+     0x6D29, 0x7428, 0x8287, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, 
+     0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x638D, 0x530C, 0x4ACB, 0x5A48, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x638D, 0x4ACB, 0x630B, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x4A8A, 0x530C, 0x738D, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 
+     0x6A68, 0x4A8A, 0x738D, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x6BEE, 
+     0x8287, 0x72C9, 0x5B6D, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x6BEE, 
+     0x9B07, 0x92E7, 0x7B0A, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x638D, 
+     0x9B88, 0x9B07, 0x92E7, 0x7B0A, 0x638D, 0x530C, 0x4ACB, 0x4249, 
+     0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x94EF, 0x638D, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xACEC, 0xA3C8, 
+     0x6BEE, 0x5B4C, 0x630B, 0xA4CE, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 
+     0x6BEE, 0x5B4C, 0x630B, 0xA46E, 0x9BEB, 0x9B47, 0xA3C8, 0xA3C8, 
+     0x638D, 0x4ACB, 0x52CB, 0x6BEE, 0x736C, 0x8B07, 0xA3C8, 0xA3C8, 
+     0x4ACB, 0x5A48, 0x7B0A, 0x638D, 0x73ED, 0xAD8F, 0xACEC, 0xA3C8, 
+     0x6288, 0x9B07, 0x7B09, 0x738D, 0xA4CE, 0xA48C, 0x9B07, 0x9B47, 
+     0xA3C8, 0x9B88, 0x9B47, 0xA40A, 0xA46E, 0x93AB, 0x8B07, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, },
+    {0xA3C8, 0x9C49, 0x8509, 0x7C28, 0x9B07, 0x9B47, 0xA3C8, 0x9C49, 
+     0x9B07, 0x83A7, 0x7408, 0x8B88, 0x94A9, 0xA3C8, 0x9C49, 0x8D4A, 
+     0x94A9, 0x9348, 0x8B88, 0x8D4A, 0x94A9, 0x9B88, 0x83A7, 0x7408, 
+     0x7408, 0x8287, 0x8B88, 0x8509, 0x7C68, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0x9B88, 0x83A7, 0x7408, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 
+     0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x9469, 
+     0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C28, 0x7509, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x83A7, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0x9C49, 0x8509, 0x7C28, 0x9B07, 0x9B47, 0x9B88, 0x93E8, 
+     0x9B07, 0x83A7, 0x7408, 0x8B88, 0x94A9, 0x9B88, 0x93E8, 0x8D4A, 
+     0x94A9, 0x9348, 0x8B88, 0x8D4A, 0x94A9, 0x9B88, 0x83A7, 0x7408, 
+     0x7408, 0x8287, 0x8B88, 0x8509, 0x7C68, 0xA3C8, 0xA3C8, 0x9348, 
+     0xA3C8, 0x9B88, 0x83A7, 0x7408, 0x8AC7, 0x9B47, 0xA46A, 0xAD8F, 
+     0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0x9B88, 0x9B07, 0xA3EA, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0x9348, 0x8B2A, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x7B09, },
+    {0x9D4C, 0xAD0E, 0x83ED, 0x530C, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 
+     0x9D4C, 0xAD0E, 0x83ED, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 
+     0x8AC7, 0x9B8A, 0x7B8C, 0x52CB, 0x7C0E, 0xA46E, 0xA46E, 0x8C2E, 
+     0x7B0A, 0x6BEE, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x638D, 
+     0x8C8E, 0x5B6D, 0x736C, 0x72C9, 0x5B6D, 0x6BEE, 0x638D, 0x530C, 
+     0xAD0E, 0x83ED, 0x6B0A, 0x92E7, 0x72C9, 0x530C, 0x530C, 0x62EA, 
+     0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 
+     0x5B6D, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x8C8E, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x8C8E, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x5B4C, 0x4A8A, 0x738D, 0xA46E, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 
+     0x4ACB, 0x4A8A, 0x738D, 0xA46E, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 
+     0x62EA, 0x72C9, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x530C, 
+     0x8287, 0x72C9, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 
+     0x9B07, 0x92E7, 0x7B0A, 0x6BEE, 0x638D, 0x530C, 0x4ACB, 0x5A48, 
+     0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xAD8F, 0x844D, 0x4A8A, 0x530C, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 
+     0x94EF, 0x638D, 0x530C, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 
+     0x6BEE, 0x638D, 0x4ACB, 0x52CB, 0x7C0E, 0xA46E, 0xA46E, 0x8C2E, 
+     0x6BEE, 0x638D, 0x530C, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x638D, 
+     0x4ACB, 0x5A48, 0x8287, 0x72C9, 0x5B6D, 0x6BEE, 0x638D, 0x530C, 
+     0x5A48, 0x8AC7, 0x9B07, 0x92E7, 0x72C9, 0x530C, 0x530C, 0x62EA, 
+     0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xAD8F, 0x844D, 0x630B, 0xA4CE, 0xAD8F, 0xAD8F, 0xACEC, 0xA3C8, 
+     0x94EF, 0x638D, 0x738D, 0xA4CE, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 
+     0x6BEE, 0x638D, 0x738D, 0xA46E, 0x9BEB, 0x9B47, 0xA3C8, 0xA3C8, 
+     0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x736C, 0x8B07, 0xA3C8, 0xA3C8, 
+     0x4ACB, 0x5A48, 0x7B0A, 0x638D, 0x73ED, 0xAD8F, 0xACEC, 0xA3C8, 
+     0x5A48, 0x8AC7, 0x7B09, 0x738D, 0xA4CE, 0xA48C, 0x9B07, 0x9B47, 
+     0x8AC7, 0x9B47, 0xA3C8, 0xA40A, 0xA46E, 0x93AB, 0x8B07, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA44E, 0xAE79, 0xAE79, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x946D, 0x8DD7, 0xAE79, 0x9E18, 
+     0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x8BED, 0x7D76, 0x74F5, 0x6BAF, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9E18, 
+     0x9D12, 0xA3C8, 0xA3C8, 0xA3C8, 0x6CB5, 0x7D76, 0x7D76, 0x7D76, 
+     0x7C50, 0xA3C8, 0x7B2C, 0x6454, 0x6454, 0x6CB5, 0x7D76, 0x7C50, 
+     0x8287, 0xA3C8, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0x8287, 0x8AC7, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8AC7, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 
+     0x7D76, 0x8CD1, 0xA3C8, 0x8BCA, 0x638D, 0x530C, 0x4ACB, 0x5A48, 
+     0x7C50, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 
+     0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 
+     0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x3C68, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0xAD8F, 0x850C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0xAD8F, 0xAD0E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0xA4CE, 0xAD0E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x7C0E, 0xA46E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5B6D, 0x5C0C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x850C, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0xAD0E, 0x7C6C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, },
+    {0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0x854A, },
+    {0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 
+     0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0x7D09, 0x3B88, 
+     0x5449, 0x5449, 0x854A, 0x6CE9, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 
+     0x5449, 0x4C08, 0x7D09, 0x3B88, 0x6469, 0xA5EA, 0xA5EA, 0x7D4A, 
+     0x5449, 0x4C08, 0x6D29, 0x5C89, 0x3BC8, 0x64E9, 0xA5EA, 0x7D4A, },
+    {0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x6CE9, 0xA5EA, 0x854A, 0x5449, 0x5449, 0x5449, 
+     0x3B88, 0x6469, 0xA5EA, 0xA5EA, 0x854A, 0x5449, 0x5449, 0x5449, 
+     0x3BC8, 0x64E9, 0xA5EA, 0xA5EA, 0x7D09, 0x43C8, 0x5449, 0x6CE9, 
+     0x6D29, 0x5CE9, 0x64E9, 0x7D09, 0x3B88, 0x43C8, 0x5449, 0x6CE9, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5C89, 0x3B88, 0x3BC8, 0x3C68, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, },
+    {0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x6469, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 
+     0xA5EA, 0x854A, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x3BC8, 
+     0xA5EA, 0xA5EA, 0x854A, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0x8DAA, 
+     0x64E9, 0xA5EA, 0x7D09, 0x3B88, 0x6469, 0xA5EA, 0xA5EA, 0x8DAA, 
+     0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, },
+    {0x5449, 0x5CA9, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6469, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x64E9, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0xB4AA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0x9C49, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 
+     0xBD4B, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xB5EB, 
+     0xBD4B, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0xA5AB, 0xBD4B, 
+     0xBD4B, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xB5EB, 0x94A9, 
+     0xB5EB, 0x94A9, 0xA3C8, 0xA3C8, 0xB4AA, 0xCE4C, 0xBD4B, 0xA3C8, 
+     0xCE4C, 0xBD4B, 0xA3C8, 0xA3C8, 0xB4AA, 0xCE4C, 0xBD4B, 0xA3C8, 
+     0xCE4C, 0xBD4B, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 
+     0xA5AB, 0xBD4B, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0xA3C8, 0x9C49, },
+    {0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0xACEC, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD0E, 
+     0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0xA46E, 0x83ED, 0x738D, 0xA46E, 
+     0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x8C2E, 0x5B4C, 0x52CB, 0x638D, 
+     0x9B88, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8AC7, 
+     0xAD8F, 0xAD8F, 0xA48C, 0x9B07, 0x92E7, 0x8AC7, 0x9B07, 0x9B47, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x6B0A, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x93AA, 0xAD8F, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x93AA, 0xAD8F, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x93AA, 0xAD8F, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8B2A, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, },
+    {0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA46E, 0x9BEB, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x7B0A, 0x7B8C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAD8F, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xAD8F, 0xAD0E, 0x83ED, 0x5B6D, 0x848F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0xAD8F, 0xAD0E, 0x7B8C, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 
+     0x7C0E, 0xA46E, 0x7B8C, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 
+     0x52CB, 0x6BEE, 0x5B4C, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 
+     0x8C8E, 0x6C2B, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x638D, 
+     0xADAD, 0xA5EA, 0xA5EA, 0x7D4A, 0x3B89, 0x4249, 0x4A8A, 0x530C, 
+     0x8C2E, 0x7CAD, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x4448, 0x5449, 
+     0x4B8A, 0x4448, 0x5449, 0x4C49, 0x3C68, 0x3C68, 0x3C68, 0x4448, },
+    {0xAD8F, 0xAD0E, 0x7B8C, 0x4A8A, 0x5B6D, 0x638D, 0x5B6D, 0x7C0E, 
+     0xA46E, 0xA46E, 0xA4ED, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 
+     0x7C0E, 0xA46E, 0xA4ED, 0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x530C, 
+     0x5B6D, 0x6BEE, 0x638D, 0x6C2B, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 
+     0x5B6D, 0x6BEE, 0x5C0C, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x4448, 
+     0x5B6D, 0x5C0C, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x4C49, 0x4448, 
+     0x5449, 0x5449, 0x4C49, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, },
+    {0xA46E, 0x7C6C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x6BEE, 0x640C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5B6D, 0x640C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x3C68, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x4C49, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, },
+    {0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0x7D4A, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x5428, 0x6D29, 
+     0x6CE9, 0xA5EA, 0xA5EA, 0x7D09, 0x3B88, 0x5428, 0x6D29, 0x856A, 
+     0x6CE9, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 
+     0x3B88, 0x6469, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x5CE9, 0x3C68, 
+     0x4C08, 0x5428, 0x856A, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, },
+    {0x7D09, 0x3B88, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x8DAA, 0x5CE9, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x856A, 0xA5EA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0xA5EA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0x8DAA, 0x5CE9, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x64E9, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 
+     0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 
+     0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 
+     0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xCE4C, 0xBD4B, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xB5EB, 0x94A9, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B88, 0x8509, 0x7408, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0x9B88, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xB4AA, 0xB5EB, 0x94A9, 0x9C49, 0xA5AB, 0xBD4B, 0x8C28, 0x6CE8, 
+     0x9C49, 0x8D4A, 0x94A9, 0xB4AA, 0xCE4C, 0xB5EB, 0x8509, 0x7C68, 
+     0x9C49, 0x8D4A, 0x8509, 0x8D6A, 0xB5EB, 0x8D4A, 0x94A9, 0xA3C8, 
+     0x9B88, 0x83A7, 0x6CE8, 0x8D6A, 0xB5EB, 0x8509, 0x7C28, 0x93E8, 
+     0x8287, 0x7B67, 0x6CE8, 0x7509, 0x8D4A, 0x8C29, 0x8287, 0x7B67, 
+     0x92E7, 0x8287, 0x7B67, 0x7509, 0x8509, 0x7408, 0x8B07, 0xA3C8, 
+     0x9B88, 0x92E7, 0x7B67, 0x6CE8, 0x7408, 0x8AC7, 0x9B07, 0x9B47, 
+     0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x7C68, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x7C28, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x8C2E, 0x6BEE, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B07, 0x92E7, 0x8287, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xAD8F, 0xAD8F, 0x94EF, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAD8F, 0xAD0E, 0x8C2E, 0x638D, 0x734A, 0xA3C8, 0xA3C8, 0x9B88, 
+     0x5B4C, 0x4249, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0x9C6C, 0x8287, 
+     0x8287, 0x8287, 0x8B2A, 0xA4CE, 0xAD8F, 0xAD8F, 0x94EF, 0x7B8C, 
+     0x9B88, 0x92E7, 0x8B2A, 0xA46E, 0x7B8C, 0x4A8A, 0x530C, 0x734A, 
+     0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x7B0A, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x7B09, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0xA3EA, 0xAD8F, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B8A, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, },
+    {0xAD8F, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAD8F, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x7C0E, 0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x5B6D, 0x7B8C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8B6A, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D09, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x850C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0xAD0E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0xA46E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x7CCB, 0x5C0C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x6D09, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x6D09, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0xAD8F, 0x8D0C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, },
+    {0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, },
+    {0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x5428, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0x7D09, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x6469, 0xA5EA, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x5428, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6469, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6469, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3B88, 0x6469, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 
+     0x3BC8, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x8DAA, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA44E, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8AC7, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA4CE, 0xAE79, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAE79, 0xAE79, 0x9E18, 0x8490, 0x9B47, 0xA3C8, 0xA4CE, 0xAE79, 
+     0xAE79, 0x9E18, 0x7C50, 0x8287, 0x8287, 0x940E, 0xAE79, 0x9E18, 
+     0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8490, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B07, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9C6C, 0x8287, 0x8AC7, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAD8F, 0x9C6C, 0x8AC7, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAD8F, 0x8C8E, 0x62EA, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, },
+    {0xAD8F, 0xAD0E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0xAD8F, 0xAD0E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x7C0E, 0xA46E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5B6D, 0x640C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x850C, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0xAD0E, 0x7C6C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0xA46E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5B6D, 0x640C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, },
+    {0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3BC8, 0x3C68, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0xA5EA, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0xA5EA, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x6469, 0xA5EA, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3BC8, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3BC8, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, },
+    {0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 
+     0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 
+     0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5428, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 
+     0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x856A, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x5CE9, 0x64E9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 
+     0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 
+     0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0x8DAA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x8287, 0x8B07, },
+    {0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x856A, 
+     0x856A, 0x8DAA, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x64E9, 
+     0xA5EA, 0x8DAA, 0x5CE9, 0x64E9, 0xA5EA, 0x7D4A, 0x53A8, 0x8BC8, 
+     0xA5EA, 0xA5EA, 0x94A9, 0x8BC8, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 
+     0x64E9, 0xA5EA, 0xA509, 0x9348, 0x8BC8, 0xA5EA, 0x94A9, 0x8B07, 
+     0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 
+     0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 
+     0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 
+     0xA5EA, 0x94A9, 0x7B88, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 
+     0xA5EA, 0xA509, 0x9348, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0xAD73, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x9E18, 0x7C50, 0x8B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x9E18, 0x8CD1, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x9E18, 0x8490, 0x92E7, 
+     0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x94EF, 0x638D, 0x738D, 0xA4CE, 0x9511, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x6BEE, 0x5B4C, 0x630B, 0x93AB, 0x8287, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x6BEE, 0x5B4C, 0x630B, 0xA46E, 0x9BEB, 0x9B07, 0x92E7, 0xA3C8, 
+     0x638D, 0x4ACB, 0x52CB, 0x6BEE, 0x7B8C, 0xA44E, 0xAE79, 0xAE79, 
+     0x4ACB, 0x5A48, 0x7B0A, 0x638D, 0x63F0, 0x8DD7, 0xAE79, 0x9E18, 
+     0x6288, 0x9B07, 0x92E7, 0x8AC7, 0x8BED, 0x7D76, 0x74F5, 0x6BAF, 
+     0xA3C8, 0x9B88, 0x9B47, 0x9348, 0x8287, 0x8287, 0x8B07, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9E18, 
+     0x9D12, 0x83AD, 0xA3C8, 0xA3C8, 0x6CB5, 0x7D76, 0x7D76, 0x7D76, 
+     0x7C50, 0x8287, 0xA3C8, 0xA3C8, 0x6454, 0x6CB5, 0x7D76, 0x7C50, 
+     0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0x8287, 0x8AC7, 
+     0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8AC7, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x7D76, 0x8CD1, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x7C50, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8287, 0x8287, 
+     0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xBEEA, 0xBEEA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x3C28, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x54A8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 
+     0x9E4A, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 
+     0xBEEA, 0x9E4A, 0x856A, 0xAE4A, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 
+     0xB68A, 0x8DAA, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0x7D4A, 0x64E9, 0xAE4A, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, },
+    {0x33C9, 0x33C9, 0x3BE9, 0x4C48, 0x4467, 0x4467, 0x4467, 0x3C28, 
+     0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x4C49, 0x6D29, 0x6D29, 0x64E8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x33C9, 0x3BE9, 0x5449, 0x4C48, 0x4467, 0x4467, 0x4467, 0x3C28, 
+     0x3C28, 0x33C9, 0x33C9, 0x33C9, 0x4C49, 0x6D29, 0x6D29, 0x64E8, 
+     0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x33C9, 0x3BE9, 0x5449, 0x5449, 0x5449, 0x4409, 0x3C08, 0x4467, 
+     0x3C28, 0x33C9, 0x3C08, 0x3C28, 0x33C9, 0x4C49, 0x6D29, 0x6D29, 
+     0x54A8, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x3C28, 0x4C49, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x64E8, 0x3C28, 0x3C08, 0x4467, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x7D49, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x7D49, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5449, 0x856A, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5449, 0x856A, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5C6B, 
+     0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x3C28, 0x43CB, 0x7C0E, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 
+     0x6D09, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x956B, 0x850C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAD0E, 0x7C6C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x946D, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x940E, 0xAE79, 0xAE79, 
+     0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x92E7, 0x83AD, 0x8DD7, 0x9E18, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0x946D, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0xAD73, 0xA3C8, 
+     0x7D76, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x8CD1, 0xA3C8, 
+     0xAE79, 0xAE79, 0x9E18, 0x7D76, 0x74F5, 0x7C0F, 0xA3C8, 0xA3C8, 
+     0xAE79, 0x9E18, 0x74F5, 0x6454, 0x6BAF, 0x8AC7, 0x9B07, 0x9B47, 
+     0x74F5, 0x6454, 0x6BAF, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B88, 0x9B07, 0x9B07, 0x9B47, 0x9348, 0x8B07, 0xA3C8, 0x9B88, 
+     0x9B07, 0x92E7, 0x8287, 0x8AC7, 0x92E7, 0x8AC7, 0x92E7, 0x8287, 
+     0x9C6C, 0x8287, 0x8287, 0x8287, 0x93AA, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0xAD8F, 0x9C6C, 0x8287, 0x93AA, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0xAD8F, 0x8C8E, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, },
+    {0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 
+     0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0xA3EA, 
+     0xA46A, 0xAD8F, 0xAD8F, 0xA48C, 0x9B07, 0x92E7, 0x8287, 0x93AA, 
+     0xA3EA, 0xAD8F, 0xAD8F, 0xAD0E, 0x93AB, 0x8287, 0x72C9, 0x738D, 
+     0x8AC7, 0x9B8A, 0xA46E, 0xA46E, 0x8C2E, 0x638D, 0x530C, 0x5B6D, 
+     0x8C8E, 0x530C, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x4A8A, 
+     0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 
+     0xAD8F, 0xAD0E, 0x83ED, 0x5B6D, 0x6BEE, 0x848F, 0xAD8F, 0xAD8F, },
+    {0x92E7, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAD8F, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAD8F, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA4CE, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x7C0E, 0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x5B6D, 0x736C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAD0E, 0x9BEB, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0x9C6C, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0xA48C, 0x9B47, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0x9C6C, 0x8B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0x9C6C, 0x8AC7, 0x9B07, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0x9BEB, 0x92E7, 0x8B07, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x8287, 0x8287, 0x8287, 0x93AA, 0xAD8F, 0xAD8F, 0xAD8F, 0x9C6C, 
+     0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0x8AC7, 0x9B07, 
+     0x8B07, 0x9B88, 0x9B47, 0xA3C8, 0x9348, 0x8AC7, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xACEC, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 
+     0x8287, 0x8AC7, 0x9B07, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B07, 0x92E7, 0x8287, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xCEB2, 0xCEB2, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xCEB2, 0xCEB2, 0xCEB2, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA449, 0xA54B, 0xA54B, 0xB5CE, 0xB5AE, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA449, 0xB5CE, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9BE9, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8287, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xBD8E, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xCEB2, 0xBD8E, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA4EC, 0xBE2F, 0x9C6A, 0x9B47, 0xB4EB, 0xCEB2, 0xCEB2, 0xBD8E, 
+     0xB5AE, 0x946A, 0x9C2A, 0x9389, 0x9CAA, 0x8BE9, 0xA4EC, 0xCEB2, 
+     0xA54B, 0x9CAA, 0x946A, 0x9CAA, 0x946A, 0xB5CE, 0xCEB2, 0xCEB2, 
+     0x9389, 0x9CAA, 0x8BE9, 0x946A, 0xA54B, 0x9C6A, 0x9B47, 0xA449, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xBD8E, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xBD8E, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA4AA, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 
+     0x64E9, 0xA5EA, 0xA5EA, 0xAE4A, 0x8DEA, 0x3C68, 0x4CA8, 0x6D29, 
+     0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 
+     0x5CE9, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x748A, 0x5B6D, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7549, 0x856A, 0x856A, 0x7CCB, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5449, 0x856A, 0x956B, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5C6B, 0xAD8F, 
+     0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x3C28, 0x43CB, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x748A, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x856A, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x856A, },
+    {0x5C0C, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x638D, 0x5BEB, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0xAD8F, 0x94EF, 0x6C6C, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 
+     0xAD8F, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7C0E, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5B6D, 0x6BEE, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x748A, 0x5B6D, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x748A, 0x5BEB, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x92E7, 0x8287, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8AC7, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA44E, 0xAE79, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x940E, 0xAE79, 0x9E18, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x8BED, 0x74F5, 0x73CF, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x9B47, 0xA4CE, 0xAE79, 0xAE79, 
+     0x9B47, 0x9348, 0x8B07, 0xA3C8, 0x946D, 0x8DD7, 0xAE79, 0x9E18, 
+     0xAD73, 0xA3C8, 0xA3C8, 0x9348, 0x83AD, 0x7D76, 0x74F5, 0x6BAF, 
+     0x8CD1, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x9B07, 0x92E7, 0x8B07, 
+     0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8490, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x94EF, 0x638D, 0x530C, 0x5B6D, 0x848F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x6BEE, 0x5B4C, 0x4249, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 
+     0x6BEE, 0x5B4C, 0x4249, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 
+     0x638D, 0x4ACB, 0x4249, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 
+     0x4ACB, 0x5A48, 0x8287, 0x6A68, 0x4A8A, 0x5B6D, 0x6BEE, 0x638D, 
+     0x6288, 0x9B07, 0x9B07, 0x9B07, 0x7AC8, 0x4249, 0x4A8A, 0x530C, 
+     0xA3C8, 0x9B88, 0x9B47, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xAD8F, 0xAD0E, 0x7B8C, 0x4A8A, 0x5B6D, 0x638D, 0x5B6D, 0x7C0E, 
+     0xA46E, 0xA46E, 0x83ED, 0x530C, 0x4ACB, 0x4A8A, 0x5B6D, 0x6BEE, 
+     0x7C0E, 0xA46E, 0x83ED, 0x4ACB, 0x5A48, 0x6A68, 0x4A8A, 0x530C, 
+     0x5B6D, 0x6BEE, 0x638D, 0x62EA, 0x8287, 0x8AC7, 0x9B07, 0x9B47, 
+     0x5B6D, 0x6BEE, 0x736C, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 
+     0x5B6D, 0x736C, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x6BEE, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x5B6D, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x7B09, 0x62EA, 0x8AC7, 0x9B47, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x8BCA, 0x848F, 0xAD8F, 0xAD8F, 0xA48C, 0x9B07, 
+     0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xA48C, 0x9B47, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x9BEB, 0x9B47, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x8BCA, 0x6BEE, 0x736C, 0x8B07, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x8BCA, 0x638D, 0x62EA, 0x8287, 0x8B07, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9348, 0x72C9, 0x530C, 0x62EA, 0x8AC7, 0x9B07, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9BE9, 0xA54B, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xB5AE, 0x946A, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xB5AE, 0xA4EC, 0xCEB2, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xCEB2, 0xCEB2, 0xBD4E, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xBE2F, 0x9C6A, 0x9B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA449, 0xA4AA, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x9CAA, 0x8BE9, 0x946A, 0xA54B, 0x9C2A, 0x8287, 0x8AC7, 0x9B47, 
+     0xA54B, 0xA54B, 0xB5CE, 0xB5AE, 0xA4EC, 0xBD4E, 0x9B07, 0x9B07, 
+     0xB52E, 0x8287, 0x9C0B, 0xCEB2, 0xB5AE, 0xA4EC, 0xBD4E, 0x9B47, 
+     0x92E7, 0x8AC7, 0x9B07, 0xAC6B, 0xCEB2, 0xCEB2, 0xBD8E, 0xA3C8, 
+     0x9B07, 0x9B47, 0xA3C8, 0xA449, 0xB5CE, 0xCEB2, 0xBD8E, 0xA3C8, 
+     0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA449, 0xA4AA, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x754E, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x652F, 0xAE79, 0xAE79, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x54CD, 0x8DD7, 0x9E18, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x754E, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0x95F3, 0x6D29, 
+     0x7D76, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x7551, 0x6D29, 
+     0xAE79, 0xAE79, 0x9E18, 0x7D76, 0x74F5, 0x6490, 0x6D29, 0x6D29, 
+     0xAE79, 0x9E18, 0x74F5, 0x6454, 0x544F, 0x4CA8, 0x6D29, 0x6D29, 
+     0x74F5, 0x6454, 0x544F, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA3C8, 0xA489, 0xA5EA, 
+     0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8287, 0x8BC8, 0xA5EA, 
+     0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x6B28, 0x3C68, 0x64E9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DAA, 0x5CE9, 0x4CA8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 
+     0xA509, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 
+     0xA5EA, 0xA509, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 
+     0xA5EA, 0x94A9, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 
+     0x6D29, 0x6D29, 0x7428, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 
+     0x5CE9, 0x64E9, 0x94A9, 0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x3C68, 0x64E9, 
+     0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 
+     0xA509, 0xA3C8, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 
+     0xA5EA, 0xA509, 0x8C48, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x53A8, 
+     0xA5EA, 0x94A9, 0x7B88, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8287, 0x8B07, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 
+     0x7428, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 
+     0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8287, 0x8B07, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x940E, 
+     0x8CD1, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x8BED, 
+     0x9B07, 0x9B47, 0xA4CE, 0xAE79, 0xAE79, 0x9D12, 0x8AC7, 0x9B07, 
+     0x8B07, 0xA4CE, 0xAE79, 0xAE79, 0x9E18, 0x8CD1, 0xA3C8, 0x9348, 
+     0x9B88, 0x8BED, 0x8DD7, 0x8DB7, 0x6BAF, 0x8AC7, 0x9B07, 0x9B07, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0x946D, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 
+     0xA3C8, 0x946D, 0x7D76, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 
+     0xA4CE, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x7D76, 0x74F5, 0x7C0F, 
+     0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x74F5, 0x6454, 0x6BAF, 0x8AC7, 
+     0x8DD7, 0x9E18, 0x74F5, 0x6454, 0x6BAF, 0x8287, 0x8287, 0x8287, 
+     0x92E7, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x9B47, 0xA4CE, 
+     0x8287, 0x8AC7, 0x9B47, 0x9348, 0x8B07, 0xA3C8, 0x946D, 0x8DD7, 
+     0xA44E, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0x9348, 0x83AD, 0x7D76, },
+    {0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8CD1, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0xAE79, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0xAE79, 0x9E18, 
+     0x9B07, 0x9B47, 0x9348, 0x8AC7, 0xA44E, 0xAE79, 0x9E18, 0x7C50, 
+     0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 
+     0xAE79, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAE79, 0x9E18, 0x8490, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x74F5, 0x6BAF, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8490, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0x9C6C, 0x8B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0x9C6C, 0x8B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0x9C6C, 0x7B2C, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x93AB, 0x8AC7, 0x8BED, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x8B6A, 0x736C, 0x8AC7, 0x9B47, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8287, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0x9C6C, 0x8287, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x940E, 0xAE79, 0xAE79, 0xAD73, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x83AD, 0x8DD7, 0xAE79, 0x9E18, 0x8490, 0x92E7, 
+     0xA3C8, 0x9B07, 0x8BED, 0x7D76, 0x74F5, 0x6BAF, 0x8287, 0x8B07, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, },
+    {0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x652F, 0xAE79, 0x9E18, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x54CD, 0x74F5, 0x544F, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 
+     0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x54CD, 0x8DD7, 0xAE79, 0x9E18, 
+     0x85B3, 0x4CA8, 0x5CE9, 0x3C68, 0x54CD, 0x7D76, 0x74F5, 0x544F, 
+     0x7551, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6511, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DAA, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x8DCA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x8DCA, 0xBEEA, 0xB68A, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 
+     0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 
+     0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x4CA8, 0x7D4A, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x5CE9, 0x64E9, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8B07, 
+     0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 
+     0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8B07, 
+     0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0xA5EA, 
+     0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 
+     0x3C68, 0x4CA8, 0x856A, 0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 
+     0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x940E, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x8BED, 
+     0xA4CE, 0xAE79, 0x9E18, 0x8CD1, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xAE79, 0x8DB7, 0x73CF, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xAE79, 0x9E18, 0x8CD1, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x9B07, 
+     0x74F5, 0x73CF, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 
+     0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x940E, 0xAE79, 0x8DB7, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9E18, 0x8CD1, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x73CF, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xA48C, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x736C, 0x8287, 0x8AC7, 
+     0xA3C8, 0xA3C8, 0x9348, 0x7B0A, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xA48C, 0x9B47, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA4CE, 0xAD8F, 0xA48C, 0x9B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x9BEB, 0x92E7, 0x8B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x7B8C, 0x9B07, 0x9B47, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0xA3EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B2A, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x7B09, },
+    {0xAD8F, 0xAD0E, 0x83ED, 0x530C, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 
+     0xAD8F, 0xAD0E, 0x83ED, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 
+     0x9B8A, 0xA46E, 0x7B8C, 0x52CB, 0x7C0E, 0xA46E, 0xA46E, 0x8C2E, 
+     0x7B0A, 0x6BEE, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x638D, 
+     0x8C8E, 0x5B6D, 0x736C, 0x72C9, 0x5B6D, 0x6BEE, 0x638D, 0x530C, 
+     0xAD0E, 0x83ED, 0x6B0A, 0x92E7, 0x72C9, 0x530C, 0x530C, 0x62EA, 
+     0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 
+     0x5B6D, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0xAD8F, 0x850C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0xAD8F, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA4CE, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7C0E, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5B6D, 0x5C0C, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 
+     0x850C, 0x3C68, 0x4CA8, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x6D29, 
+     0xAD0E, 0x7C6C, 0x4CA8, 0x6D29, 0x856A, 0x7D4A, 0x3C68, 0x6D29, },
+    {0x6D29, 0x6D29, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0xAE79, 0xC6B9, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0xBE4F, 0xE6F8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0xA5EA, 0xBE4F, 0xE6F8, 0xE6F8, 0xCE93, 0x6D29, 0x6D29, 
+     0xCE93, 0xA4CB, 0xBC71, 0xE6F8, 0xE615, 0xC42F, 0xA40B, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x3C68, 
+     0x3C68, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x3C68, 0x4CA8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x7B88, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA5EA, 0xA5EA, 0x8DAA, 0x84A9, 0x84A9, 0x9348, 0x8287, 0x8B07, 
+     0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x94A9, 0x8287, 0x8BC8, 0xA5EA, 
+     0x856A, 0xA5EA, 0x7D4A, 0x4CA8, 0x4CA8, 0x7428, 0x8BC8, 0xA5EA, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 
+     0x8DAA, 0x7428, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 
+     0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8C48, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 
+     0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 
+     0x6D29, 0x5CE9, 0x64E9, 0x94A9, 0x8287, 0x8287, 0x8287, 0x8BC8, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x3C68, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 
+     0xA5EA, 0xA509, 0x5369, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 
+     0xA5EA, 0xA5EA, 0x5369, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 
+     0x64E9, 0xA5EA, 0x6D29, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0xAD8F, 0xACEC, 
+     0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0x94EF, 
+     0x9B88, 0x9B47, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0x94EF, 0x6BEE, 
+     0x92E7, 0x8287, 0x8B2A, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 0x6BEE, 
+     0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x530C, 0x4ACB, 0x4A8A, 0x530C, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0xA48C, 0x92E7, 0x8B07, 
+     0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0x9C6C, 0x8287, 0x8AC7, 
+     0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD0E, 0x83ED, 0x62EA, 0x8287, 
+     0x7BEC, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x638D, 0x530C, 0x5B6D, 
+     0x7BEC, 0xA3C8, 0x9348, 0x7B0A, 0x638D, 0x4ACB, 0x4A8A, 0x5B6D, 
+     0x7BEC, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0xAD8F, 0x8C8E, 
+     0x734A, 0xA3C8, 0x9B88, 0x9B8A, 0xA4CE, 0xAD8F, 0xAD8F, 0x94EF, },
+    {0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 
+     0xA3C8, 0x9B88, 0x92E7, 0x8AC7, 0x9B07, 0x92E7, 0x8AC7, 0x9B47, 
+     0x9B88, 0x9B07, 0x92E7, 0x8287, 0x93AA, 0xAD8F, 0xAD8F, 0xA48C, 
+     0x9B07, 0x92E7, 0x8287, 0x8B2A, 0xA46E, 0xA4CE, 0xAD8F, 0xAD8F, 
+     0x9C6C, 0x8287, 0x72C9, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x6BEE, 
+     0xAD8F, 0x9C6C, 0x72C9, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x5B6D, 
+     0xAD8F, 0x8C8E, 0x530C, 0x530C, 0x530C, 0x530C, 0x530C, 0x5B6D, },
+    {0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x92E7, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x638D, 0x62EA, 0x8AC7, 0x9B47, 0x9348, 0x8B07, 0xA3C8, 0x9B88, 
+     0x530C, 0x4ACB, 0x5A48, 0x8AC7, 0x92E7, 0x8AC7, 0x92E7, 0x8287, 
+     0x4ACB, 0x4A8A, 0x62EA, 0x8287, 0x93AA, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x844D, 0x4A8A, 0x62EA, 0x93AA, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0xAD8F, 0x8C8E, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, },
+    {0xAD8F, 0xAD0E, 0x7B8C, 0x4A8A, 0x5B6D, 0x638D, 0x5B6D, 0x7C0E, 
+     0xA46E, 0xA46E, 0xA4ED, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 
+     0x7C0E, 0xA46E, 0xA4ED, 0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x530C, 
+     0x5B6D, 0x6BEE, 0x638D, 0x6C2B, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 
+     0x5B6D, 0x6BEE, 0x5C0C, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x3C08, 
+     0x5B6D, 0x5C0C, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x4C49, 0x4448, 
+     0x5449, 0x5449, 0x4C49, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, },
+    {0xA46E, 0x7C6C, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 
+     0x6BEE, 0x6C6C, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D09, 0x3BC8, 
+     0x5B6D, 0x5BCC, 0x3B88, 0x6469, 0xA5EA, 0x7D09, 0x3B88, 0x3B88, 
+     0x3C68, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 
+     0x3BC8, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x6469, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x6469, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0xE6F8, 
+     0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x748B, 
+     0x6469, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0x5428, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 
+     0x8DAA, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xE615, 0x9CAD, 0x748B, 0xDCD0, 0xC42F, 0xBC71, 0xE6F8, 0xA5F2, 
+     0xC42F, 0x7B8B, 0x3C68, 0x3C68, 0x748B, 0xDD93, 0xE6F8, 0xA5F2, 
+     0x5CE9, 0x3C68, 0x4CA8, 0x5CE9, 0x63CA, 0xBBAE, 0x9CAD, 0x3C68, 
+     0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x4CA8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x3C68, 0x3C68, 0x6D29, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 
+     0x3C68, 0x3C68, 0x3C68, 0x64E9, 0x7D4A, 0x64E9, 0x8DAA, 0x6D29, 
+     0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x856A, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x5CE9, 0x64E9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 
+     0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 
+     0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0x8DAA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x8287, 0x8B07, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 
+     0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 
+     0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 
+     0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 
+     0x64E9, 0xA5EA, 0xA509, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 
+     0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 
+     0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 0x64E9, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x6D29, },
+    {0x6B28, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 
+     0x6B28, 0x4CA8, 0x6D29, 0x856A, 0x856A, 0xA5EA, 0x7D4A, 0x64E9, 
+     0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 
+     0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 
+     0xA5EA, 0x8DAA, 0x5CE9, 0x64E9, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 
+     0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 
+     0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x3C68, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0x8C2E, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8AC7, 0x9B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xAD8F, 0xAD0E, 0x8C2E, 0x638D, 0x4ACB, 0x4249, 0x4249, 0x6288, 
+     0x6BEE, 0x6BEE, 0x638D, 0x62EA, 0x8287, 0x93AA, 0xAD8F, 0x9C6C, 
+     0x92E7, 0x8287, 0x8287, 0x8287, 0x8B2A, 0xA4CE, 0xAD8F, 0x94EF, 
+     0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B2A, 0x8C2E, 0x6BEE, 0x638D, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x9B07, 0x9B47, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 
+     0x8287, 0x8AC7, 0x9B47, 0x8BCA, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 
+     0x7BEC, 0xA3C8, 0xA3C8, 0x8BCA, 0x638D, 0x530C, 0x4ACB, 0x5A48, 
+     0x734A, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x94EF, 0x638D, 0x530C, 0x530C, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 
+     0x6BEE, 0x5B4C, 0x4A8A, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 
+     0x6BEE, 0x5B4C, 0x4249, 0x52CB, 0x7C0E, 0xA46E, 0xA46E, 0x8C2E, 
+     0x638D, 0x4ACB, 0x4A8A, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x638D, 
+     0x4ACB, 0x5A48, 0x8287, 0x72C9, 0x5B6D, 0x6BEE, 0x638D, 0x530C, 
+     0x6288, 0x9B07, 0x9B07, 0x92E7, 0x72C9, 0x530C, 0x530C, 0x62EA, 
+     0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xAD8F, 0x844D, 0x4A8A, 0x5B6D, 0x848F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x94EF, 0x638D, 0x4ACB, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 
+     0x6BEE, 0x638D, 0x4ACB, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 
+     0x6BEE, 0x638D, 0x4ACB, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 
+     0x4ACB, 0x5A48, 0x8287, 0x6A68, 0x4A8A, 0x5B6D, 0x6BEE, 0x638D, 
+     0x5A48, 0x8AC7, 0x9B07, 0x9B07, 0x7AC8, 0x4249, 0x4A8A, 0x530C, 
+     0x8AC7, 0x9B47, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7549, 0x856A, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x3C28, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x3329, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 
+     0x6D29, 0x54A9, 0x3C08, 0x54A8, 0x7549, 0x6D09, 0x4467, 0x4467, 
+     0x3C28, 0x3C08, 0x3C28, 0x3C08, 0x5CC8, 0x856A, 0x64C9, 0x33C9, 
+     0x856A, 0x6C29, 0x3AC9, 0x5449, 0x856A, 0x856A, 0x64C9, 0x3329, 
+     0x856A, 0x856A, 0x6C29, 0x5B69, 0x856A, 0x64C9, 0x3329, 0x4249, 
+     0x5449, 0x856A, 0x6C29, 0x4249, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x4A8A, 0x530C, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0xAD8F, 0x8C8E, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0x94A9, 
+     0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 
+     0x8490, 0x9B47, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x7B88, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x8BC8, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x8BC8, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x8287, 0x8BC8, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 
+     0x6B28, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x8DAA, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0xBEEA, 
+     0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xBEEA, 0xBEEA, 0xB68A, 
+     0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xAE4A, 0xBEEA, 0xB68A, 0xA5EA, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x64E9, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 
+     0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xBEEA, 0xBEEA, 
+     0xA5EA, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 
+     0xA5EA, 0xA5EA, 0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 
+     0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 
+     0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x734A, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x6CCA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7549, 0x856A, 
+     0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x856A, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x33C9, 0x5449, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64CB, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, },
+    {0xAD8F, 0xAD8F, 0x8C8E, 0x5B6D, 0x848F, 0xAD8F, 0xAD8F, 0xAD8F, 
+     0x956B, 0xAD8F, 0x844D, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 
+     0x856A, 0x8D0B, 0x7B8C, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 
+     0x856A, 0x8D0B, 0x7B8C, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 
+     0xAD8F, 0x94EF, 0x7CAD, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x638D, 
+     0xAD8F, 0xAD0E, 0xA4ED, 0x7D4A, 0x3B89, 0x4249, 0x4A8A, 0x530C, 
+     0x646A, 0x7C6C, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4448, 0x5449, 
+     0x3C68, 0x3C68, 0x4448, 0x4C49, 0x3C68, 0x3C68, 0x3C68, 0x4448, },
+    {0xA46E, 0x7C6C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x6BEE, 0x640C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5B6D, 0x640C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x3C68, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x4C49, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x6B28, 0x3C68, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x6B28, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, },
+    {0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 
+     0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 
+     0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7B88, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xB68A, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0xB68A, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x6D49, 0xBEEA, 0xB68A, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 
+     0xA5EA, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xAE4A, 
+     0xA5EA, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 
+     0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0xAE4A, 0xBEEA, 
+     0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 
+     0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x8DEA, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x734A, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5C89, 0x3B88, 0x43C8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D09, 0x43C8, 
+     0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x854A, 0x5449, 
+     0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x854A, 0x5449, 0x5449, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C08, 0x3B88, 0x43C8, 0x5449, 
+     0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x5C89, 0x3B88, 0x43C8, 
+     0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5C89, 0x6469, 
+     0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x64E9, 0xA5EA, },
+    {0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 
+     0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0x7D09, 0x3B88, 0x3BC8, 
+     0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 
+     0xA5EA, 0x854A, 0x4C08, 0x6469, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 
+     0xA5EA, 0x7D09, 0x3B88, 0x3BC8, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, },
+    {0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x6CE9, 0xA5EA, 0x854A, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x6469, 0xA5EA, 0xA5EA, 0x854A, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x64E9, 0xA5EA, 0xA5EA, 0x7D09, 0x43C8, 0x5449, 0x6CE9, 0xA5EA, 
+     0x5CE9, 0x64E9, 0x7D09, 0x3B88, 0x43C8, 0x5449, 0x6CE9, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x5C89, 0x3B88, 0x3BC8, 0x3C68, 0x64E9, 
+     0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, },
+    {0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 
+     0x854A, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0x7D09, 0x3B88, 0x3BC8, 
+     0xA5EA, 0x854A, 0x6CE9, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 
+     0xA5EA, 0x7D09, 0x3B88, 0x6469, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 
+     0x6D29, 0x6D29, 0x5C89, 0x3BC8, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, },
+    {0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x6469, 0xA5EA, 
+     0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x6469, 
+     0x854A, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x3BC8, 0x3C68, 
+     0xA5EA, 0x854A, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0x8DAA, 0x5CE9, 
+     0xA5EA, 0x7D09, 0x3B88, 0x6469, 0xA5EA, 0xA5EA, 0x8DAA, 0x856A, 
+     0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x64E9, },
+    {0x5CA9, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA5EA, 0xA5EA, 0x8DAA, 0x84A9, 0x9348, 0x8287, 0x8B07, 0xA3C8, 
+     0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8BC8, 0xA5EA, 0x8DAA, 
+     0x856A, 0xA5EA, 0x7D4A, 0x4CA8, 0x7428, 0x8BC8, 0xA5EA, 0xA5EA, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8BC8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x6B28, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0x7D4A, 0x3C68, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0x8DAA, 
+     0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0x8DAA, 
+     0x7428, 0x8287, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 
+     0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, },
+    {0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x652F, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x85AF, 0xAE79, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAE79, 0xAE79, 0x9E18, 0x6511, 0x4CA8, 0x6D29, 0x85AF, 0xAE79, 
+     0xAE79, 0x9E18, 0x6511, 0x3C68, 0x3C68, 0x652F, 0xAE79, 0x9E18, 
+     0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6511, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 
+     0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 
+     0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6B28, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 
+     0x6B28, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x64E9, 0x7D4A, 
+     0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 
+     0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 
+     0xA5EA, 0x8DAA, 0x5CE9, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 
+     0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 
+     0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 
+     0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0x95F3, 0x6D29, 
+     0x6D29, 0x6D29, 0x5CE9, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x4CA8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x85AF, 0xAE79, 0x9E18, 0x7551, 
+     0x6D29, 0x5CE9, 0x3C68, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x3C68, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0x94A9, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x7B88, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x748B, 
+     0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xA5F2, 0x3C68, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xE6F8, 0xA5F2, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xE6F8, 0xE615, 0xB4ED, },
+    {0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 
+     0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x7B88, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA5EA, 0xA5EA, 0x8DAA, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA5EA, 0xA5EA, 0xA5EA, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0x5369, 
+     0x856A, 0xA5EA, 0x7D4A, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x5369, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 
+     0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 
+     0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0x94A9, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA489, 
+     0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0xA489, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0x8287, 
+     0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0x8C48, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x7B88, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 
+     0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x53A8, 0x8287, 0x8B07, 0xA489, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0x8490, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x856A, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x64E9, 
+     0x4CA8, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x7D4A, 0x53A8, 0x8BC8, 
+     0x6D29, 0x6D29, 0x7428, 0x8BC8, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 
+     0x7428, 0x8287, 0x8B07, 0x9348, 0x8BC8, 0xA5EA, 0x94A9, 0x8B07, 
+     0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x856A, 
+     0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x64E9, 
+     0xA5EA, 0x94A9, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x53A8, 0x8BC8, 
+     0xA5EA, 0xA509, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 
+     0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0x94A9, 0x8B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x6B28, 0x3C68, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x6B28, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, },
+    {0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xE615, 0xDCD0, 0x9CAD, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x748B, 0xC42F, 0xAB0C, 0x7B8B, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x7D4E, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x748B, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x63CA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x7C68, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 
+     0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 
+     0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 
+     0x7C28, 0x9B47, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 
+     0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 0x64E9, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x6D29, },
+    {0x6B28, 0x3C68, 0x4CA8, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x6D29, 
+     0x6B28, 0x4CA8, 0x6D29, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x856A, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 
+     0x8DAA, 0x6D29, 0x856A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0x8DAA, 0x5CE9, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x7428, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8287, 
+     0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 
+     0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 
+     0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x7428, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x7B88, 
+     0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 
+     0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 
+     0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x7428, 0x8BC8, 0xA5EA, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 
+     0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 
+     0x856A, 0xA5EA, 0x4CA8, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 
+     0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 
+     0x6D29, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x856A, },
+    {0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA5EA, 0x94A9, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x5CE9, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 
+     0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 
+     0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, },
+    {0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 
+     0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 
+     0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 
+     0x7428, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 
+     0x8DAA, 0x6D29, 0x7428, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8BC8, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x6B28, 
+     0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0x7D4A, 0x3C68, 
+     0xA509, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0x8DAA, 
+     0xA5EA, 0xA509, 0x9348, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0x8DAA, 
+     0xA5EA, 0x94A9, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, },
+    {0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 
+     0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 
+     0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 
+     0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 
+     0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x7D4A, 0x64E9, 
+     0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x7D4A, 0x4CA8, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 
+     0x94A9, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 
+     0x7D4A, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 
+     0x5CE9, 0x4CA8, 0x7428, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 
+     0x4CA8, 0x6D29, 0x7428, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x3C68, 0x4CA8, 0x856A, 0x7D4A, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 
+     0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 
+     0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x856A, 0xA5EA, 0x7D4A, 0x53A8, 
+     0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 
+     0x6D29, 0x64E9, 0xA5EA, 0x8DAA, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, },
+    {0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0xBEEA, 0x9E4A, 
+     0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xBEEA, 0xBEEA, 0xB68A, 0xA5EA, 
+     0x6D29, 0x5CE9, 0x64E9, 0xAE4A, 0xBEEA, 0xB68A, 0xA5EA, 0xA5EA, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 
+     0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xBEEA, 0xBEEA, 0xBEEA, 
+     0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 0xBEEA, 
+     0xA5EA, 0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 
+     0x6D29, 0x6D29, 0x6D29, 0x4CA8, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x3C68, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 
+     0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xB68A, 0xA5EA, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0xB68A, 0xA5EA, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x6D49, 0xBEEA, 0xB68A, 0xA5EA, 
+     0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, },
+    {0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 
+     0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 
+     0x7D4A, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 
+     0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 
+     0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 0xBEEA, 
+     0xA5EA, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0xAE4A, 0xBEEA, 0x8DEA, 
+     0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x4CA8, },
+    {0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x652F, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0x95F3, 0x6D29, 
+     0x6D29, 0x6D29, 0x5CE9, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x4CA8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, },
+    {0x85AF, 0xAE79, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAE79, 0xAE79, 0x9E18, 0x6511, 0x4CA8, 0x6D29, 0x85AF, 0xAE79, 
+     0xAE79, 0x9E18, 0x6511, 0x3C68, 0x3C68, 0x652F, 0xAE79, 0x9E18, 
+     0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x85AF, 0xAE79, 0x9E18, 0x7551, 
+     0x6D29, 0x5CE9, 0x3C68, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x3C68, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6511, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 
+     0xAE4A, 0xBEEA, 0xBEEA, 0xBEEA, 0x9E4A, 0x856A, 0xAE4A, 0x9E4A, 
+     0x6D29, 0x856A, 0xAE4A, 0xB68A, 0x8DAA, 0x856A, 0xA5EA, 0x8DAA, 
+     0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x64E9, 0xAE4A, 0xBEEA, 
+     0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 0xBEEA, 
+     0x3C68, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xAE4A, 0x8DEA, 
+     0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 
+     0x6D29, 0x5CE9, 0x4CA8, 0x5CE9, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, },
+    {0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 
+     0x6D29, 0x6D29, 0x54A8, 0x6D29, 0x8DCA, 0xBEEA, 0xB68A, 0xA5EA, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x856A, 0xAE4A, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 
+     0x7D4A, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x95F0, 0xD73C, 0xC6FB, 0x8DB7, 
+     0x6D29, 0x6D29, 0x6D29, 0x95F0, 0xD73C, 0xD73C, 0xC6FB, 0x9E18, 
+     0x6D29, 0x6D29, 0x6D29, 0x95F0, 0xD73C, 0xC6FB, 0x9E18, 0x74F5, 
+     0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0x9E18, 0x74F5, 0x6454, 
+     0x6D29, 0x6D29, 0x6D29, 0x754E, 0x7D76, 0x7D76, 0x74F5, 0x6454, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x754E, 0x7D76, 0x74F5, 0x8550, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0xAE79, 0x95F3, 
+     0x6490, 0x6D29, 0x85AF, 0xBEBA, 0xD73C, 0xD73C, 0xD73C, 0xC6FB, 
+     0x74F5, 0x6CB5, 0x9E18, 0xD73C, 0xD73C, 0xD73C, 0xD73C, 0xC6FB, 
+     0x6454, 0x7D16, 0xBEBA, 0xD73C, 0xD73C, 0xC6FB, 0xAE79, 0xAE79, 
+     0x6CB5, 0x8DD7, 0xBEBA, 0xD73C, 0xC6FB, 0x9E18, 0x7D76, 0x7D76, 
+     0x6CB5, 0x8DD7, 0xAE79, 0xAE79, 0x9E18, 0x74F5, 0x6454, 0x6454, 
+     0xBEEA, 0xB6D0, 0xAE79, 0x9E18, 0x74F5, 0x6454, 0x7D16, 0xAE79, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x8DD7, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6CB5, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x8DB7, 0x6490, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 
+     0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 
+     0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 
+     0x94A9, 0x8287, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 
+     0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x53A8, 
+     0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 
+     0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x6D49, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x7D4A, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 
+     0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0xAE4A, 0xBEEA, 0xBEEA, 0x8DEA, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xA5F2, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xE6F8, 0xA5F2, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xE6F8, 0xE615, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xBE52, 
+     0x9DCF, 0xE6F8, 0xBE52, 0x6D29, 0x9DCF, 0xE6F8, 0xE6F8, 0xBE52, 
+     0x9DCF, 0xE6F8, 0xE6F8, 0xE615, 0xDD93, 0xE6F8, 0xE6F8, 0xBE52, 
+     0x748B, 0xDD93, 0xE6F8, 0xE615, 0xDCD0, 0xDD93, 0xE615, 0x9CAD, 
+     0x3C68, 0x63CA, 0xBBAE, 0xC42F, 0xAB0C, 0xAB0C, 0x7B8B, 0x3C68, 
+     0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x7D4E, 
+     0xB4ED, 0x6D29, 0x5CE9, 0x4CA8, 0x5CE9, 0x3C68, 0x748B, 0xDD93, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6CCD, 0x6CB5, 0x9612, 0xBEEA, 
+     0x6D29, 0x6D29, 0x54A8, 0x5CE9, 0x3C68, 0x4C4D, 0x7CD0, 0xAE4A, 
+     0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0x8DEA, 0x3C68, 0x64E9, 0xA5EA, 
+     0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xB68A, 0xA630, 0xAE79, 0xAE79, 
+     0x6D29, 0x6D29, 0x6D29, 0x856A, 0x95AF, 0x8DD7, 0xAE79, 0x9E18, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x54CD, 0x7D76, 0x74F5, 0x544F, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, },
+    {0xBEEA, 0xB6D0, 0xAE79, 0x9E18, 0x74F5, 0x8D57, 0xD73C, 0xC6FB, 
+     0xB68A, 0x95AF, 0x7D76, 0x74F5, 0x6CB5, 0x9E18, 0xD73C, 0xC6FB, 
+     0x8D4E, 0x6CB5, 0x7D76, 0x74F5, 0x6CB5, 0x8DD7, 0xAE79, 0x9E18, 
+     0x85B3, 0x6D49, 0xBEEA, 0x9DEE, 0x6CB5, 0x7D76, 0x7D76, 0x7D76, 
+     0x8DB2, 0xAE4A, 0xBEEA, 0x9DEE, 0x6454, 0x6CB5, 0x7D76, 0x6511, 
+     0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 
+     0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 
+     0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, },
+    {0x9E18, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x9E18, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x7D76, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6511, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x754E, 0x7D76, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x652F, 0xAE79, 0xAE79, 0xAE79, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x754E, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 
+     0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x7551, 0x6D29, 0x6D29, 
+     0xAE79, 0x9E18, 0x7D76, 0x74F5, 0x6490, 0x6D29, 0x6D29, 0x6D29, 
+     0x9E18, 0x74F5, 0x6454, 0x544F, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 
+     0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 
+     0xBEEA, 0xBEEA, 0xBEEA, 0x9E4A, 0x856A, 0xAE4A, 0x9E4A, 0x6D29, 
+     0x856A, 0xAE4A, 0xB68A, 0x8DAA, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 
+     0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x64E9, 0xAE4A, 0xBEEA, 0xBEEA, 
+     0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 0xBEEA, 0x9E4A, 
+     0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xAE4A, 0x8DEA, 0x3C68, 
+     0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, },
+    {0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xE615, 0xDCD0, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x748B, 0xC42F, 0xAB0C, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x9CAD, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x63CA, 0xBBAE, 
+     0x7B8B, 0x7D4E, 0xE6F8, 0xBE52, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 
+     0x7D4E, 0xE6F8, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x748B, 0xDD93, 0xE6F8, 0xA5F2, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0x63CA, 0xAB0C, 0xBBAE, 0x9CAD, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 
+     0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x9CAD, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 
+     0x6D29, 0x85AF, 0xAE79, 0xAE79, 0x9E18, 0x6511, 0x4CA8, 0x6D29, 
+     0x3C68, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x3C68, 0x3C68, 0x652F, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x85AF, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0xAE79, 0x9E18, 0x6511, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 
+     0x9E4A, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 
+     0xBEEA, 0x9E4A, 0x856A, 0xAE4A, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 
+     0xB68A, 0x8DAA, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 
+     0xA5EA, 0x7D4A, 0x64E9, 0xAE4A, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, },
+    {0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x54CD, 0x8DD7, 0x9E18, 0x74F5, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0x85B3, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x652F, 0xAE79, 0x9E18, 0x7551, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x54CD, 0x74F5, 0x544F, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6454, 0x544F, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 
+     0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0x95F3, 
+     0x4CA8, 0x6D29, 0x5CE9, 0x54CD, 0x8DD7, 0xAE79, 0x9E18, 0x6511, 
+     0x4CA8, 0x5CE9, 0x3C68, 0x54CD, 0x7D76, 0x74F5, 0x544F, 0x3C68, 
+     0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x5CE9, 0x4CA8, 0x5CE9, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x652F, 0xAE79, 0x9E18, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x85AF, 0xAE79, 
+     0x95F3, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x652F, 0xAE79, 0x9E18, 
+     0x6511, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 
+     0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x9E18, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6511, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 
+     0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, },
+};
+static const unsigned short int bg_map[30][40] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 4, 4, 10, 11, 4, 4, 4, 12, 13, 14, 15, 16, 17, 15, 15, 15, 15, 15, 15, 15, 15, 15, 18, 19, 15, 15, 15, 15, 20, 21, },
+    {22, 23, 24, 25, 4, 26, 27, 28, 29, 30, 4, 4, 31, 32, 4, 4, 4, 33, 34, 35, 15, 36, 37, 15, 38, 39, 40, 15, 15, 15, 15, 15, 41, 15, 15, 15, 15, 42, 43, 44, },
+    {45, 46, 4, 4, 47, 48, 49, 4, 4, 4, 47, 50, 2, 51, 52, 53, 54, 12, 13, 14, 15, 16, 17, 15, 15, 55, 15, 15, 15, 15, 15, 15, 15, 56, 15, 15, 15, 15, 15, 57, },
+    {58, 59, 4, 4, 60, 61, 62, 4, 4, 4, 60, 63, 64, 65, 66, 67, 68, 33, 34, 35, 15, 36, 37, 15, 15, 15, 69, 15, 69, 15, 69, 15, 69, 15, 69, 15, 69, 15, 69, 70, },
+    {4, 4, 4, 4, 10, 71, 72, 73, 0, 1, 2, 74, 13, 75, 76, 77, 78, 79, 80, 81, 15, 82, 83, 84, 15, 15, 20, 15, 85, 86, 87, 88, 87, 88, 87, 89, 15, 15, 15, 82, },
+    {4, 4, 4, 4, 31, 90, 91, 92, 93, 94, 95, 96, 34, 97, 98, 99, 100, 101, 102, 103, 15, 104, 105, 106, 15, 42, 107, 108, 109, 110, 111, 112, 111, 112, 111, 113, 15, 114, 115, 116, },
+    {4, 4, 47, 50, 2, 117, 118, 119, 120, 121, 122, 12, 13, 14, 15, 123, 124, 125, 15, 126, 127, 128, 15, 16, 17, 126, 127, 128, 129, 130, 15, 15, 15, 15, 15, 16, 17, 15, 15, 126, },
+    {4, 4, 60, 131, 132, 133, 134, 135, 136, 137, 138, 33, 34, 35, 15, 139, 140, 141, 15, 142, 143, 144, 15, 36, 37, 142, 143, 144, 145, 146, 15, 15, 15, 15, 15, 36, 37, 15, 15, 142, },
+    {4, 4, 10, 147, 148, 149, 150, 4, 151, 152, 52, 153, 80, 81, 15, 15, 15, 154, 155, 156, 15, 15, 15, 82, 83, 157, 15, 15, 129, 130, 15, 154, 155, 156, 15, 16, 17, 15, 15, 158, },
+    {4, 4, 31, 159, 148, 160, 161, 4, 162, 163, 66, 164, 102, 103, 15, 15, 15, 165, 166, 167, 15, 15, 15, 104, 105, 168, 169, 170, 145, 146, 15, 165, 166, 167, 15, 36, 37, 15, 15, 171, },
+    {4, 172, 173, 174, 175, 176, 177, 178, 13, 14, 15, 15, 15, 126, 127, 128, 15, 15, 15, 179, 180, 15, 15, 15, 15, 82, 83, 181, 182, 183, 15, 15, 15, 184, 185, 186, 15, 187, 188, 189, },
+    {4, 190, 191, 4, 4, 4, 192, 193, 34, 35, 15, 15, 15, 142, 143, 144, 15, 15, 15, 194, 195, 196, 15, 15, 15, 104, 105, 197, 198, 199, 15, 15, 15, 200, 201, 15, 15, 202, 203, 204, },
+    {4, 4, 4, 205, 206, 4, 10, 11, 207, 208, 209, 210, 211, 15, 15, 15, 18, 19, 15, 15, 15, 15, 15, 15, 15, 21, 212, 213, 214, 215, 15, 15, 15, 216, 15, 15, 217, 218, 219, 86, },
+    {4, 4, 4, 220, 221, 222, 31, 32, 223, 224, 225, 226, 227, 228, 15, 15, 41, 15, 15, 15, 15, 15, 15, 15, 15, 229, 230, 231, 232, 233, 15, 15, 15, 234, 235, 15, 236, 15, 237, 238, },
+    {4, 4, 4, 4, 47, 50, 2, 239, 240, 241, 242, 243, 80, 81, 15, 244, 245, 246, 247, 248, 209, 208, 209, 210, 211, 15, 15, 187, 188, 189, 15, 249, 250, 251, 83, 252, 87, 253, 182, 183, },
+    {4, 4, 4, 4, 60, 131, 254, 255, 256, 257, 258, 259, 102, 103, 15, 260, 261, 262, 136, 263, 225, 224, 225, 226, 227, 228, 15, 202, 203, 204, 15, 264, 265, 266, 105, 267, 111, 268, 198, 199, },
+    {4, 4, 269, 270, 2, 117, 148, 149, 150, 12, 13, 14, 15, 154, 155, 271, 272, 4, 4, 273, 274, 275, 151, 79, 80, 81, 15, 15, 15, 15, 15, 15, 15, 249, 250, 276, 15, 15, 15, 15, },
+    {4, 4, 277, 278, 132, 279, 148, 160, 161, 33, 34, 35, 15, 165, 166, 280, 281, 4, 4, 282, 283, 284, 162, 259, 102, 103, 15, 15, 15, 15, 15, 15, 15, 264, 265, 285, 15, 15, 15, 15, },
+    {52, 53, 286, 287, 288, 289, 288, 290, 291, 12, 13, 14, 15, 244, 292, 293, 294, 295, 296, 297, 151, 79, 80, 81, 18, 19, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 18, 19, },
+    {66, 67, 298, 299, 225, 224, 225, 300, 301, 33, 34, 35, 15, 260, 302, 303, 304, 305, 306, 307, 162, 259, 102, 103, 41, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 41, 15, },
+    {180, 77, 78, 152, 52, 308, 52, 308, 52, 153, 80, 81, 15, 309, 272, 310, 45, 46, 4, 12, 13, 14, 15, 123, 124, 311, 312, 313, 314, 313, 315, 316, 317, 15, 15, 15, 15, 158, 76, 15, },
+    {195, 318, 100, 319, 66, 320, 66, 320, 66, 164, 102, 103, 15, 321, 281, 322, 58, 59, 4, 33, 34, 35, 15, 139, 140, 323, 324, 325, 326, 325, 327, 328, 329, 15, 15, 15, 15, 171, 98, 330, },
+    {15, 15, 15, 158, 76, 15, 15, 15, 15, 244, 292, 331, 209, 332, 294, 4, 4, 4, 4, 4, 333, 334, 209, 208, 209, 332, 294, 4, 4, 4, 4, 4, 335, 336, 211, 15, 15, 15, 15, 123, },
+    {15, 15, 15, 171, 98, 330, 15, 15, 15, 260, 302, 337, 225, 338, 304, 4, 4, 4, 4, 4, 339, 340, 225, 224, 225, 338, 304, 341, 342, 343, 4, 4, 4, 344, 227, 228, 15, 15, 15, 139, },
+    {209, 208, 209, 208, 209, 208, 209, 208, 209, 332, 294, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 345, 346, 4, 4, 4, 4, 347, 348, 349, 4, 350, 4, 12, 13, 14, 15, 15, 15, 15, },
+    {225, 224, 225, 224, 225, 224, 225, 224, 225, 338, 304, 4, 4, 4, 351, 352, 353, 4, 4, 4, 354, 355, 356, 4, 4, 4, 4, 357, 4, 4, 4, 4, 4, 33, 34, 35, 15, 15, 15, 15, },
+    {4, 4, 4, 4, 4, 4, 4, 358, 359, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 360, 4, 4, 4, 4, 4, 4, 4, 4, 4, 361, 362, 363, 333, 364, 211, 15, 15, 15, },
+    {4, 4, 4, 4, 4, 4, 4, 365, 366, 4, 4, 4, 4, 367, 368, 4, 4, 369, 370, 371, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 372, 373, 374, 339, 375, 227, 228, 15, 15, },
+    {4, 376, 377, 4, 4, 4, 4, 4, 4, 4, 4, 4, 378, 379, 380, 4, 4, 381, 382, 383, 4, 4, 4, 4, 4, 4, 384, 385, 386, 4, 4, 4, 4, 172, 387, 12, 13, 14, 15, 15, },
+    {4, 388, 389, 390, 4, 4, 4, 4, 4, 4, 4, 4, 4, 391, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 392, 393, 394, 4, 4, 395, 4, 190, 191, 33, 34, 35, 15, 15, },
+};
+const Background bg_background = {bg_tiles, bg_map};
+
+// cursor_sprite: 13x13
+const unsigned short int cursor_sprite[13][13] = {
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+     0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 
+     0x0000, },
+    {0x0000, 0x0000, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x0000, 0x0000, 
+     0x0000, },
+    {0x0000, 0x0000, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x0000, 
+     0x0000, },
+    {0x0000, 0xF800, 0xF800, 0xF800, 0x0000, 0xF800, 0xF800, 0x0000, 0xF800, 0xF800, 0xF800, 0x0000, 
+     0x0000, },
+    {0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0xF800, 0xF800, 
+     0xF800, },
+    {0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0xF800, 0xF800, 
+     0xF800, },
+    {0x0000, 0xF800, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0x0000, 
+     0x0000, },
+    {0x0000, 0x0000, 0xF800, 0xF800, 0x0000, 0xF800, 0xF800, 0x0000, 0xF800, 0xF800, 0xF800, 0x0000, 
+     0x0000, },
+    {0x0000, 0x0000, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x0000, 0x0000, 
+     0x0000, },
+    {0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 
+     0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+     0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xF800, 0xF800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
+     0x0000, },
+};
+
+// potion: 16x16
+const unsigned short int potion[16][16] = {
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3147, 0x3147, 0x3147, 0x3147, 0x3147, 0x20C5, 0x0000, 
+     0x0000, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x3147, 0xBCCF, 0xBCCF, 0xBCCF, 0xBCCF, 0xAC4F, 0x830D, 0x20C5, 
+     0x0000, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x3147, 0xAC4F, 0xAC4F, 0xAC4F, 0xAC4F, 0x830D, 0x830D, 0x20C5, 
+     0x0000, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3147, 0x830D, 0x830D, 0x830D, 0x830D, 0x20C5, 0x0000, 
+     0x0000, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A6, 0x84B5, 0x5B10, 0x10A6, 0x0000, 0x0000, 
+     0x0000, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630E, 0xADD9, 0x84B5, 0x420B, 0x0000, 0x0000, 
+     0x0000, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x630E, 0x630E, 0xCEDD, 0xADD9, 0x84B5, 0x6391, 0x420B, 0x420B, 
+     0x0000, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x630E, 0xCEDD, 0xCEDD, 0xADD9, 0xADD9, 0x84B5, 0x84B5, 0x6391, 0x530F, 
+     0x420B, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x48C6, 0xFE57, 0xDA09, 0xDA09, 0xDA09, 0xDA09, 0xD127, 0xC0C7, 0xC0C7, 0xA887, 
+     0x8826, 0x3044, 0x0000, 0x0000, },
+    {0x0000, 0x48C6, 0xFE57, 0xE30C, 0xDA09, 0xFE57, 0xDA09, 0xDA09, 0xDA09, 0xD127, 0xC0C7, 0xC0C7, 
+     0xA887, 0x8826, 0x3044, 0x0000, },
+    {0x0000, 0x48C6, 0xFE57, 0xDA09, 0xFE57, 0xFD31, 0xF42D, 0xDA09, 0xDA09, 0xD127, 0xE30C, 0xC0C7, 
+     0xA887, 0x8826, 0x3044, 0x0000, },
+    {0x0000, 0x3044, 0xFD31, 0xDA09, 0xDA09, 0xF42D, 0xDA09, 0xDA09, 0xDA09, 0xD127, 0xC0C7, 0xC0C7, 
+     0xD28A, 0x8826, 0x1082, 0x0000, },
+    {0x0000, 0x3044, 0xF42D, 0xDA09, 0xDA09, 0xDA09, 0xDA09, 0xE30C, 0xD127, 0xC0C7, 0xC0C7, 0xC0C7, 
+     0xA887, 0x8826, 0x1082, 0x0000, },
+    {0x0000, 0x0000, 0x3044, 0xF42D, 0xDA09, 0xDA09, 0xDA09, 0xD127, 0xC0C7, 0xC0C7, 0xC0C7, 0xA887, 
+     0x8826, 0x1082, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x3044, 0xD127, 0xD127, 0xD127, 0xC0C7, 0xC0C7, 0xE30C, 0xA887, 0x8826, 
+     0x1082, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 0x1082, 
+     0x0000, 0x0000, 0x0000, 0x0000, },
+};
+
+// empty_potion: 16x16
+const unsigned short int empty_potion[16][16] = {
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3147, 0x3147, 0x3147, 0x3147, 0x3147, 0x20C5, 0x0000, 
+     0x0000, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x3147, 0xBCCF, 0xBCCF, 0xBCCF, 0xBCCF, 0xAC4F, 0x830D, 0x20C5, 
+     0x0000, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x3147, 0xAC4F, 0xAC4F, 0xAC4F, 0xAC4F, 0x830D, 0x830D, 0x20C5, 
+     0x0000, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3147, 0x830D, 0x830D, 0x830D, 0x830D, 0x20C5, 0x0000, 
+     0x0000, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A6, 0x84B5, 0x5B10, 0x10A6, 0x0000, 0x0000, 
+     0x0000, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x630E, 0xADD9, 0x84B5, 0x420B, 0x0000, 0x0000, 
+     0x0000, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x630E, 0x630E, 0xCEDD, 0xADD9, 0x84B5, 0x6391, 0x420B, 0x420B, 
+     0x0000, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x630E, 0xCEDD, 0xCEDD, 0xADD9, 0xADD9, 0x84B5, 0x84B5, 0x6391, 0x530F, 
+     0x420B, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x630E, 0xCEDD, 0xADD9, 0xADD9, 0xADD9, 0xADD9, 0x9537, 0x84B5, 0x84B5, 0x6391, 
+     0x530F, 0x420B, 0x0000, 0x0000, },
+    {0x0000, 0x630E, 0xCEDD, 0xADD9, 0xADD9, 0xD71D, 0xADD9, 0xADD9, 0xADD9, 0x9537, 0x84B5, 0x84B5, 
+     0x6391, 0x530F, 0x420B, 0x0000, },
+    {0x0000, 0x630E, 0xCEDD, 0xADD9, 0xD71D, 0xCEDD, 0xBE3A, 0xADD9, 0xADD9, 0x9537, 0x84B5, 0x84B5, 
+     0x6391, 0x530F, 0x420B, 0x0000, },
+    {0x0000, 0x3189, 0xCEDD, 0xADD9, 0xADD9, 0xBE3A, 0xADD9, 0xADD9, 0xADD9, 0x9537, 0x84B5, 0x84B5, 
+     0x6391, 0x530F, 0x10A6, 0x0000, },
+    {0x0000, 0x3189, 0xBE3A, 0xADD9, 0xADD9, 0xADD9, 0xADD9, 0xADD9, 0x9537, 0x84B5, 0x84B5, 0x84B5, 
+     0x6391, 0x530F, 0x10A6, 0x0000, },
+    {0x0000, 0x0000, 0x3189, 0xBE3A, 0xADD9, 0xADD9, 0xADD9, 0x9537, 0x84B5, 0x84B5, 0x84B5, 0x6391, 
+     0x530F, 0x10A6, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x3189, 0x9537, 0x9537, 0x9537, 0x84B5, 0x84B5, 0x84B5, 0x6391, 0x530F, 
+     0x10A6, 0x0000, 0x0000, 0x0000, },
+    {0x0000, 0x0000, 0x0000, 0x0000, 0x10A6, 0x10A6, 0x10A6, 0x10A6, 0x10A6, 0x10A6, 0x10A6, 0x10A6, 
+     0x0000, 0x0000, 0x0000, 0x0000, },
+};
+
+const AssetInfo asset_manifest[18] = {
+    {"goblin_D_Attack", 48, 48, 6, 3104},
+    {"goblin_D_Walk", 48, 48, 6, 2980},
+    {"goblin_S_Attack", 48, 48, 6, 3126},
+    {"goblin_S_Walk", 48, 48, 6, 3004},
+    {"goblin_U_Walk", 48, 48, 6, 2960},
+    {"goblin_U_Attack", 48, 48, 6, 3104},
+    {"goblin_Death", 48, 48, 6, 2584},
+    {"wizard_idle", 16, 16, 6, 1378},
+    {"wizard_run", 16, 16, 6, 1370},
+    {"wizard_evade", 16, 16, 6, 1428},
+    {"wizard_hit", 16, 16, 3, 736},
+    {"wizard_attack", 16, 16, 6, 1712},
+    {"wizard_dying", 16, 16, 6, 1288},
+    {"wizard_decomposing", 16, 16, 6, 1006},
+    {"bg", 320, 240, 1, 53088},
+    {"cursor_sprite", 13, 13, 1, 338},
+    {"potion", 16, 16, 1, 512},
+    {"empty_potion", 16, 16, 1, 512},
+};
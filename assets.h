@@ -0,0 +1,143 @@
+// Generated by tools/build_assets.c from sprites.h and background.h - do not edit
+#ifndef ASSETS_H
+#define ASSETS_H
+
+// Sprite frame compiled into runs of opaque palette indices
+// Each row is stored as the number of runs in the row, then for every run the
+// transparent pixels to skip, the length of the run and its indices
+typedef struct RLESprite {
+  // Dimensions of the frame
+  unsigned short int width;
+  unsigned short int height;
+  // Bits per index, 4 with two indices to a byte, first in the low nibble,
+  // or 8
+  unsigned short int bits;
+  // RGB565 colour of each index of the sheet
+  const unsigned short int* palette;
+  // Encoded rows of the frame as drawn in the sheet [0] and mirrored
+  // horizontally [1], indexed by the reverse flag when drawing
+  const unsigned char* data[2];
+} RLESprite;
+
+// Arena background tiles
+#define BG_TILE_SHIFT 3
+#define BG_TILE_SIZE (1 << BG_TILE_SHIFT)
+#define BG_TILE_MASK (BG_TILE_SIZE - 1)
+#define BG_TILE_PIXELS (BG_TILE_SIZE * BG_TILE_SIZE)
+#define BG_MAP_COLUMNS 40
+#define BG_MAP_ROWS 30
+
+// Arena background split into tiles, each distinct tile is stored once
+typedef struct Background {
+  // Pixels of every tile, rows one after another
+  const unsigned short int (*tiles)[BG_TILE_PIXELS];
+  // Index into tiles of every tile on screen, row by row
+  const unsigned short int (*map)[BG_MAP_COLUMNS];
+} Background;
+
+// Entry of the asset manifest
+typedef struct AssetInfo {
+  const char* name;
+  // Dimensions of a single frame
+  unsigned short int width;
+  unsigned short int height;
+  unsigned short int frames;
+  // Size of the asset data
+  unsigned int bytes;
+} AssetInfo;
+
+#define GOBLIN_D_ATTACK_WIDTH 48
+#define GOBLIN_D_ATTACK_HEIGHT 48
+#define GOBLIN_D_ATTACK_FRAMES 6
+extern const RLESprite goblin_D_Attack_rle[6];
+
+#define GOBLIN_D_WALK_WIDTH 48
+#define GOBLIN_D_WALK_HEIGHT 48
+#define GOBLIN_D_WALK_FRAMES 6
+extern const RLESprite goblin_D_Walk_rle[6];
+
+#define GOBLIN_S_ATTACK_WIDTH 48
+#define GOBLIN_S_ATTACK_HEIGHT 48
+#define GOBLIN_S_ATTACK_FRAMES 6
+extern const RLESprite goblin_S_Attack_rle[6];
+
+#define GOBLIN_S_WALK_WIDTH 48
+#define GOBLIN_S_WALK_HEIGHT 48
+#define GOBLIN_S_WALK_FRAMES 6
+extern const RLESprite goblin_S_Walk_rle[6];
+
+#define GOBLIN_U_WALK_WIDTH 48
+#define GOBLIN_U_WALK_HEIGHT 48
+#define GOBLIN_U_WALK_FRAMES 6
+extern const RLESprite goblin_U_Walk_rle[6];
+
+#define GOBLIN_U_ATTACK_WIDTH 48
+#define GOBLIN_U_ATTACK_HEIGHT 48
+#define GOBLIN_U_ATTACK_FRAMES 6
+extern const RLESprite goblin_U_Attack_rle[6];
+
+#define GOBLIN_DEATH_WIDTH 48
+#define GOBLIN_DEATH_HEIGHT 48
+#define GOBLIN_DEATH_FRAMES 6
+extern const RLESprite goblin_Death_rle[6];
+
+#define WIZARD_IDLE_WIDTH 16
+#define WIZARD_IDLE_HEIGHT 16
+#define WIZARD_IDLE_FRAMES 6
+extern const RLESprite wizard_idle_rle[6];
+
+#define WIZARD_RUN_WIDTH 16
+#define WIZARD_RUN_HEIGHT 16
+#define WIZARD_RUN_FRAMES 6
+extern const RLESprite wizard_run_rle[6];
+
+#define WIZARD_EVADE_WIDTH 16
+#define WIZARD_EVADE_HEIGHT 16
+#define WIZARD_EVADE_FRAMES 6
+extern const RLESprite wizard_evade_rle[6];
+
+#define WIZARD_HIT_WIDTH 16
+#define WIZARD_HIT_HEIGHT 16
+#define WIZARD_HIT_FRAMES 3
+extern const RLESprite wizard_hit_rle[3];
+
+#define WIZARD_ATTACK_WIDTH 16
+#define WIZARD_ATTACK_HEIGHT 16
+#define WIZARD_ATTACK_FRAMES 6
+extern const RLESprite wizard_attack_rle[6];
+
+#define WIZARD_DYING_WIDTH 16
+#define WIZARD_DYING_HEIGHT 16
+#define WIZARD_DYING_FRAMES 6
+extern const RLESprite wizard_dying_rle[6];
+
+#define WIZARD_DECOMPOSING_WIDTH 16
+#define WIZARD_DECOMPOSING_HEIGHT 16
+#define WIZARD_DECOMPOSING_FRAMES 6
+extern const RLESprite wizard_decomposing_rle[6];
+
+#define BG_WIDTH 320
+#define BG_HEIGHT 240
+#define BG_FRAMES 1
+extern const Background bg_background;
+
+#define CURSOR_SPRITE_WIDTH 13
+#define CURSOR_SPRITE_HEIGHT 13
+#define CURSOR_SPRITE_FRAMES 1
+extern const unsigned short int cursor_sprite[13][13];
+
+#define POTION_WIDTH 16
+#define POTION_HEIGHT 16
+#define POTION_FRAMES 1
+extern const unsigned short int potion[16][16];
+
+#define EMPTY_POTION_WIDTH 16
+#define EMPTY_POTION_HEIGHT 16
+#define EMPTY_POTION_FRAMES 1
+extern const unsigned short int empty_potion[16][16];
+
+// Every asset above
+#define ASSET_COUNT 18
+extern const AssetInfo asset_manifest[ASSET_COUNT];
+
+#endif
@@ -0,0 +1,252 @@
+#ifndef BACKGROUND_H
+#define BACKGROUND_H
+
+// Source arena backgrounds in raw RGB565, one 320x240 screen each.
+// These are not compiled into the game. tools/build_assets.c splits them
+// into the tile atlases and tile maps in the asset module assets.c, which
+// the game restores the back buffer from.
+
+unsigned short int bg[240][320] = {
+    {0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x54A8, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x4467, 0x4467, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x754E, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x5449, 0x6D09, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x4C49, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x3C08, 0x5CC8, 0x856A, 0x64C9, 0x33C9, 0x3C08, 0x54A8, 0x7549, 0x6D09, 0x4467, 0x4467, 0x4467, 0x5CC8, 0x856A, 0x6D09, 0x4467, 0x3C28, 0x3C08, 0x6CCA, 0xAD8F, 0x850C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x754E, 0x7D76, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x33C9, 0x5C6B, 0x850C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x33C9, 0x5449, 0x856A, 0x6D09, 0x43A8, 0x5B69, 0x856A, 0x856A, 0x856A, 0x64C9, 0x33C9, 0x3C08, 0x5CC8, 0x856A, 0x64C9, 0x33C9, 0x5449, 0x856A, 0x856A, 0x856A, 0x64C9, 0x33C9, 0x3B8A, 0x73ED, 0xAD8F, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x7D76, 0x74F5, 0x6490, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0x9E18, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x5449, 0x856A, 0x856A, 0x64C9, 0x3329, 0x3AC9, 0x5449, 0x856A, 0x856A, 0x6C29, 0x3AC9, 0x5449, 0x856A, 0x856A, 0x64C9, 0x3329, 0x3AC9, 0x5449, 0x856A, 0x856A, 0x6C29, 0x4249, 0x4A8A, 0x738D, 0xA4CE, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x652F, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x74F5, 0x6454, 0x544F, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x8D0B, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x93AB, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x5B69, 0x856A, 0x856A, 0x6C29, 0x4249, 0x4249, 0x4249, 0x5B69, 0x856A, 0x6C29, 0x4249, 0x5B69, 0x856A, 0x64C9, 0x3329, 0x4249, 0x4249, 0x4249, 0x5B69, 0x856A, 0x6C29, 0x52CB, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0x9E18, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x54CD, 0x8DD7, 0x9E18, 0x74F5, 0x6454, 0x544F, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x856A, 0x7CCB, 0x5C0C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x8B6A, 0x736C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x9E18, },
+    {0x5B69, 0x856A, 0x748A, 0x4ACB, 0x4A8A, 0x530C, 0x530C, 0x4ACB, 0x4A8A, 0x530C, 0x4ACB, 0x4249, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x4A8A, 0x5B6D, 0x6BEE, 0x5B4C, 0x4A8A, 0x5B6D, 0x5C0C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x652F, 0xAE79, 0x8DB7, 0x544F, 0x3C68, 0x4CA8, 0x85AF, 0xAE79, 0xAE79, 0x95F3, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x85AF, 0xAE79, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x6D09, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x940E, 0xAE79, 0x8DB7, 0x73CF, },
+    {0x6BEE, 0x6BEE, 0x5B4C, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0x850C, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x85AF, 0xAE79, 0xAE79, 0x9E18, 0x6511, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x5CE9, 0x54CD, 0x8DD7, 0xAE79, 0x9E18, 0x6511, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5449, 0x856A, 0x6D09, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, },
+    {0x6BEE, 0x638D, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x83ED, 0x5B6D, 0x6BEE, 0x848F, 0xAD8F, 0xAD8F, 0xAD0E, 0x7C6C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x54CD, 0x8DD7, 0x8DB7, 0x544F, 0x3C68, 0x4CA8, 0x6D29, 0x85AF, 0xAE79, 0x85B3, 0x4CA8, 0x5CE9, 0x3C68, 0x54CD, 0x7D76, 0x74F5, 0x544F, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, 0xAD8F, 0x956D, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x844D, 0x4A8A, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x844D, 0x4A8A, 0x5B6D, 0x848F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x7B8C, 0x4A8A, 0x5B6D, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0x7C6C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x85AF, 0xAE79, 0x9E18, 0x7551, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x3C28, 0x5C6B, 0xAD8F, 0xAD8F, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0x9C49, 0x8509, 0x7C28, 0x9B07, 0x9B47, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, },
+    {0x844D, 0x4A8A, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x94EF, 0x638D, 0x4ACB, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 0xA46E, 0xA46E, 0xA4ED, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x5CE9, 0x54CD, 0x74F5, 0x544F, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0x9E18, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x956B, 0xAD8F, 0xAD8F, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x9469, 0x9B07, 0x83A7, 0x7408, 0x8B88, 0x94A9, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x7CAD, 0xA5EA, 0xA54C, 0xA46E, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 0xA46E, 0xA4ED, 0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x530C, 0x5B6D, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0x9E18, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x652F, 0xAE79, 0x8DB7, 0x544F, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7549, 0x856A, 0x7CCB, 0x6BEE, 0x7C0E, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x736C, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C28, 0x7509, 0x94A9, 0x9348, 0x8B88, 0x8D4A, 0x94A9, 0x9B88, 0x83A7, 0x7408, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA5EA, 0xA5EA, 0xA54C, 0xA46E, 0xA46E, 0x8C2E, 0x638D, 0x6C2B, 0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x638D, 0x6C2B, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x652F, 0xAE79, 0x8DB7, 0x544F, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x856A, 0x748A, 0x5B6D, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B0A, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0x9C49, 0x8509, 0x7C28, 0x9B07, 0x9B47, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x83A7, 0x7408, 0x8287, 0x8B88, 0x8509, 0x7C68, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, },
+    {0xA5EA, 0x84CB, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x6C2B, 0xA5EA, 0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x5C0C, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5449, 0x856A, 0x956B, 0x850C, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x9469, 0x9B07, 0x83A7, 0x7408, 0x8B88, 0x94A9, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x83A7, 0x7408, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, },
+    {0x64E9, 0x84CB, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x63AA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3B89, 0x4249, 0x4A8A, 0x530C, 0x5B6D, 0x5C0C, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5C6B, 0xAD8F, 0xAD0E, 0x7C6C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA4CE, 0xAD8F, 0xA48C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C28, 0x7509, 0x94A9, 0x9348, 0x8B88, 0x8D4A, 0x94A9, 0x9B88, 0x83A7, 0x7408, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x3C68, 0x3C68, 0x4C2B, 0x6BEE, 0x638D, 0x530C, 0x4ACB, 0x3B09, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5C0B, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x9BEB, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x83A7, 0x7408, 0x8287, 0x8B88, 0x8509, 0x7C68, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x3B8A, 0x5B6D, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x7B8C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x83A7, 0x7408, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x4467, 0x4467, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x7549, 0x6D09, 0x4467, 0x4467, 0x4467, 0x5CC8, 0x856A, 0x6D09, 0x4467, 0x3C28, 0x3C08, 0x6CCA, 0xAD8F, 0x850C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9BA8, 0x9BA8, 0x9BA8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xE6F8, 0xBE52, 0x6D29, 0x9DCF, 0xE6F8, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x54A8, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x3C08, 0x5CC8, 0x856A, 0x64C9, 0x33C9, 0x5449, 0x856A, 0x856A, 0x856A, 0x64C9, 0x33C9, 0x3B8A, 0x73ED, 0xAD8F, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xCEB2, 0xCEB2, },
+    {0xE6F8, 0xE6F8, 0xE615, 0xDD93, 0xE6F8, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x6D09, 0x4467, 0x4467, 0x4467, 0x4467, 0x4467, 0x5CC8, 0x6D09, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x6D09, 0x4467, 0x4467, 0x3C28, 0x5449, 0x856A, 0x856A, 0x64C9, 0x3329, 0x3AC9, 0x5449, 0x856A, 0x856A, 0x6C29, 0x4249, 0x4A8A, 0x738D, 0xA4CE, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x93AB, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xCEB2, 0xCEB2, 0xCEB2, },
+    {0xDD93, 0xE6F8, 0xE615, 0xDCD0, 0xDD93, 0xE615, 0x9CAD, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x856A, 0x6D09, 0x4467, 0x4467, 0x4467, 0x5CC8, 0x856A, 0x856A, 0x6D09, 0x4467, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x856A, 0x6D09, 0x4467, 0x43A8, 0x5B69, 0x856A, 0x64C9, 0x3329, 0x4249, 0x4249, 0x4249, 0x5B69, 0x856A, 0x6C29, 0x52CB, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x8B6A, 0x736C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA54B, 0xA54B, 0xB5CE, 0xB5AE, },
+    {0x63CA, 0xBBAE, 0xC42F, 0xAB0C, 0xAB0C, 0x7B8B, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x64C9, 0x33C9, 0x33C9, 0x33C9, 0x5449, 0x856A, 0x6D09, 0x4467, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x64C9, 0x33C9, 0x3329, 0x4249, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x4A8A, 0x5B6D, 0x6BEE, 0x5B4C, 0x4A8A, 0x5B6D, 0x5C0C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA449, 0xB5CE, },
+    {0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x7D4E, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5449, 0x856A, 0x64C9, 0x3329, 0x4249, 0x3AC9, 0x5449, 0x856A, 0x64C9, 0x4C49, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5449, 0x856A, 0x64C9, 0x3329, 0x4249, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0x850C, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B47, 0x9B88, 0x9B07, 0x9BE9, },
+    {0x6D29, 0x5CE9, 0x4CA8, 0x5CE9, 0x3C68, 0x748B, 0xDD93, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, 0xAD8F, 0x844D, 0x4249, 0x6B6B, 0xAD8F, 0x7CCD, 0x33C9, 0x4C49, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, 0xAD8F, 0x844D, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x83ED, 0x5B6D, 0x6BEE, 0x848F, 0xAD8F, 0xAD8F, 0xAD0E, 0x7C6C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8AC7, 0x9B07, 0x92E7, 0x8287, },
+    {0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x63CA, 0xBBAE, 0x9CAD, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x3C28, 0x5C6B, 0xAD8F, 0xAD8F, 0xAD0E, 0xA46E, 0xA4CE, 0xAD8F, 0xAD8F, 0x7CCD, 0x3C08, 0x4467, 0x4467, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x3C28, 0x5C6B, 0xAD8F, 0xAD8F, 0xAD0E, 0x83ED, 0x5B6D, 0x848F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x7B8C, 0x4A8A, 0x5B6D, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0x7C6C, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xAD8F, 0xA48C, 0x9BE9, 0xA54B, },
+    {0x7D4E, 0xE6F8, 0xBE52, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x956B, 0xAD8F, 0xAD8F, 0xAD0E, 0xA46E, 0xA4CE, 0xAD8F, 0xAD8F, 0x9D6D, 0x6D09, 0x4467, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x956B, 0xAD8F, 0xAD8F, 0xAD0E, 0x7B8C, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 0xA46E, 0xA46E, 0xA4ED, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x6C6C, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xAD8F, 0xBDF0, 0xB5AE, 0x946A, },
+    {0xE6F8, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7549, 0x856A, 0x7CCB, 0x6BEE, 0x7C0E, 0xA46E, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 0x746D, 0x856A, 0x7D49, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7549, 0x856A, 0x7CCB, 0x6BEE, 0x7C0E, 0xA46E, 0x7B8C, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 0xA46E, 0xA4ED, 0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x530C, 0x5B6D, 0x6C6C, 0x5CE9, 0x64E9, 0xA5EA, 0x7D4A, 0x53A8, 0x8BC8, 0xA5EA, 0x8DAA, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x736C, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB54F, 0xB5AE, 0xA4EC, 0xCEB2, },
+    {0xDD93, 0xE6F8, 0xA5F2, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x856A, 0x6C29, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x5B4C, 0x5B69, 0x856A, 0x6D09, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x856A, 0x6C29, 0x52CB, 0x6BEE, 0x5B4C, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x638D, 0x6C2B, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x53A8, 0x8BC8, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8BC8, 0xA5EA, 0xA509, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B0A, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8CF0, 0xCEB2, 0xCEB2, 0xBD4E, },
+    {0xAB0C, 0xBBAE, 0x9CAD, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5449, 0x856A, 0x956B, 0x8C8E, 0x6C2B, 0xA5EA, 0x84CB, 0x73ED, 0x9D6D, 0x856A, 0x64C9, 0x3C08, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5449, 0x856A, 0x956B, 0x8C8E, 0x6C2B, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x5C0C, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x64E9, 0xA509, 0x9348, 0x8BC8, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x846E, 0xBE2F, 0x9C6A, 0x9B07, },
+    {0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5C6B, 0xAD8F, 0xADAD, 0xA5EA, 0xA5EA, 0xA54C, 0xA4CE, 0xAD8F, 0x7CCD, 0x4C49, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5C6B, 0xAD8F, 0xADAD, 0xA5EA, 0xA5EA, 0x7D4A, 0x3B89, 0x4249, 0x4A8A, 0x530C, 0x5B6D, 0x5C0C, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA4CE, 0xAD8F, 0xA48C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4AD, 0x9C6A, 0x9B07, 0x9B47, },
+    {0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5C0B, 0x8C2E, 0x7CAD, 0x7D4A, 0x646A, 0xA46E, 0x742C, 0x3C08, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5C0B, 0x8C2E, 0x7CAD, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x9BEB, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46E, 0x93AB, 0x8B07, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x3B8A, 0x4B8A, 0x4448, 0x5449, 0x5C2B, 0x638D, 0x434B, 0x3C08, 0x4467, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x3B8A, 0x4B8A, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0x8C48, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x7B8C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x5449, 0x6D09, 0x3C68, 0x3C68, 0x3C68, 0x43E9, 0x4BAA, 0x4467, 0x4467, 0x4467, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x54A8, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x4467, 0x4467, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x33C9, 0x5C6B, 0x850C, 0x4448, 0x4C49, 0x64CB, 0xAD8F, 0x852C, 0x3C28, 0x3C08, 0x4467, 0x5CC8, 0x856A, 0x6D09, 0x4467, 0x4467, 0x4467, 0x5CC8, 0x7D49, 0x64E8, 0x4467, 0x3C28, 0x5449, 0x6D09, 0x3C28, 0x33C9, 0x4C49, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x3C08, 0x5CC8, 0x856A, 0x64C9, 0x33C9, 0x3C08, 0x54A8, 0x7549, 0x6D09, 0x4467, 0x4467, 0x4467, 0x5CC8, 0x856A, 0x6D09, 0x4467, 0x3C28, 0x3C08, 0x6CCA, 0xAD8F, 0x850C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0xA48C, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B47, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B47, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0xA48C, 0x92E7, 0x8B07, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, 0xAD0E, 0x844C, 0x744B, 0xA4CE, 0xAD8F, 0x8C8E, 0x434B, 0x33C9, 0x5449, 0x856A, 0x856A, 0x856A, 0x64C9, 0x33C9, 0x5449, 0x856A, 0x6D09, 0x3C28, 0x33C9, 0x5449, 0x856A, 0x64C9, 0x3329, 0x3AC9, 0x33C9, 0x5449, 0x856A, 0x6D09, 0x43A8, 0x5B69, 0x856A, 0x856A, 0x856A, 0x64C9, 0x33C9, 0x3C08, 0x5CC8, 0x856A, 0x64C9, 0x33C9, 0x5449, 0x856A, 0x856A, 0x856A, 0x64C9, 0x33C9, 0x3B8A, 0x73ED, 0xAD8F, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0x9C6C, 0x8287, 0x8AC7, 0x9B07, 0xA3EA, 0xAD8F, 0xAD8F, 0xACEC, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x92E7, 0x8AC7, 0x9B47, 0xA3C8, 0x9348, 0x8B07, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B07, 0x92E7, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x92E7, 0x8AC7, 0x9B47, 0xA3C8, 0x9348, 0x8B07, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B07, 0x92E7, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x92E7, 0x8AC7, 0x9B47, 0xA3C8, 0x9348, 0x8B07, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B07, 0x92E7, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0x9C6C, 0x8287, 0x8AC7, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x8D0B, 0xA46E, 0x844C, 0x744B, 0xA4CE, 0xAD0E, 0x83ED, 0x4ACB, 0x4249, 0x5B69, 0x856A, 0x856A, 0x64C9, 0x3329, 0x3AC9, 0x5449, 0x856A, 0x856A, 0x64C9, 0x3329, 0x5B69, 0x856A, 0x856A, 0x6C29, 0x3AC9, 0x5449, 0x856A, 0x856A, 0x64C9, 0x3329, 0x3AC9, 0x5449, 0x856A, 0x856A, 0x6C29, 0x3AC9, 0x5449, 0x856A, 0x856A, 0x64C9, 0x3329, 0x3AC9, 0x5449, 0x856A, 0x856A, 0x6C29, 0x4249, 0x4A8A, 0x738D, 0xA4CE, 0xAD0E, 0x8CAC, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD0E, 0x83ED, 0x62EA, 0x8287, 0x8B2A, 0xA4CE, 0xAD8F, 0xAD8F, 0xA48C, 0x92E7, 0x8B07, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x93AA, 0xAD8F, 0xAD8F, 0xA48C, 0x9B07, 0x92E7, 0x8287, 0x8AC7, 0xA3EA, 0xAD8F, 0xAD8F, 0x94EF, 0x638D, 0x62EA, 0x8287, 0x8287, 0x93AA, 0xAD8F, 0xAD8F, 0xA48C, 0x9B07, 0x92E7, 0x8287, 0x8AC7, 0xA3EA, 0xAD8F, 0xAD8F, 0x94EF, 0x638D, 0x62EA, 0x8287, 0x8287, 0x93AA, 0xAD8F, 0xAD8F, 0xA48C, 0x9B07, 0x92E7, 0x8287, 0x8AC7, 0xA3EA, 0xAD8F, 0xAD8F, 0x94EF, 0x638D, 0x62EA, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD0E, 0x83ED, 0x62EA, 0x8287, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x856A, 0x7CCB, 0x5C0C, 0x646A, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 0x5B4C, 0x5B69, 0x856A, 0x6C29, 0x4249, 0x4249, 0x4249, 0x3AC9, 0x5449, 0x856A, 0x6C29, 0x4249, 0x4249, 0x5B69, 0x856A, 0x6C29, 0x4249, 0x5B69, 0x856A, 0x856A, 0x6C29, 0x4249, 0x4249, 0x4249, 0x5B69, 0x856A, 0x6C29, 0x4249, 0x5B69, 0x856A, 0x64C9, 0x3329, 0x4249, 0x4249, 0x4249, 0x5B69, 0x856A, 0x6C29, 0x52CB, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x638D, 0x530C, 0x5B6D, 0x7C0E, 0xA46E, 0xA46E, 0x9BEB, 0x92E7, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B2A, 0xA46E, 0xA4CE, 0xAD8F, 0xAD8F, 0x8C8E, 0x62EA, 0x8287, 0x8B2A, 0xA4CE, 0xAD8F, 0xAD0E, 0x83ED, 0x530C, 0x4ACB, 0x5A48, 0x8B2A, 0xA46E, 0xA4CE, 0xAD8F, 0xAD8F, 0x8C8E, 0x62EA, 0x8287, 0x8B2A, 0xA4CE, 0xAD8F, 0xAD0E, 0x83ED, 0x530C, 0x4ACB, 0x5A48, 0x8B2A, 0xA46E, 0xA4CE, 0xAD8F, 0xAD8F, 0x8C8E, 0x62EA, 0x8287, 0x8B2A, 0xA4CE, 0xAD8F, 0xAD0E, 0x83ED, 0x530C, 0x4ACB, 0x62C9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x638D, 0x530C, 0x5B6D, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x6D09, 0x3C68, 0x3C68, 0x4C2B, 0x638D, 0x4ACB, 0x52CB, 0x6BEE, 0x638D, 0x4ACB, 0x4A8A, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0x844D, 0x4249, 0x4249, 0x52CB, 0x6BEE, 0x638D, 0x530C, 0x4ACB, 0x5B69, 0x856A, 0x748A, 0x4ACB, 0x4A8A, 0x530C, 0x530C, 0x4ACB, 0x4A8A, 0x530C, 0x4ACB, 0x4249, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x4A8A, 0x5B6D, 0x6BEE, 0x5B4C, 0x4A8A, 0x5B6D, 0x5C0C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B0A, 0x638D, 0x4ACB, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0x9C6C, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x7B09, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x638D, 0x62EA, 0x8B2A, 0xA46E, 0x8C2E, 0x6BEE, 0x638D, 0x4ACB, 0x4A8A, 0x530C, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x638D, 0x62EA, 0x8B2A, 0xA46E, 0x8C2E, 0x6BEE, 0x638D, 0x4ACB, 0x4A8A, 0x530C, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x638D, 0x62EA, 0x8B2A, 0xA46E, 0x8C2E, 0x6BEE, 0x638D, 0x4ACB, 0x4A8A, 0x6B0A, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B0A, 0x638D, 0x4ACB, 0x4A8A, 0x5B6D, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5449, 0x856A, 0x6D09, 0x4448, 0x5449, 0x4C49, 0x64CB, 0xAD8F, 0xAD8F, 0x8C8E, 0x4ACB, 0x4A8A, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x844D, 0x52CB, 0x6BEE, 0x6BEE, 0x5B4C, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x5B4C, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0x850C, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0xAD8F, 0x8C8E, 0x4ACB, 0x4A8A, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x7B09, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x6BEE, 0x5B4C, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0x844D, 0x4A8A, 0x530C, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x6BEE, 0x5B4C, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0x844D, 0x4A8A, 0x530C, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x6BEE, 0x5B4C, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0x844D, 0x4A8A, 0x6B0A, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0xAD8F, 0x8C8E, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, 0xAD8F, 0x8D0C, 0x4C49, 0x646A, 0xA4CE, 0xAD8F, 0xAD8F, 0x94EF, 0x6BEE, 0x638D, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x5B6D, 0x6BEE, 0x638D, 0x4ACB, 0x4A8A, 0x5B6D, 0x6BEE, 0x638D, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x83ED, 0x5B6D, 0x6BEE, 0x848F, 0xAD8F, 0xAD8F, 0xAD0E, 0x7C6C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x7B88, 0x6D29, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA4CE, 0xAD8F, 0xAD8F, 0x94EF, 0x6BEE, 0x638D, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x62EA, 0x8287, 0x93AA, 0xAD8F, 0xACEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0x9C6C, 0x72C9, 0x530C, 0x530C, 0x530C, 0x530C, 0x5B6D, 0x6BEE, 0x638D, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x530C, 0x530C, 0x530C, 0x530C, 0x5B6D, 0x6BEE, 0x638D, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x530C, 0x530C, 0x530C, 0x530C, 0x5B6D, 0x6BEE, 0x638D, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x62EA, 0x8287, 0x93AA, 0xAD8F, 0xACEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA4CE, 0xAD8F, 0xAD8F, 0x94EF, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x3C28, 0x5C6B, 0xAD8F, 0xAD8F, 0xAD0E, 0x7C6C, 0x646A, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 0x638D, 0x4ACB, 0x630B, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x94EF, 0x638D, 0x5B6D, 0x638D, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0x844D, 0x4A8A, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x844D, 0x4A8A, 0x5B6D, 0x848F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x7B8C, 0x4A8A, 0x5B6D, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0x7C6C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0x9348, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 0x638D, 0x4ACB, 0x630B, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x94EF, 0x638D, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xACEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0x9C49, 0x8509, 0x7C28, 0x9B07, 0x9B47, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0x9C49, 0x8509, 0x7C28, 0x9B07, 0x9B47, 0x9B88, 0x93E8, 0x9D4C, 0xAD0E, 0x83ED, 0x530C, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x844D, 0x4A8A, 0x530C, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x844D, 0x4A8A, 0x530C, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x844D, 0x630B, 0xA4CE, 0xAD8F, 0xAD8F, 0xACEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x956B, 0xAD8F, 0xAD8F, 0xAD0E, 0x844C, 0x5C2B, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x63AA, 0xA5EA, 0xA54C, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x6BEE, 0x5B4C, 0x4A8A, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0x844D, 0x4A8A, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x94EF, 0x638D, 0x4ACB, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 0xA46E, 0xA46E, 0xA4ED, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x4A8A, 0x530C, 0x738D, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x6BEE, 0x5B4C, 0x630B, 0xA4CE, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x9469, 0x9B07, 0x83A7, 0x7408, 0x8B88, 0x94A9, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x9469, 0x9B07, 0x83A7, 0x7408, 0x8B88, 0x94A9, 0x9B88, 0x93E8, 0x8D4A, 0x9D4C, 0xAD0E, 0x83ED, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x94EF, 0x638D, 0x530C, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x94EF, 0x638D, 0x530C, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x94EF, 0x638D, 0x738D, 0xA4CE, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7549, 0x856A, 0x7CCB, 0x6BEE, 0x7C0E, 0xA46E, 0x844C, 0x5C2B, 0x638D, 0x530C, 0x4ACB, 0x63AA, 0xA5EA, 0xA5EA, 0xA54C, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 0x5B4C, 0x4249, 0x52CB, 0x7C0E, 0xA46E, 0xA46E, 0x8C2E, 0x7CAD, 0xA5EA, 0xA54C, 0xA46E, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 0xA46E, 0xA4ED, 0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x530C, 0x5B6D, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x638D, 0x530C, 0x4ACB, 0x5A48, 0x6A68, 0x4A8A, 0x738D, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 0x5B4C, 0x630B, 0xA46E, 0x9BEB, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C28, 0x7509, 0x94A9, 0x9348, 0x8B88, 0x8D4A, 0x94A9, 0x9B88, 0x83A7, 0x7408, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C28, 0x7509, 0x94A9, 0x9348, 0x8B88, 0x8D4A, 0x94A9, 0x9B88, 0x83A7, 0x7408, 0x8AC7, 0x9B8A, 0x7B8C, 0x52CB, 0x7C0E, 0xA46E, 0xA46E, 0x8C2E, 0x5B4C, 0x4A8A, 0x738D, 0xA46E, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x52CB, 0x7C0E, 0xA46E, 0xA46E, 0x8C2E, 0x5B4C, 0x4A8A, 0x738D, 0xA46E, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x52CB, 0x7C0E, 0xA46E, 0xA46E, 0x8C2E, 0x5B4C, 0x4A8A, 0x738D, 0xA46E, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x638D, 0x738D, 0xA46E, 0x9BEB, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9E18, 0x7D76, 0x8CD1, 0xA3C8, 0x8BCA, 0x638D, 0x530C, 0x4ACB, 0x5A48, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x856A, 0x748A, 0x5B6D, 0x640C, 0x4C49, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x84CB, 0x5B6D, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x7CAD, 0xA5EA, 0xA5EA, 0x84CB, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x7CAD, 0xA5EA, 0xA5EA, 0xA54C, 0xA46E, 0xA46E, 0x8C2E, 0x638D, 0x6C2B, 0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x638D, 0x6C2B, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8287, 0x72C9, 0x5B6D, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x52CB, 0x6BEE, 0x736C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x83A7, 0x7408, 0x8287, 0x8B88, 0x8509, 0x7C68, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x83A7, 0x7408, 0x8287, 0x8B88, 0x8509, 0x7C68, 0xA3C8, 0xA3C8, 0x9348, 0x7B0A, 0x6BEE, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x638D, 0x4ACB, 0x4A8A, 0x738D, 0xA46E, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 0x6BEE, 0x638D, 0x530C, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x638D, 0x4ACB, 0x4A8A, 0x738D, 0xA46E, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 0x6BEE, 0x638D, 0x530C, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x638D, 0x4ACB, 0x4A8A, 0x738D, 0xA46E, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x736C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA44E, 0xAE79, 0xAE79, 0x9D12, 0xA3C8, 0xA3C8, 0xA3C8, 0x6CB5, 0x7D76, 0x7D76, 0x7D76, 0x7C50, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5449, 0x856A, 0x956B, 0x850C, 0x3C68, 0x4448, 0x5449, 0x5449, 0x4C49, 0x3C68, 0x3C68, 0x64E9, 0x7D4A, 0x4C2B, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x7CAD, 0xA5EA, 0xA5EA, 0xA5EA, 0x84CB, 0x5B6D, 0x6BEE, 0x638D, 0x6C2B, 0xA5EA, 0x84CB, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x6C2B, 0xA5EA, 0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x5C0C, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8287, 0x8B07, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x7B0A, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x638D, 0x4ACB, 0x5A48, 0x7B0A, 0x638D, 0x73ED, 0xAD8F, 0xACEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x83A7, 0x7408, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x83A7, 0x7408, 0x8AC7, 0x9B47, 0xA46A, 0xAD8F, 0x8C8E, 0x5B6D, 0x736C, 0x72C9, 0x5B6D, 0x6BEE, 0x638D, 0x530C, 0x62EA, 0x72C9, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x530C, 0x4ACB, 0x5A48, 0x8287, 0x72C9, 0x5B6D, 0x6BEE, 0x638D, 0x530C, 0x62EA, 0x72C9, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x530C, 0x4ACB, 0x5A48, 0x8287, 0x72C9, 0x5B6D, 0x6BEE, 0x638D, 0x530C, 0x62EA, 0x72C9, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x530C, 0x4ACB, 0x5A48, 0x7B0A, 0x638D, 0x73ED, 0xAD8F, 0xACEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x946D, 0x8DD7, 0xAE79, 0x9E18, 0x7C50, 0xA3C8, 0x7B2C, 0x6454, 0x6454, 0x6CB5, 0x7D76, 0x7C50, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5C6B, 0xAD8F, 0xAD0E, 0x7C6C, 0x4448, 0x5449, 0x5449, 0x4C49, 0x4448, 0x5449, 0x4C49, 0x4448, 0x5449, 0x5C2B, 0x638D, 0x530C, 0x4ACB, 0x4249, 0x63AA, 0xA5EA, 0xA5EA, 0x7D4A, 0x43E9, 0x530C, 0x530C, 0x4B8A, 0x64E9, 0x84CB, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x63AA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3B89, 0x4249, 0x4A8A, 0x530C, 0x5B6D, 0x5C0C, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x7B0A, 0x638D, 0x530C, 0x4ACB, 0x4249, 0x6288, 0x9B07, 0x7B09, 0x738D, 0xA4CE, 0xA48C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0x9B88, 0x9B07, 0xA3EA, 0xAD0E, 0x83ED, 0x6B0A, 0x92E7, 0x72C9, 0x530C, 0x530C, 0x62EA, 0x8287, 0x72C9, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x5A48, 0x8AC7, 0x9B07, 0x92E7, 0x72C9, 0x530C, 0x530C, 0x62EA, 0x8287, 0x72C9, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x5A48, 0x8AC7, 0x9B07, 0x92E7, 0x72C9, 0x530C, 0x530C, 0x62EA, 0x8287, 0x72C9, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x5A48, 0x8AC7, 0x7B09, 0x738D, 0xA4CE, 0xA48C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x8BED, 0x7D76, 0x74F5, 0x6BAF, 0x8287, 0xA3C8, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5C0B, 0xA46E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C49, 0x3C68, 0x64E9, 0xA5EA, 0x854A, 0x4C49, 0x4448, 0x5449, 0x4C49, 0x3C68, 0x3C68, 0x3C68, 0x4C2B, 0x6BEE, 0x638D, 0x530C, 0x4ACB, 0x3B09, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C08, 0x3BC8, 0x4CA8, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA40A, 0xA46E, 0x93AB, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0x9348, 0x8B2A, 0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x92E7, 0x7B0A, 0x6BEE, 0x638D, 0x530C, 0x4ACB, 0x5A48, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x92E7, 0x7B0A, 0x6BEE, 0x638D, 0x530C, 0x4ACB, 0x5A48, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x92E7, 0x7B0A, 0x6BEE, 0x638D, 0x530C, 0x4ACB, 0x5A48, 0x8AC7, 0x9B47, 0xA3C8, 0xA40A, 0xA46E, 0x93AB, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x3B8A, 0x5B6D, 0x640C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C49, 0x3C68, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C49, 0x4448, 0x5449, 0x5449, 0x5449, 0x4C49, 0x3C68, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x4C49, 0x3C68, 0x3C68, 0x3C68, 0x3C08, 0x5428, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x7B09, 0x5B6D, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x4467, 0x4467, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5CA9, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x93AA, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x7549, 0x6D09, 0x4467, 0x4467, 0x4467, 0x5CC8, 0x856A, 0x6D09, 0x4467, 0x3C28, 0x3C08, 0x6CCA, 0xAD8F, 0x850C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xB5EB, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x93AA, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x3C08, 0x5CC8, 0x856A, 0x64C9, 0x33C9, 0x5449, 0x856A, 0x856A, 0x856A, 0x64C9, 0x33C9, 0x3B8A, 0x73ED, 0xAD8F, 0xAD0E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0x854A, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x6469, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0xA5AB, 0xBD4B, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0xACEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0xACEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x93AA, 0xAD8F, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x6D09, 0x4467, 0x4467, 0x3C28, 0x5449, 0x856A, 0x856A, 0x64C9, 0x3329, 0x3AC9, 0x5449, 0x856A, 0x856A, 0x6C29, 0x4249, 0x4A8A, 0x738D, 0xA4CE, 0xAD0E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x6469, 0xA5EA, 0xA5EA, 0x854A, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x6469, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xB5EB, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x93AB, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8B2A, 0xA46E, 0x9BEB, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x93AB, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x856A, 0x6D09, 0x4467, 0x43A8, 0x5B69, 0x856A, 0x64C9, 0x3329, 0x4249, 0x4249, 0x4249, 0x5B69, 0x856A, 0x6C29, 0x52CB, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0x7D09, 0x3B88, 0x3BC8, 0x64E9, 0xA5EA, 0xA5EA, 0x7D09, 0x43C8, 0x5449, 0x6CE9, 0xA5EA, 0x854A, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x3BC8, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xB5EB, 0x94A9, 0xA3C8, 0xA3C8, 0xB4AA, 0xCE4C, 0xBD4B, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0xA46E, 0x83ED, 0x738D, 0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x8B6A, 0x736C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0xA46E, 0x83ED, 0x738D, 0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x7B0A, 0x7B8C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x8B6A, 0x736C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x64C9, 0x33C9, 0x3329, 0x4249, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x4A8A, 0x5B6D, 0x6BEE, 0x5B4C, 0x4A8A, 0x5B6D, 0x5C0C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x854A, 0x6CE9, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0x7D09, 0x3B88, 0x43C8, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0x854A, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xCE4C, 0xBD4B, 0xA3C8, 0xA3C8, 0xB4AA, 0xCE4C, 0xBD4B, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x8C2E, 0x5B4C, 0x52CB, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x8C2E, 0x5B4C, 0x52CB, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5449, 0x856A, 0x64C9, 0x3329, 0x4249, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0x850C, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x7D09, 0x3B88, 0x6469, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5C89, 0x3B88, 0x3BC8, 0x3C68, 0x64E9, 0xA5EA, 0x7D09, 0x3B88, 0x6469, 0xA5EA, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0xB4AA, 0xCE4C, 0xBD4B, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, 0xAD8F, 0x844D, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x83ED, 0x5B6D, 0x6BEE, 0x848F, 0xAD8F, 0xAD8F, 0xAD0E, 0x7C6C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0x854A, 0x5449, 0x4C08, 0x6D29, 0x5C89, 0x3BC8, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0x9C49, 0xA5AB, 0xBD4B, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0xAD8F, 0xA48C, 0x9B07, 0x92E7, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0xAD8F, 0xA48C, 0x9B07, 0x92E7, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x3C28, 0x5C6B, 0xAD8F, 0xAD8F, 0xAD0E, 0x83ED, 0x5B6D, 0x848F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x7B8C, 0x4A8A, 0x5B6D, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0x7C6C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0x7D09, 0x3B88, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xCE4C, 0xBD4B, 0xA3C8, 0xA3C8, 0xB4AA, 0xB5EB, 0x94A9, 0x9C49, 0xA5AB, 0xBD4B, 0x8C28, 0x6CE8, 0x7C68, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x94EF, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x94EF, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0xAD8F, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x956B, 0xAD8F, 0xAD8F, 0xAD0E, 0x7B8C, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 0xA46E, 0xA46E, 0xA4ED, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x640C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0xB4AA, 0xCE4C, 0xB5EB, 0x8509, 0x7C68, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x8C2E, 0x638D, 0x734A, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x8C2E, 0x638D, 0x734A, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0xAD8F, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7549, 0x856A, 0x7CCB, 0x6BEE, 0x7C0E, 0xA46E, 0x7B8C, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 0xA46E, 0xA4ED, 0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x530C, 0x5B6D, 0x640C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xB5EB, 0x94A9, 0xA3C8, 0x9C49, 0x8D4A, 0x8509, 0x8D6A, 0xB5EB, 0x8D4A, 0x94A9, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x8C2E, 0x6BEE, 0x5B4C, 0x4249, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0x9C6C, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x736C, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x8C2E, 0x6BEE, 0x5B4C, 0x4249, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0x9C6C, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x7B0A, 0x7C0E, 0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x736C, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x8C2E, 0x6BEE, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x856A, 0x6C29, 0x52CB, 0x6BEE, 0x5B4C, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x638D, 0x6C2B, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x5428, 0x6D29, 0x856A, 0xA5EA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0x9B88, 0x83A7, 0x6CE8, 0x8D6A, 0xB5EB, 0x8509, 0x7C28, 0x93E8, 0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8B2A, 0xA4CE, 0xAD8F, 0xAD8F, 0x94EF, 0x7B8C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B0A, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8B2A, 0xA4CE, 0xAD8F, 0xAD8F, 0x94EF, 0x7B8C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x7B09, 0x5B6D, 0x7B8C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B0A, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B07, 0x92E7, 0x8287, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5449, 0x856A, 0x956B, 0x8C8E, 0x6C2B, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x5C0C, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x4448, 0x4C49, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0x7D09, 0x3B88, 0x5428, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B88, 0x8509, 0x7408, 0x8287, 0x7B67, 0x6CE8, 0x7509, 0x8D4A, 0x8C29, 0x8287, 0x7B67, 0x7C28, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B2A, 0xA46E, 0x7B8C, 0x4A8A, 0x530C, 0x734A, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B2A, 0xA46E, 0x7B8C, 0x4A8A, 0x530C, 0x734A, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5C6B, 0xAD8F, 0xADAD, 0xA5EA, 0xA5EA, 0x7D4A, 0x3B89, 0x4249, 0x4A8A, 0x530C, 0x5B6D, 0x5C0C, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x4C49, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0x9B88, 0x92E7, 0x8287, 0x7B67, 0x7509, 0x8509, 0x7408, 0x8B07, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA4CE, 0xAD8F, 0xA48C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0xA3EA, 0xAD8F, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA4CE, 0xAD8F, 0xA48C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5C0B, 0x8C2E, 0x7CAD, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x4C49, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x6469, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x7B67, 0x6CE8, 0x7408, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x9BEB, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B8A, 0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x9BEB, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x3B8A, 0x4B8A, 0x4448, 0x5449, 0x4C49, 0x3C68, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x5428, 0x856A, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x7B8C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x8B6A, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x7B8C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x5449, 0x6D09, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x5428, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x93AA, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x33C9, 0x5C6B, 0x850C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x6469, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0xA48C, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x93AA, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, 0xAD0E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x6469, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0x9C6C, 0x8287, 0x8AC7, 0x9B07, 0xA3EA, 0xAD8F, 0xAD8F, 0xACEC, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x93AA, 0xAD8F, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x8D0B, 0xA46E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x6469, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD0E, 0x83ED, 0x62EA, 0x8287, 0x8B2A, 0xA4CE, 0xAD8F, 0xAD8F, 0xA48C, 0x92E7, 0x8B07, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8B2A, 0xA46E, 0x9BEB, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x93AB, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x856A, 0x7CCB, 0x5C0C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0x7D09, 0x3BC8, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x638D, 0x530C, 0x5B6D, 0x7C0E, 0xA46E, 0xA46E, 0x9BEB, 0x92E7, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x7B0A, 0x7B8C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x8B6A, 0x736C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x6D09, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0xAE79, 0x9E18, 0x8490, 0x9B47, 0xA3C8, 0xA4CE, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B0A, 0x638D, 0x4ACB, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0x9C6C, 0x8287, 0x8AC7, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0xAE79, 0x9E18, 0x8490, 0x9B47, 0xA3C8, 0xA4CE, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5449, 0x856A, 0x6D09, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x6469, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA44E, 0xAE79, 0x9E18, 0x7C50, 0x8287, 0x8287, 0x940E, 0xAE79, 0x9E18, 0x8490, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0xAD8F, 0x8C8E, 0x4ACB, 0x4A8A, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x9C6C, 0x8AC7, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA44E, 0xAE79, 0x9E18, 0x7C50, 0x8287, 0x8287, 0x940E, 0xAE79, 0x9E18, 0x8490, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, 0xAD8F, 0x8D0C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x5428, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA4CE, 0xAD8F, 0xAD8F, 0x94EF, 0x6BEE, 0x638D, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x62EA, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x3C28, 0x5C6B, 0xAD8F, 0xAD8F, 0xAD0E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3BC8, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x9E18, 0x8CD1, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 0x638D, 0x4ACB, 0x630B, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x94EF, 0x638D, 0x738D, 0xA4CE, 0x9511, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0xAD8F, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x9E18, 0x8CD1, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8287, 0x8287, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x956B, 0xAD8F, 0xAD8F, 0xAD0E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0x8DAA, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x9E18, 0x8490, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x4A8A, 0x530C, 0x738D, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x6BEE, 0x5B4C, 0x630B, 0x93AB, 0x8287, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0xAD8F, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x9E18, 0x8490, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x9B07, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7549, 0x856A, 0x7CCB, 0x6BEE, 0x7C0E, 0xA46E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x64E9, 0xA5EA, 0x7D4A, 0x53A8, 0x8BC8, 0xA5EA, 0x8DAA, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x7B88, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x9E18, 0x7C50, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x638D, 0x530C, 0x4ACB, 0x5A48, 0x6A68, 0x4A8A, 0x738D, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 0x5B4C, 0x630B, 0xA46E, 0x9BEB, 0x9B07, 0x92E7, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9E18, 0x7D76, 0x8CD1, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x7B0A, 0x7C0E, 0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x9E18, 0x7C50, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x736C, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x856A, 0x748A, 0x5B6D, 0x640C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8BC8, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8BC8, 0xA5EA, 0xA509, 0x9348, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8287, 0x72C9, 0x5B6D, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x52CB, 0x6BEE, 0x7B8C, 0xA44E, 0xAE79, 0xAE79, 0x9D12, 0x83AD, 0xA3C8, 0xA3C8, 0x6CB5, 0x7D76, 0x7D76, 0x7D76, 0x7C50, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x7B09, 0x5B6D, 0x7B8C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B0A, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5449, 0x856A, 0x956B, 0x850C, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x6469, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0xA509, 0x9348, 0x8BC8, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x7B0A, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x638D, 0x4ACB, 0x5A48, 0x7B0A, 0x638D, 0x63F0, 0x8DD7, 0xAE79, 0x9E18, 0x7C50, 0x8287, 0xA3C8, 0xA3C8, 0x6454, 0x6CB5, 0x7D76, 0x7C50, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5C6B, 0xAD8F, 0xAD0E, 0x7C6C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3BC8, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x7B0A, 0x638D, 0x530C, 0x4ACB, 0x4249, 0x6288, 0x9B07, 0x92E7, 0x8AC7, 0x8BED, 0x7D76, 0x74F5, 0x6BAF, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0xA3EA, 0xAD8F, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA4CE, 0xAD8F, 0xA48C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5C0B, 0xA46E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3BC8, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0x9348, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B8A, 0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x9BEB, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x3B8A, 0x5B6D, 0x640C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x5428, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x8B6A, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x7B8C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x33C9, 0x33C9, 0x3BE9, 0x4C48, 0x4467, 0x4467, 0x4467, 0x3C28, 0x33C9, 0x3BE9, 0x5449, 0x4C48, 0x4467, 0x4467, 0x4467, 0x3C28, 0x33C9, 0x3BE9, 0x5449, 0x5449, 0x5449, 0x4409, 0x3C08, 0x4467, 0x3C28, 0x4C49, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xACEC, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x54A8, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x4C49, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x33C9, 0x33C9, 0x33C9, 0x4C49, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x33C9, 0x3C08, 0x3C28, 0x33C9, 0x4C49, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x3C08, 0x4467, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0xA48C, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0xA3EA, 0xAD8F, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8287, 0x93AA, 0xAD8F, 0xAD8F, 0xAD8F, 0x9C6C, 0x8287, 0x8AC7, 0x9B07, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x7D49, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0xACEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0x9C6C, 0x8287, 0x8AC7, 0x9B07, 0xA3EA, 0xAD8F, 0xAD8F, 0xACEC, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0xA48C, 0x9B07, 0x92E7, 0x8287, 0x93AA, 0xAD8F, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xCEB2, 0xCEB2, 0xBD8E, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x7D49, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x946D, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD0E, 0x83ED, 0x62EA, 0x8287, 0x8B2A, 0xA4CE, 0xAD8F, 0xAD8F, 0xA48C, 0x92E7, 0x8B07, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B47, 0x9348, 0x8B07, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0xAD8F, 0xAD0E, 0x93AB, 0x8287, 0x72C9, 0x738D, 0xA4CE, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0x9C6C, 0x8B07, 0x9B88, 0x9B47, 0xA3C8, 0x9348, 0x8AC7, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xCEB2, 0xCEB2, 0xCEB2, 0xCEB2, 0xBD8E, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5449, 0x856A, 0x6D09, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0xA46E, 0x83ED, 0x738D, 0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x946D, 0x7D76, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x8CD1, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x638D, 0x530C, 0x5B6D, 0x7C0E, 0xA46E, 0xA46E, 0x9BEB, 0x92E7, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0x8AC7, 0x92E7, 0x8AC7, 0x92E7, 0x8287, 0x8AC7, 0x9B8A, 0xA46E, 0xA46E, 0x8C2E, 0x638D, 0x530C, 0x5B6D, 0x7C0E, 0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA449, 0xA54B, 0xA54B, 0xB5CE, 0xB5AE, 0xA4EC, 0xBE2F, 0x9C6A, 0x9B47, 0xB4EB, 0xCEB2, 0xCEB2, 0xBD8E, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xBEEA, 0xBEEA, 0xBEEA, 0x9E4A, 0x856A, 0xAE4A, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5449, 0x856A, 0x956B, 0x850C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x8C2E, 0x5B4C, 0x52CB, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x7D76, 0x74F5, 0x7C0F, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B0A, 0x638D, 0x4ACB, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0x9C6C, 0x8287, 0x8287, 0x8287, 0x93AA, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x4A8A, 0x5B6D, 0x736C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA449, 0xB5CE, 0xB5AE, 0x946A, 0x9C2A, 0x9389, 0x9CAA, 0x8BE9, 0xA4EC, 0xCEB2, 0xBD8E, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xB68A, 0x8DAA, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5C6B, 0xAD0E, 0x7C6C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x940E, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x74F5, 0x6454, 0x6BAF, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0xAD8F, 0x8C8E, 0x4ACB, 0x4A8A, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x9C6C, 0x8287, 0x93AA, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0x9C6C, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9BE9, 0xA54B, 0x9CAA, 0x946A, 0x9CAA, 0x946A, 0xB5CE, 0xCEB2, 0xCEB2, 0xBD8E, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x64E9, 0xAE4A, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x3C28, 0x43CB, 0x7C0E, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0xAD8F, 0xA48C, 0x9B07, 0x92E7, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x92E7, 0x83AD, 0x8DD7, 0x9E18, 0x74F5, 0x6454, 0x6BAF, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA4CE, 0xAD8F, 0xAD8F, 0x94EF, 0x6BEE, 0x638D, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x83ED, 0x5B6D, 0x6BEE, 0x848F, 0xAD8F, 0xAD8F, 0xAD0E, 0x9BEB, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0x9BEB, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8287, 0x9389, 0x9CAA, 0x8BE9, 0x946A, 0xA54B, 0x9C6A, 0x9B47, 0xA449, 0xA4AA, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x748A, 0x5B6D, 0x5C0C, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x94EF, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x92E7, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x9B47, 0xA4CE, 0xAE79, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 0x638D, 0x4ACB, 0x630B, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x94EF, 0x638D, 0x530C, 0x5B6D, 0x848F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x7B8C, 0x4A8A, 0x5B6D, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9BE9, 0xA54B, 0x9CAA, 0x8BE9, 0x946A, 0xA54B, 0x9C2A, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xAE4A, 0x8DEA, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7549, 0x856A, 0x856A, 0x7CCB, 0x638D, 0x5BEB, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x8C2E, 0x638D, 0x734A, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8AC7, 0x9B47, 0x9348, 0x8B07, 0xA3C8, 0x946D, 0x8DD7, 0xAE79, 0x9E18, 0x8490, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x4A8A, 0x530C, 0x738D, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x6BEE, 0x5B4C, 0x4249, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 0xA46E, 0xA46E, 0x83ED, 0x530C, 0x4ACB, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x7B09, 0x62EA, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xB5AE, 0x946A, 0xA54B, 0xA54B, 0xB5CE, 0xB5AE, 0xA4EC, 0xBD4E, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5449, 0x856A, 0x956B, 0xAD8F, 0x94EF, 0x6C6C, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x8C2E, 0x6BEE, 0x5B4C, 0x4249, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0x9C6C, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA44E, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0x9348, 0x83AD, 0x7D76, 0x74F5, 0x6BAF, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x638D, 0x530C, 0x4ACB, 0x5A48, 0x6A68, 0x4A8A, 0x738D, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 0x5B4C, 0x4249, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 0xA46E, 0x83ED, 0x4ACB, 0x5A48, 0x6A68, 0x4A8A, 0x530C, 0x5B6D, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x848F, 0xAD8F, 0xAD8F, 0xA48C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xB5AE, 0xA4EC, 0xCEB2, 0xB52E, 0x8287, 0x9C0B, 0xCEB2, 0xB5AE, 0xA4EC, 0xBD4E, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x5CE9, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5C6B, 0xAD8F, 0xAD8F, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8B2A, 0xA4CE, 0xAD8F, 0xAD8F, 0x94EF, 0x7B8C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x940E, 0xAE79, 0x9E18, 0x8CD1, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x9B07, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8287, 0x72C9, 0x5B6D, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x4249, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x638D, 0x62EA, 0x8287, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xCEB2, 0xCEB2, 0xBD4E, 0x92E7, 0x8AC7, 0x9B07, 0xAC6B, 0xCEB2, 0xCEB2, 0xBD8E, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x3C28, 0x43CB, 0x7C0E, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B2A, 0xA46E, 0x7B8C, 0x4A8A, 0x530C, 0x734A, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x8BED, 0x74F5, 0x73CF, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x7B0A, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x638D, 0x4ACB, 0x5A48, 0x8287, 0x6A68, 0x4A8A, 0x5B6D, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x736C, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x9BEB, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xBE2F, 0x9C6A, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA449, 0xB5CE, 0xCEB2, 0xBD8E, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x748A, 0x5B6D, 0x6BEE, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x7B0A, 0x638D, 0x530C, 0x4ACB, 0x4249, 0x6288, 0x9B07, 0x9B07, 0x9B07, 0x7AC8, 0x4249, 0x4A8A, 0x530C, 0x5B6D, 0x736C, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x6BEE, 0x736C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA449, 0xA4AA, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA449, 0xA4AA, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x856A, 0x748A, 0x5B6D, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x638D, 0x62EA, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x856A, 0x748A, 0x5BEB, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x72C9, 0x530C, 0x62EA, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x5449, 0x6D09, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x946D, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x33C9, 0x5C6B, 0x850C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x946D, 0x7D76, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x8CD1, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0x9C6C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x7D76, 0x74F5, 0x7C0F, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0xAE79, 0x9E18, 0x8490, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0x9C6C, 0x7B2C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x92E7, 0x8AC7, 0x9B47, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x754E, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x8D0B, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x940E, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x74F5, 0x6454, 0x6BAF, 0x8AC7, 0x9B07, 0x9B47, 0x9348, 0x8AC7, 0xA44E, 0xAE79, 0x9E18, 0x7C50, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x93AB, 0x8AC7, 0x8BED, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x93AA, 0xAD8F, 0xAD8F, 0xA48C, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x754E, 0x7D76, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x856A, 0x7CCB, 0x5C0C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x9E18, 0x8CD1, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x8BED, 0x8DD7, 0x9E18, 0x74F5, 0x6454, 0x6BAF, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x8B6A, 0x736C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B2A, 0xA46E, 0xA4CE, 0xAD8F, 0xAD8F, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x7D76, 0x74F5, 0x6490, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x6D09, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0x94A9, 0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0x8C48, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x53A8, 0x8287, 0x8B07, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x940E, 0xAE79, 0x8DB7, 0x73CF, 0x9B07, 0x9B47, 0xA4CE, 0xAE79, 0xAE79, 0x9D12, 0x8AC7, 0x9B07, 0x92E7, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x9B47, 0xA4CE, 0xAE79, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x940E, 0xAE79, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x7B09, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x6BEE, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x652F, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x74F5, 0x6454, 0x544F, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5449, 0x856A, 0x6D09, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x7B88, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x7428, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA4CE, 0xAE79, 0xAE79, 0x9E18, 0x8CD1, 0xA3C8, 0x9348, 0x8287, 0x8AC7, 0x9B47, 0x9348, 0x8B07, 0xA3C8, 0x946D, 0x8DD7, 0xAE79, 0x9E18, 0x8490, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8287, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x83AD, 0x8DD7, 0xAE79, 0x9E18, 0x8490, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x7B09, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x5B6D, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x54CD, 0x8DD7, 0x9E18, 0x74F5, 0x6454, 0x544F, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, 0xAD8F, 0x956D, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x8BED, 0x8DD7, 0x8DB7, 0x6BAF, 0x8AC7, 0x9B07, 0x9B07, 0xA44E, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0x9348, 0x83AD, 0x7D76, 0x74F5, 0x6BAF, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0x9C6C, 0x8287, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B07, 0x8BED, 0x7D76, 0x74F5, 0x6BAF, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0x9C6C, 0x72C9, 0x530C, 0x530C, 0x530C, 0x530C, 0x5B6D, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x3C28, 0x5C6B, 0xAD8F, 0xAD8F, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x940E, 0xAE79, 0x9E18, 0x8CD1, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x9B07, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0xAD0E, 0x83ED, 0x530C, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x54CD, 0x8DD7, 0xAE79, 0x9E18, 0x6511, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x956B, 0xAD8F, 0xAD8F, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x4CA8, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x8BED, 0x74F5, 0x73CF, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x9E18, 0x8CD1, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xA48C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0xAD0E, 0x83ED, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0x85B3, 0x4CA8, 0x5CE9, 0x3C68, 0x54CD, 0x7D76, 0x74F5, 0x544F, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7549, 0x856A, 0x7CCB, 0x6BEE, 0x7C0E, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x9E18, 0x8CD1, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x940E, 0xAE79, 0x8DB7, 0x73CF, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x736C, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA46E, 0x7B8C, 0x52CB, 0x7C0E, 0xA46E, 0xA46E, 0x8C2E, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x652F, 0xAE79, 0x9E18, 0x7551, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x856A, 0x748A, 0x5B6D, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x8DB7, 0x73CF, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B0A, 0x638D, 0x6B0A, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B0A, 0x6BEE, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x638D, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x54CD, 0x74F5, 0x544F, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5449, 0x856A, 0x956B, 0x850C, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0x8C8E, 0x5B6D, 0x736C, 0x72C9, 0x5B6D, 0x6BEE, 0x638D, 0x530C, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5C6B, 0xAD8F, 0xAD0E, 0x7C6C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x856A, 0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0xA4CE, 0xAD8F, 0xA48C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0xA3EA, 0xAD0E, 0x83ED, 0x6B0A, 0x92E7, 0x72C9, 0x530C, 0x530C, 0x62EA, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5C0B, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA46E, 0x9BEB, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B2A, 0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x3B8A, 0x5B6D, 0x6C6C, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xB68A, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8BCA, 0x7B8C, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x7B09, 0x5B6D, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x4467, 0x4467, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x6D29, 0x6D29, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x7549, 0x6D09, 0x4467, 0x4467, 0x4467, 0x5CC8, 0x856A, 0x6D09, 0x4467, 0x3C28, 0x3C08, 0x6CCA, 0xAD8F, 0x850C, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x6D29, 0x6D29, 0x6D29, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0xA48C, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0xA3EA, 0xAD8F, 0xA48C, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x3C08, 0x5CC8, 0x856A, 0x64C9, 0x33C9, 0x5449, 0x856A, 0x856A, 0x856A, 0x64C9, 0x33C9, 0x3B8A, 0x73ED, 0xAD8F, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xCEB2, 0xCEB2, 0xBD8E, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0x9C6C, 0x8287, 0x8AC7, 0x9B07, 0xA3EA, 0xAD8F, 0xAD8F, 0xACEC, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8AC7, 0x9B07, 0x92E7, 0x8AC7, 0x9B47, 0xA3C8, 0x9348, 0x8B07, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B07, 0x92E7, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0xA48C, 0x9B07, 0x92E7, 0x8287, 0x93AA, 0xAD8F, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x6D09, 0x4467, 0x4467, 0x3C28, 0x5449, 0x856A, 0x856A, 0x64C9, 0x3329, 0x3AC9, 0x5449, 0x856A, 0x856A, 0x6C29, 0x4249, 0x4A8A, 0x738D, 0xA4CE, 0xAD0E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xCEB2, 0xCEB2, 0xCEB2, 0xCEB2, 0xBD8E, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0xAD8F, 0xACEC, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD0E, 0x83ED, 0x62EA, 0x8287, 0x8B2A, 0xA4CE, 0xAD8F, 0xAD8F, 0xA48C, 0x92E7, 0x8B07, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8287, 0x93AA, 0xAD8F, 0xAD8F, 0xA48C, 0x9B07, 0x92E7, 0x8287, 0x8AC7, 0xA3EA, 0xAD8F, 0xAD8F, 0x94EF, 0x638D, 0x62EA, 0x8AC7, 0x9B47, 0x9348, 0x8B07, 0xA3C8, 0x9B88, 0xA3EA, 0xAD8F, 0xAD8F, 0xAD0E, 0x93AB, 0x8287, 0x72C9, 0x738D, 0xA4CE, 0xAD0E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x856A, 0x6D09, 0x4467, 0x43A8, 0x5B69, 0x856A, 0x64C9, 0x3329, 0x4249, 0x4249, 0x4249, 0x5B69, 0x856A, 0x6C29, 0x52CB, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0x8CAC, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0xAE79, 0xC6B9, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0x5369, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA449, 0xA54B, 0xA54B, 0xB5CE, 0xB5AE, 0xA4EC, 0xBE2F, 0x9C6A, 0x9B47, 0xB4EB, 0xCEB2, 0xCEB2, 0xBD8E, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0x94EF, 0x7BEC, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x638D, 0x530C, 0x5B6D, 0x7C0E, 0xA46E, 0xA46E, 0x9BEB, 0x92E7, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0x8B2A, 0xA46E, 0xA4CE, 0xAD8F, 0xAD8F, 0x8C8E, 0x62EA, 0x8287, 0x8B2A, 0xA4CE, 0xAD8F, 0xAD0E, 0x83ED, 0x530C, 0x4ACB, 0x5A48, 0x8AC7, 0x92E7, 0x8AC7, 0x92E7, 0x8287, 0x8AC7, 0x9B8A, 0xA46E, 0xA46E, 0x8C2E, 0x638D, 0x530C, 0x5B6D, 0x7C0E, 0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x64C9, 0x33C9, 0x3329, 0x4249, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x4A8A, 0x5B6D, 0x6BEE, 0x5B4C, 0x4A8A, 0x5B6D, 0x5C0C, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0xBE4F, 0xE6F8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x84A9, 0x84A9, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0x94A9, 0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x5369, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0x94A9, 0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0x94A9, 0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0x8C48, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x53A8, 0x8287, 0x8B07, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA449, 0xB5CE, 0xB5AE, 0x946A, 0x9C2A, 0x9389, 0x9CAA, 0x8BE9, 0xA4EC, 0xCEB2, 0xBD8E, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0x94EF, 0x6BEE, 0x7BEC, 0xA3C8, 0x9348, 0x7B0A, 0x638D, 0x4ACB, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0x9C6C, 0x8287, 0x72C9, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x638D, 0x62EA, 0x8B2A, 0xA46E, 0x8C2E, 0x6BEE, 0x638D, 0x4ACB, 0x4A8A, 0x62EA, 0x8287, 0x93AA, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x4A8A, 0x5B6D, 0x736C, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5449, 0x856A, 0x64C9, 0x3329, 0x4249, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0x850C, 0x3C68, 0x4CA8, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0xA5EA, 0xBE4F, 0xE6F8, 0xE6F8, 0xCE93, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x94A9, 0x8287, 0x8BC8, 0xA5EA, 0x8DAA, 0x7428, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x6D29, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x7B88, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x7428, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9BE9, 0xA54B, 0x9CAA, 0x946A, 0x9CAA, 0x946A, 0xB5CE, 0xCEB2, 0xCEB2, 0xBD8E, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8B2A, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 0x6BEE, 0x7BEC, 0xA3C8, 0x9B88, 0x92E7, 0x93AA, 0xAD8F, 0xAD8F, 0x8C8E, 0x4ACB, 0x4A8A, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x9C6C, 0x72C9, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x6BEE, 0x5B4C, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0x844D, 0x4A8A, 0x62EA, 0x93AA, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0x9C6C, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, 0xAD8F, 0x844D, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x83ED, 0x5B6D, 0x6BEE, 0x848F, 0xAD8F, 0xAD8F, 0xAD0E, 0x7C6C, 0x4CA8, 0x6D29, 0x856A, 0x7D4A, 0x3C68, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0xCE93, 0xA4CB, 0xBC71, 0xE6F8, 0xE615, 0xC42F, 0xA40B, 0x6D29, 0x3C68, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0x7D4A, 0x4CA8, 0x4CA8, 0x7428, 0x8BC8, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8287, 0x9389, 0x9CAA, 0x8BE9, 0x946A, 0xA54B, 0x9C6A, 0x9B47, 0xA449, 0xA4AA, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x530C, 0x4ACB, 0x4A8A, 0x530C, 0x734A, 0xA3C8, 0x9B88, 0x9B8A, 0xA4CE, 0xAD8F, 0xAD8F, 0x94EF, 0x6BEE, 0x638D, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x530C, 0x530C, 0x530C, 0x530C, 0x5B6D, 0x6BEE, 0x638D, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x83ED, 0x5B6D, 0x6BEE, 0x848F, 0xAD8F, 0xAD8F, 0xAD0E, 0x9BEB, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x3C28, 0x5C6B, 0xAD8F, 0xAD8F, 0xAD0E, 0x83ED, 0x5B6D, 0x848F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x7B8C, 0x4A8A, 0x5B6D, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0x7C6C, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0xE6F8, 0xE615, 0x9CAD, 0x748B, 0xDCD0, 0xC42F, 0xBC71, 0xE6F8, 0xA5F2, 0x3C68, 0x3C68, 0x6D29, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x6B28, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9BE9, 0xA54B, 0x9CAA, 0x8BE9, 0x946A, 0xA54B, 0x9C2A, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD0E, 0x8C2E, 0x638D, 0x4ACB, 0x4249, 0x4249, 0x6288, 0x9B07, 0x9B47, 0xA3C8, 0xA40A, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 0x638D, 0x4ACB, 0x630B, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x94EF, 0x638D, 0x530C, 0x530C, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x844D, 0x4A8A, 0x5B6D, 0x848F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x7B8C, 0x4A8A, 0x5B6D, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0xA42C, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x956B, 0xAD8F, 0xAD8F, 0xAD0E, 0x7B8C, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 0xA46E, 0xA46E, 0xA4ED, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x6C6C, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D09, 0x3BC8, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x748B, 0xC42F, 0x7B8B, 0x3C68, 0x3C68, 0x748B, 0xDD93, 0xE6F8, 0xA5F2, 0x3C68, 0x3C68, 0x3C68, 0x64E9, 0x7D4A, 0x64E9, 0x8DAA, 0x6D29, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x6B28, 0x4CA8, 0x6D29, 0x856A, 0x856A, 0xA5EA, 0x7D4A, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x4CA8, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xB5AE, 0x946A, 0xA54B, 0xA54B, 0xB5CE, 0xB5AE, 0xA4EC, 0xBD4E, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0x8C2E, 0x6BEE, 0x6BEE, 0x638D, 0x62EA, 0x8287, 0x93AA, 0xAD8F, 0x9C6C, 0x8287, 0x8AC7, 0x9B47, 0x8BCA, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x4A8A, 0x530C, 0x738D, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x6BEE, 0x5B4C, 0x4A8A, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x738D, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x94EF, 0x638D, 0x4ACB, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 0xA46E, 0xA46E, 0x83ED, 0x530C, 0x4ACB, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7549, 0x856A, 0x7CCB, 0x6BEE, 0x7C0E, 0xA46E, 0x7B8C, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 0xA46E, 0xA4ED, 0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x530C, 0x5B6D, 0x5BCC, 0x3B88, 0x6469, 0xA5EA, 0x7D09, 0x3B88, 0x3B88, 0x6469, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x5CE9, 0x63CA, 0xBBAE, 0x9CAD, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xB5AE, 0xA4EC, 0xCEB2, 0xB52E, 0x8287, 0x9C0B, 0xCEB2, 0xB5AE, 0xA4EC, 0xBD4E, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8AC7, 0x9B07, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8B2A, 0xA4CE, 0xAD8F, 0x94EF, 0x7BEC, 0xA3C8, 0xA3C8, 0x8BCA, 0x638D, 0x530C, 0x4ACB, 0x5A48, 0x6A68, 0x4A8A, 0x738D, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 0x5B4C, 0x4249, 0x52CB, 0x7C0E, 0xA46E, 0xA46E, 0x8C2E, 0x5B4C, 0x4A8A, 0x738D, 0xA46E, 0xA46E, 0xA46E, 0x8C2E, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 0xA46E, 0x83ED, 0x4ACB, 0x5A48, 0x6A68, 0x4A8A, 0x530C, 0x5B6D, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x856A, 0x6C29, 0x52CB, 0x6BEE, 0x5B4C, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x638D, 0x6C2B, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x5428, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xCEB2, 0xCEB2, 0xBD4E, 0x92E7, 0x8AC7, 0x9B07, 0xAC6B, 0xCEB2, 0xCEB2, 0xBD8E, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B2A, 0x8C2E, 0x6BEE, 0x638D, 0x734A, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x8287, 0x72C9, 0x5B6D, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x4A8A, 0x5B6D, 0x7C0E, 0xA46E, 0x8C2E, 0x638D, 0x4ACB, 0x4A8A, 0x738D, 0xA46E, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 0x6BEE, 0x638D, 0x4ACB, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x638D, 0x62EA, 0x8287, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5449, 0x856A, 0x956B, 0x8C8E, 0x6C2B, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x5C0C, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x3C08, 0x3BC8, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0xA509, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x64E9, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4EB, 0xBE2F, 0x9C6A, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA449, 0xB5CE, 0xCEB2, 0xBD8E, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x7B0A, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x638D, 0x4ACB, 0x5A48, 0x8287, 0x72C9, 0x5B6D, 0x6BEE, 0x638D, 0x530C, 0x62EA, 0x72C9, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x530C, 0x4ACB, 0x5A48, 0x8287, 0x6A68, 0x4A8A, 0x5B6D, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x736C, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x5C6B, 0xAD8F, 0xADAD, 0xA5EA, 0xA5EA, 0x7D4A, 0x3B89, 0x4249, 0x4A8A, 0x530C, 0x5B6D, 0x5C0C, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x4C49, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x856A, 0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA449, 0xA4AA, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA449, 0xA4AA, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x92E7, 0x7B0A, 0x638D, 0x530C, 0x4ACB, 0x4249, 0x6288, 0x9B07, 0x9B07, 0x92E7, 0x72C9, 0x530C, 0x530C, 0x62EA, 0x8287, 0x72C9, 0x5B6D, 0x6BEE, 0x6BEE, 0x6BEE, 0x638D, 0x4ACB, 0x5A48, 0x8AC7, 0x9B07, 0x9B07, 0x7AC8, 0x4249, 0x4A8A, 0x530C, 0x5B6D, 0x736C, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x5C0B, 0x8C2E, 0x7CAD, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x4C49, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x6469, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x3C68, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x92E7, 0x7B0A, 0x6BEE, 0x638D, 0x530C, 0x4ACB, 0x5A48, 0x8AC7, 0x9B47, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x3C28, 0x3B8A, 0x4B8A, 0x4448, 0x5449, 0x4C49, 0x3C68, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x6469, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x4467, 0x4467, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x5428, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x3C08, 0x54A8, 0x7549, 0x6D09, 0x4467, 0x4467, 0x4467, 0x5CC8, 0x856A, 0x6D09, 0x4467, 0x3C28, 0x3C08, 0x6CCA, 0xAD8F, 0x850C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x6469, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x3C08, 0x3C28, 0x3C08, 0x5CC8, 0x856A, 0x64C9, 0x33C9, 0x5449, 0x856A, 0x856A, 0x856A, 0x64C9, 0x33C9, 0x3B8A, 0x73ED, 0xAD8F, 0xAD0E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x6469, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x5CC8, 0x856A, 0x6C29, 0x3AC9, 0x5449, 0x856A, 0x856A, 0x64C9, 0x3329, 0x3AC9, 0x5449, 0x856A, 0x856A, 0x6C29, 0x4249, 0x4A8A, 0x738D, 0xA4CE, 0xAD0E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x6469, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xBEEA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0xAD8F, 0xACEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7549, 0x856A, 0x856A, 0x856A, 0x6C29, 0x5B69, 0x856A, 0x64C9, 0x3329, 0x4249, 0x4249, 0x4249, 0x5B69, 0x856A, 0x6C29, 0x52CB, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0x844C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0x7D09, 0x3BC8, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0x94A9, 0x6B28, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xBEEA, 0xBEEA, 0xB68A, 0xA5EA, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0xAD8F, 0x94EF, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x4467, 0x3C28, 0x5449, 0x856A, 0x6C29, 0x4249, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x4A8A, 0x5B6D, 0x6BEE, 0x5B4C, 0x4A8A, 0x5B6D, 0x5C0C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0xAE79, 0x9E18, 0x8490, 0x9B47, 0xA3C8, 0xA4CE, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xAE4A, 0xBEEA, 0xB68A, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA40A, 0xA4CE, 0xAD8F, 0xAD8F, 0x94EF, 0x6BEE, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x3329, 0x4A8A, 0x530C, 0x4ACB, 0x6B6B, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x4ACB, 0x4A8A, 0x73ED, 0xAD8F, 0xAD8F, 0x850C, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x6469, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0xA44E, 0xAE79, 0x9E18, 0x7C50, 0x8287, 0x8287, 0x940E, 0xAE79, 0x9E18, 0x8490, 0x9B47, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8B2A, 0xA46E, 0x8C2E, 0x638D, 0x5B6D, 0x6BEE, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, 0xAD8F, 0x8C8E, 0x530C, 0x73ED, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x83ED, 0x5B6D, 0x6BEE, 0x848F, 0xAD8F, 0xAD8F, 0xAD0E, 0x7C6C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x5428, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x7B88, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA46A, 0xAD8F, 0xAD8F, 0x8C8E, 0x530C, 0x530C, 0x4ACB, 0x4A8A, 0x530C, 0x734A, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x6CCA, 0xAD8F, 0xAD8F, 0x8C8E, 0x5B6D, 0x848F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD8F, 0xAD0E, 0x7B8C, 0x4A8A, 0x5B6D, 0x638D, 0x5B6D, 0x7C0E, 0xA46E, 0x7C6C, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3BC8, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x9E18, 0x8CD1, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x6B28, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA40A, 0xA4CE, 0xAD8F, 0xAD0E, 0x8C2E, 0x638D, 0x4ACB, 0x4249, 0x4249, 0x6288, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7549, 0x856A, 0x956B, 0xAD8F, 0x844D, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 0xA46E, 0xA46E, 0xA4ED, 0xA5EA, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x640C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x9E18, 0x8490, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B8A, 0x8C2E, 0x6BEE, 0x6BEE, 0x638D, 0x62EA, 0x8287, 0x93AA, 0xAD8F, 0x9C6C, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x4467, 0x5CC8, 0x856A, 0x856A, 0x856A, 0x8D0B, 0x7B8C, 0x52CB, 0x6BEE, 0x6BEE, 0x6BEE, 0x6BEE, 0x7C0E, 0xA46E, 0xA4ED, 0xA5EA, 0xA5EA, 0x7C8A, 0x4A8A, 0x530C, 0x5B6D, 0x640C, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA4CE, 0xAE79, 0x9E18, 0x7C50, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xB68A, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8AC7, 0x9B07, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8B2A, 0xA4CE, 0xAD8F, 0x94EF, 0x7BEC, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x3C28, 0x33C9, 0x5449, 0x856A, 0x8D0B, 0x7B8C, 0x4A8A, 0x5B6D, 0x6BEE, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x638D, 0x6C2B, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0xB68A, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0xAE4A, 0xBEEA, 0x8DEA, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B2A, 0x8C2E, 0x6BEE, 0x638D, 0x734A, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A9, 0x33C9, 0x5C6B, 0xAD8F, 0x94EF, 0x7CAD, 0x7C8A, 0x4A8A, 0x5B6D, 0x6BEE, 0x638D, 0x5B6D, 0x6BEE, 0x5C0C, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x4448, 0x4C49, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x6469, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x6D49, 0xBEEA, 0xB68A, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0xA509, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64CB, 0xAD8F, 0xAD0E, 0xA4ED, 0x7D4A, 0x3B89, 0x4249, 0x4A8A, 0x530C, 0x5B6D, 0x5C0C, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x4C49, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3BC8, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x646A, 0x7C6C, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x4C49, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3BC8, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x6B28, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4448, 0x4C49, 0x3C68, 0x3C68, 0x3C68, 0x4448, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x5428, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x7B88, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5C89, 0x3B88, 0x43C8, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5CA9, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D09, 0x43C8, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x854A, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0x854A, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0x854A, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x6469, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x854A, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x6469, 0xA5EA, 0xA5EA, 0x854A, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x6469, 0xA5EA, 0xA5EA, 0x854A, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x6469, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C08, 0x3B88, 0x43C8, 0x5449, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0x7D09, 0x3B88, 0x3BC8, 0x64E9, 0xA5EA, 0xA5EA, 0x7D09, 0x43C8, 0x5449, 0x6CE9, 0xA5EA, 0x854A, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0x7D09, 0x3B88, 0x3BC8, 0x64E9, 0xA5EA, 0xA5EA, 0x7D09, 0x43C8, 0x5449, 0x6CE9, 0xA5EA, 0x854A, 0x5449, 0x5449, 0x5449, 0x4C08, 0x3B88, 0x3BC8, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x5C89, 0x3B88, 0x43C8, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0x7D09, 0x3B88, 0x43C8, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0x854A, 0x6CE9, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0x7D09, 0x3B88, 0x43C8, 0x5449, 0x6CE9, 0xA5EA, 0xA5EA, 0x854A, 0x5449, 0x5449, 0x6CE9, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x84A9, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0x9E18, 0x6511, 0x4CA8, 0x6D29, 0x85AF, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5C89, 0x6469, 0xA5EA, 0x854A, 0x4C08, 0x6469, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5C89, 0x3B88, 0x3BC8, 0x3C68, 0x64E9, 0xA5EA, 0x7D09, 0x3B88, 0x6469, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5C89, 0x3B88, 0x3BC8, 0x3C68, 0x64E9, 0xA5EA, 0x7D09, 0x3B88, 0x6469, 0xA5EA, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8BC8, 0xA5EA, 0x8DAA, 0x7428, 0x8287, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x3C68, 0x3C68, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x7D09, 0x3B88, 0x3BC8, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5C89, 0x3BC8, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0x7D4A, 0x4CA8, 0x7428, 0x8BC8, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x6B28, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x85AF, 0xAE79, 0x9E18, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x6B28, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA5EA, 0x8DAA, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x8287, 0x7B88, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8BC8, 0xA5EA, 0xA509, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0xA509, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA489, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0x8C48, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xB5EB, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xBE52, 0x6D29, 0x9DCF, 0xE6F8, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0xA5AB, 0xBD4B, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0x946D, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xE6F8, 0xE615, 0xDD93, 0xE6F8, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xB5EB, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x7D76, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x8CD1, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0x94A9, 0x6B28, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x748B, 0xDD93, 0xE6F8, 0xE615, 0xDCD0, 0xDD93, 0xE615, 0x9CAD, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xB5EB, 0x94A9, 0xA3C8, 0xA3C8, 0xB4AA, 0xCE4C, 0xBD4B, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xAE79, 0xAE79, 0x9E18, 0x7D76, 0x74F5, 0x7C0F, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xA5F2, 0x3C68, 0x3C68, 0x63CA, 0xBBAE, 0xC42F, 0xAB0C, 0xAB0C, 0x7B8B, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xCE4C, 0xBD4B, 0xA3C8, 0xA3C8, 0xB4AA, 0xCE4C, 0xBD4B, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xAE79, 0x9E18, 0x74F5, 0x6454, 0x6BAF, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xE6F8, 0xA5F2, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x7D4E, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0xB4AA, 0xCE4C, 0xBD4B, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0x5369, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x74F5, 0x6454, 0x6BAF, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x7B88, 0x6D29, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x7B88, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xE6F8, 0xE615, 0xB4ED, 0x6D29, 0x5CE9, 0x4CA8, 0x5CE9, 0x3C68, 0x748B, 0xDD93, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0x9C49, 0xA5AB, 0xBD4B, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0x7D4A, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x5369, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0x94A9, 0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0x94A9, 0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0x8C48, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x53A8, 0x8287, 0x8B07, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x9B47, 0xA4CE, 0xAE79, 0xAE79, 0xAD73, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x6B28, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xE615, 0xDCD0, 0x9CAD, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x63CA, 0xBBAE, 0x9CAD, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xCE4C, 0xBD4B, 0xA3C8, 0xA3C8, 0xB4AA, 0xB5EB, 0x94A9, 0x9C49, 0xA5AB, 0xBD4B, 0x8C28, 0x6CE8, 0x7C68, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x6B28, 0x3C68, 0x4CA8, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x6D29, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x7B88, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x7428, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0x9348, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x9B47, 0x9348, 0x8B07, 0xA3C8, 0x946D, 0x8DD7, 0xAE79, 0x9E18, 0x8490, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x748B, 0xC42F, 0xAB0C, 0x7B8B, 0x7D4E, 0xE6F8, 0xBE52, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0xB4AA, 0xCE4C, 0xB5EB, 0x8509, 0x7C68, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x6B28, 0x4CA8, 0x6D29, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xAD73, 0xA3C8, 0xA3C8, 0x9348, 0x83AD, 0x7D76, 0x74F5, 0x6BAF, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x7D4A, 0x53A8, 0x8BC8, 0xA5EA, 0x8DAA, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x53A8, 0x8BC8, 0xA5EA, 0x8DAA, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x53A8, 0x8BC8, 0xA5EA, 0x8DAA, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x7B88, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x7D4E, 0xE6F8, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xB5EB, 0x94A9, 0xA3C8, 0x9C49, 0x8D4A, 0x8509, 0x8D6A, 0xB5EB, 0x8D4A, 0x94A9, 0xA3C8, 0x9C49, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x6D29, 0x6D29, 0x856A, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x8CD1, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x9B07, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x8BC8, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8BC8, 0xA5EA, 0xA509, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8BC8, 0xA5EA, 0xA509, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8BC8, 0xA5EA, 0xA509, 0x9348, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x748B, 0xDD93, 0xE6F8, 0xA5F2, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, 0x9B88, 0x83A7, 0x6CE8, 0x8D6A, 0xB5EB, 0x8509, 0x7C28, 0x93E8, 0x8D4A, 0x94A9, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x4CA8, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8287, 0x8B07, 0x9348, 0x8BC8, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x63CA, 0xAB0C, 0xBBAE, 0x9CAD, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B88, 0x8509, 0x7408, 0x8287, 0x7B67, 0x6CE8, 0x7509, 0x8D4A, 0x8C29, 0x8287, 0x7B67, 0x7C28, 0x9B47, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0x9B88, 0x92E7, 0x8287, 0x7B67, 0x7509, 0x8509, 0x7408, 0x8B07, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x6B28, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x7B67, 0x6CE8, 0x7408, 0x8AC7, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x7B88, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x856A, 0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x856A, 0x7D4A, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x84A9, 0x9348, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0x94A9, 0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x7D4A, 0x64E9, 0x7D4A, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0x94A9, 0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0x94A9, 0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x856A, 0xA5EA, 0x7D4A, 0x53A8, 0x8287, 0x8B07, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8BC8, 0xA5EA, 0x8DAA, 0x7428, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x7D4A, 0x4CA8, 0x6D29, 0x5CE9, 0x4CA8, 0x7428, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x7428, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0xB4AA, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0x7D4A, 0x4CA8, 0x7428, 0x8BC8, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x7428, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E9, 0xA5EA, 0x8DAA, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, 0x9C49, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8AC7, 0x9B47, 0xA3C8, 0x9348, 0x8AC7, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x6B28, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xCE4C, 0xBD4B, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x8AC7, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x6B28, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x64E9, 0x7D4A, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xBD4B, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8AC7, 0x9B07, 0x9B07, 0x9B07, 0x92E7, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xB4AA, 0xB5EB, 0x94A9, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x4CA8, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9C49, 0x8D4A, 0x94A9, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B07, 0x9B47, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x3C68, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B88, 0x8509, 0x7408, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x92E7, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xBEEA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x856A, 0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9B88, 0x9B47, 0x9B88, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x6B28, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xBEEA, 0xBEEA, 0xB68A, 0xA5EA, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x7B88, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xAE4A, 0xBEEA, 0xB68A, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x9348, 0x8287, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0x8C48, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x6B28, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0x9348, 0x8BC8, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xB68A, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x5CE9, 0x64E9, 0x94A9, 0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0x94A9, 0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0x94A9, 0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0x94A9, 0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0xA489, 0xA5EA, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0x94A9, 0x8287, 0x8287, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0xA509, 0x9348, 0x8287, 0x6B28, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0xB68A, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x64E9, 0xA5EA, 0xAE4A, 0xBEEA, 0x8DEA, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8287, 0x8BC8, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0xA5EA, 0x94A9, 0x8287, 0x6B28, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x6D49, 0xBEEA, 0xB68A, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x6B28, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0x9E18, 0x6511, 0x4CA8, 0x6D29, 0x85AF, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xBEEA, 0xBEEA, 0xBEEA, 0x9E4A, 0x856A, 0xAE4A, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x3C68, 0x3C68, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xB68A, 0x8DAA, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x64E9, 0xAE4A, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x85AF, 0xAE79, 0x9E18, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xAE4A, 0x8DEA, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x5CE9, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x95F0, 0xD73C, 0xC6FB, 0x8DB7, 0x6490, 0x6D29, 0x85AF, 0xBEBA, 0xD73C, 0xD73C, 0xD73C, 0xC6FB, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x856A, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA489, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x95F0, 0xD73C, 0xD73C, 0xC6FB, 0x9E18, 0x74F5, 0x6CB5, 0x9E18, 0xD73C, 0xD73C, 0xD73C, 0xD73C, 0xC6FB, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x95F0, 0xD73C, 0xC6FB, 0x9E18, 0x74F5, 0x6454, 0x7D16, 0xBEBA, 0xD73C, 0xD73C, 0xC6FB, 0xAE79, 0xAE79, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x8287, 0x7B88, 0x856A, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0x9E18, 0x74F5, 0x6454, 0x6CB5, 0x8DD7, 0xBEBA, 0xD73C, 0xC6FB, 0x9E18, 0x7D76, 0x7D76, 0x8DD7, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x7D4A, 0x64E9, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x53A8, 0x8287, 0x8B07, 0xA489, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x754E, 0x7D76, 0x7D76, 0x74F5, 0x6454, 0x6CB5, 0x8DD7, 0xAE79, 0xAE79, 0x9E18, 0x74F5, 0x6454, 0x6454, 0x6CB5, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x7D4A, 0x4CA8, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x7428, 0x8BC8, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A8, 0x6D29, 0x8DCA, 0xBEEA, 0xB68A, 0xA5EA, 0x7D4A, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x754E, 0x7D76, 0x74F5, 0x8550, 0xBEEA, 0xB6D0, 0xAE79, 0x9E18, 0x74F5, 0x6454, 0x7D16, 0xAE79, 0x8DB7, 0x6490, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6CCD, 0x6CB5, 0x9612, 0xBEEA, 0xBEEA, 0xB6D0, 0xAE79, 0x9E18, 0x74F5, 0x8D57, 0xD73C, 0xC6FB, 0x9E18, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0x8DAA, 0x6D29, 0x7428, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x7D4A, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A8, 0x5CE9, 0x3C68, 0x4C4D, 0x7CD0, 0xAE4A, 0xB68A, 0x95AF, 0x7D76, 0x74F5, 0x6CB5, 0x9E18, 0xD73C, 0xC6FB, 0x9E18, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xBE52, 0x6D29, 0x9DCF, 0xE6F8, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0x8DEA, 0x3C68, 0x64E9, 0xA5EA, 0x8D4E, 0x6CB5, 0x7D76, 0x74F5, 0x6CB5, 0x8DD7, 0xAE79, 0x9E18, 0x7D76, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xAE4A, 0xBEEA, 0xBEEA, 0x8DEA, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xE6F8, 0xE615, 0xDD93, 0xE6F8, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xB68A, 0xA630, 0xAE79, 0xAE79, 0x85B3, 0x6D49, 0xBEEA, 0x9DEE, 0x6CB5, 0x7D76, 0x7D76, 0x7D76, 0x6511, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x6D49, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x748B, 0xDD93, 0xE6F8, 0xE615, 0xDCD0, 0xDD93, 0xE615, 0x9CAD, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x95AF, 0x8DD7, 0xAE79, 0x9E18, 0x8DB2, 0xAE4A, 0xBEEA, 0x9DEE, 0x6454, 0x6CB5, 0x7D76, 0x6511, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xA5F2, 0x3C68, 0x3C68, 0x63CA, 0xBBAE, 0xC42F, 0xAB0C, 0xAB0C, 0x7B8B, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x54CD, 0x7D76, 0x74F5, 0x544F, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x856A, 0x7D4A, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xE6F8, 0xA5F2, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x7D4E, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x64E8, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xE6F8, 0xE615, 0xB4ED, 0x6D29, 0x5CE9, 0x4CA8, 0x5CE9, 0x3C68, 0x748B, 0xDD93, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x9DCF, 0xE6F8, 0xE615, 0xDCD0, 0x9CAD, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x63CA, 0xBBAE, 0x9CAD, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x748B, 0xC42F, 0xAB0C, 0x7B8B, 0x7D4E, 0xE6F8, 0xBE52, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x7D4A, 0x3C68, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xBEEA, 0xBEEA, 0xBEEA, 0x9E4A, 0x856A, 0xAE4A, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x7D4E, 0xE6F8, 0xE6F8, 0xBE52, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x856A, 0xA5EA, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xB68A, 0x8DAA, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x748B, 0xDD93, 0xE6F8, 0xA5F2, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x8DAA, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x754E, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x64E9, 0xAE4A, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x63CA, 0xAB0C, 0xBBAE, 0x9CAD, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x8DCA, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0x7D4A, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x754E, 0x7D76, 0x8DD7, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xBEEA, 0xBEEA, 0xBEEA, 0x9E4A, 0x856A, 0xAE4A, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x7D76, 0x74F5, 0x6490, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xAE4A, 0x8DEA, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0x9E18, 0x6511, 0x4CA8, 0x6D29, 0x85AF, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xAE4A, 0xB68A, 0x8DAA, 0x856A, 0xA5EA, 0x8DAA, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x652F, 0xAE79, 0xAE79, 0xAE79, 0x9E18, 0x74F5, 0x6454, 0x544F, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x3C68, 0x3C68, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x7D4A, 0x64E9, 0xAE4A, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x54CD, 0x8DD7, 0x9E18, 0x74F5, 0x6454, 0x544F, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x5CE9, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xAE4A, 0xBEEA, 0xBEEA, 0x9E4A, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0x8DAA, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x85AF, 0xAE79, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x85AF, 0xAE79, 0x9E18, 0x7551, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x54A8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0xAE4A, 0x8DEA, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x4CA8, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x5CE9, 0x54CD, 0x8DD7, 0xAE79, 0x9E18, 0x6511, 0x3C68, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0x95F3, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x64E9, 0xA5EA, 0x7D4A, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x856A, 0x7D4A, 0x4CA8, 0x6D29, 0x856A, 0xA5EA, 0xA5EA, 0xA509, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x85AF, 0xAE79, 0x85B3, 0x4CA8, 0x5CE9, 0x3C68, 0x54CD, 0x7D76, 0x74F5, 0x544F, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x652F, 0xAE79, 0x9E18, 0x6511, 0x4CA8, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x5CE9, 0x64E9, 0x7D4A, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x64E9, 0xA5EA, 0xA5EA, 0xA5EA, 0x94A9, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x652F, 0xAE79, 0x9E18, 0x7551, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x3C68, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x64E9, 0xA5EA, 0xA5EA, 0x94A9, 0x8287, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x54CD, 0x74F5, 0x544F, 0x3C68, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x4CA8, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x856A, 0x7D4A, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x5CE9, 0x3C68, 0x53A8, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+    {0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x6D29, 0x7428, 0x8B07, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, 0xA3C8, },
+};
+
+#endif
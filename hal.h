@@ -0,0 +1,79 @@
+/**************************************************************
+ * Hardware abstraction layer
+ *
+ * Every device register the game uses is accessed through these macros
+ * by base address (address_map_nios2.h) and word offset.
+ *
+ * Built for the board by default, where the macros access the memory
+ * mapped registers directly. Define HAL_HOST to build for a Linux host
+ * instead, where the devices are simulated in memory by hal_host.c:
+ *   gcc -std=gnu99 -O2 -DHAL_HOST GoblinRush.c assets.c hal_host.c -o goblin_host
+ **************************************************************/
+#ifndef HAL_H
+#define HAL_H
+
+#ifndef HAL_HOST
+
+/*************** NIOS II ***********************/
+
+// Reads word register reg of the device at base
+#define IORD(base, reg) (*((volatile int*)(base) + (reg)))
+// Writes word register reg of the device at base
+#define IOWR(base, reg, value) (*((volatile int*)(base) + (reg)) = (value))
+// Writes the byte at offset of the memory at base
+#define IOWR_8(base, offset, value) \
+  (*((volatile char*)(base) + (offset)) = (value))
+
+// Back buffer of the pixel buffer controller
+#define HAL_BACK_BUFFER() ((short int*)IORD(PIXEL_BUF_CTRL_BASE, 1))
+#define HAL_SET_BACK_BUFFER(buffer) \
+  IOWR(PIXEL_BUF_CTRL_BASE, 1, (int)(buffer))
+
+// Sets the enabled interrupt lines and turns on processor interrupts
+#define HAL_IRQ_ENABLE(mask) \
+  do {                       \
+    __builtin_wrctl(3, mask); \
+    __builtin_wrctl(0, 1);   \
+  } while (0)
+// Interrupt lines currently pending
+#define HAL_IRQ_PENDING() __builtin_rdctl(4)
+
+#else
+
+/*************** LINUX HOST ***********************/
+
+// Register access of the simulated devices
+int hal_host_read(unsigned int base, unsigned int reg);
+void hal_host_write(unsigned int base, unsigned int reg, int value);
+void hal_host_write_8(unsigned int base, unsigned int offset, char value);
+// Back buffer of the simulated pixel buffer controller
+short int* hal_host_back_buffer();
+void hal_host_set_back_buffer(short int* buffer);
+// Interrupts of the simulated processor
+void hal_host_irq_enable(int mask);
+int hal_host_irq_pending();
+
+// Queues a byte as if sent by the device on a PS2 port
+void hal_host_ps2_send(unsigned int base, unsigned char byte);
+// Buffer currently shown by the simulated pixel buffer controller
+const short int* hal_host_front_buffer();
+// Text of the simulated character buffer, rows 128 bytes apart
+const char* hal_host_char_buffer();
+// Simulated processor clock cycles since start
+unsigned long long hal_host_cycles();
+// Sets the frames drawn before the program exits, 0 for no limit
+void hal_host_set_frame_limit(unsigned long long limit);
+
+#define IORD(base, reg) hal_host_read(base, reg)
+#define IOWR(base, reg, value) hal_host_write(base, reg, value)
+#define IOWR_8(base, offset, value) hal_host_write_8(base, offset, value)
+
+#define HAL_BACK_BUFFER() hal_host_back_buffer()
+#define HAL_SET_BACK_BUFFER(buffer) hal_host_set_back_buffer(buffer)
+
+#define HAL_IRQ_ENABLE(mask) hal_host_irq_enable(mask)
+#define HAL_IRQ_PENDING() hal_host_irq_pending()
+
+#endif
+
+#endif
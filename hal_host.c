@@ -0,0 +1,368 @@
+/**************************************************************
+ * Linux host backend of the hardware abstraction layer (hal.h)
+ *
+ * Simulates the devices the game uses as plain memory so the real game
+ * loop can run headless, under perf or valgrind:
+ *   gcc -std=gnu99 -O2 -DHAL_HOST GoblinRush.c assets.c hal_host.c -o goblin_host
+ *   GOBLIN_HOST_FRAMES=1800 ./goblin_host
+ *
+ * Time is simulated, not read from the host. The clock advances a little
+ * on every timer register read so busy waits finish, and jumps to the next
+ * vsync whenever the pixel buffers are swapped, so a run takes the same
+ * simulated time however fast the host is. The program exits after
+ * GOBLIN_HOST_FRAMES frames (default 600, ten simulated seconds), unless
+ * the program sets its own limit.
+ *
+ * The JTAG UART writes to stdout and reads from stdin without waiting.
+ * The slide switches read the value of GOBLIN_HOST_SW (default 0).
+ **************************************************************/
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "address_map_nios2.h"
+#include "hal.h"
+
+// Simulated processor clock
+#define HOST_CLOCK_HZ 100000000ULL
+#define HOST_VSYNC_HZ 60
+#define HOST_CYCLES_PER_FRAME (HOST_CLOCK_HZ / HOST_VSYNC_HZ)
+// Cycles a timer register read takes
+#define HOST_CYCLES_PER_POLL 100
+#define HOST_DEFAULT_FRAMES 600
+
+// Bytes a simulated PS2 FIFO holds, as on the board
+#define HOST_PS2_FIFO_SIZE 256
+
+// Called for pending interrupts, defined by the game
+void interrupt_handler();
+
+// Simulated interval timer
+typedef struct HostTimer {
+  unsigned int base;
+  // Count loaded when started
+  unsigned int period;
+  // Count when stopped
+  unsigned int count;
+  // Clock cycle the timer was started on
+  unsigned long long start_cycle;
+  unsigned int snapshot;
+  bool running;
+  bool cont;
+  bool timeout;
+} HostTimer;
+
+// Simulated PS2 port with a mouse or keyboard attached
+typedef struct HostPS2 {
+  unsigned int base;
+  unsigned char fifo[HOST_PS2_FIFO_SIZE];
+  unsigned int head;
+  unsigned int count;
+  // RE bit of control register
+  bool irq_enabled;
+  // Mouse also sends its device id after a reset
+  bool is_mouse;
+} HostPS2;
+
+// Memory shown before the game sets up its buffers
+static short int onchip_buffer[240][512];
+
+static unsigned long long cycles = 0;
+static unsigned long long frames = 0;
+static unsigned long long frame_limit = 0;
+// Limit was set by the program rather than GOBLIN_HOST_FRAMES
+static bool frame_limit_set = false;
+
+static short int* front_buffer = &onchip_buffer[0][0];
+static short int* back_buffer = &onchip_buffer[0][0];
+
+static HostTimer timers[2] = {{.base = TIMER_BASE}, {.base = TIMER_2_BASE}};
+static HostPS2 ps2_ports[2] = {{.base = PS2_BASE, .is_mouse = true},
+                               {.base = PS2_DUAL_BASE, .is_mouse = false}};
+static int hex_registers[2] = {0, 0};
+static char char_buffer[60 * 128];
+static int switches = -1;
+
+static int irq_mask = 0;
+static bool in_interrupt = false;
+
+/*************** TIMERS ***********************/
+
+// Returns the simulated timer at base, NULL if none
+static HostTimer* find_timer(unsigned int base) {
+  for (int i = 0; i < 2; i++) {
+    if (timers[i].base == base) return &timers[i];
+  }
+  return NULL;
+}
+
+// Brings a timer's count and timeout flag up to the current cycle
+static void update_timer(HostTimer* timer) {
+  if (!timer->running) return;
+  unsigned long long length = (unsigned long long)timer->period + 1;
+  unsigned long long elapsed = cycles - timer->start_cycle;
+  if (elapsed < length) {
+    timer->count = timer->period - (unsigned int)elapsed;
+    return;
+  }
+  timer->timeout = true;
+  if (timer->cont) {
+    timer->count = timer->period - (unsigned int)(elapsed % length);
+  } else {
+    timer->count = timer->period;
+    timer->running = false;
+  }
+}
+
+static int read_timer(HostTimer* timer, unsigned int reg) {
+  cycles += HOST_CYCLES_PER_POLL;
+  update_timer(timer);
+  switch (reg) {
+    case 0:
+      return (timer->running << 1) | timer->timeout;
+    case 2:
+      return timer->period & 0xFFFF;
+    case 3:
+      return timer->period >> 16;
+    case 4:
+      return timer->snapshot & 0xFFFF;
+    case 5:
+      return timer->snapshot >> 16;
+    default:
+      return 0;
+  }
+}
+
+static void write_timer(HostTimer* timer, unsigned int reg, int value) {
+  update_timer(timer);
+  switch (reg) {
+    // Any write clears the timeout flag
+    case 0:
+      timer->timeout = false;
+      break;
+    case 1:
+      timer->cont = value & 0x2;
+      // STOP
+      if (value & 0x8) {
+        timer->running = false;
+      }
+      // START, counts down from the current count
+      else if (value & 0x4) {
+        timer->running = true;
+        timer->start_cycle = cycles - (timer->period - timer->count);
+      }
+      break;
+    // Writing the period stops the timer and reloads the count
+    case 2:
+      timer->period = (timer->period & 0xFFFF0000) | (value & 0xFFFF);
+      timer->count = timer->period;
+      timer->running = false;
+      break;
+    case 3:
+      timer->period = (timer->period & 0xFFFF) | ((value & 0xFFFF) << 16);
+      timer->count = timer->period;
+      timer->running = false;
+      break;
+    // Any write latches the count
+    case 4:
+    case 5:
+      timer->snapshot = timer->count;
+      break;
+  }
+}
+
+/*************** PS2 ***********************/
+
+// Returns the simulated PS2 port at base, NULL if none
+static HostPS2* find_ps2(unsigned int base) {
+  for (int i = 0; i < 2; i++) {
+    if (ps2_ports[i].base == base) return &ps2_ports[i];
+  }
+  return NULL;
+}
+
+// Interrupt lines the simulated devices are raising
+static int raised_irqs() {
+  int raised = 0;
+  if (ps2_ports[0].irq_enabled && ps2_ports[0].count > 0) raised |= 1 << 7;
+  if (ps2_ports[1].irq_enabled && ps2_ports[1].count > 0) raised |= 1 << 23;
+  return raised;
+}
+
+// Runs the game's interrupt handler while an enabled interrupt is raised
+static void deliver_irqs() {
+  if (in_interrupt) return;
+  in_interrupt = true;
+  while (raised_irqs() & irq_mask) {
+    interrupt_handler();
+  }
+  in_interrupt = false;
+}
+
+// Adds a byte to the FIFO of a port, dropped if the FIFO is full
+static void push_ps2(HostPS2* port, unsigned char byte) {
+  if (port->count >= HOST_PS2_FIFO_SIZE) return;
+  port->fifo[(port->head + port->count) % HOST_PS2_FIFO_SIZE] = byte;
+  port->count++;
+}
+
+static int read_ps2(HostPS2* port, unsigned int reg) {
+  // Control register - RE and RI bits
+  if (reg == 1) {
+    return port->irq_enabled | ((port->irq_enabled && port->count > 0) << 8);
+  }
+  if (port->count == 0) return 0;
+  // Data register - RAVAIL, RVALID and data, pops the FIFO
+  int data = (port->count << 16) | 0x8000 | port->fifo[port->head];
+  port->head = (port->head + 1) % HOST_PS2_FIFO_SIZE;
+  port->count--;
+  return data;
+}
+
+static void write_ps2(HostPS2* port, unsigned int reg, int value) {
+  if (reg == 1) {
+    port->irq_enabled = value & 0x1;
+    deliver_irqs();
+    return;
+  }
+  // Command sent to the device - every command is acknowledged
+  push_ps2(port, 0xFA);
+  // Reset - passes self test, mouse sends its id
+  if ((value & 0xFF) == 0xFF) {
+    push_ps2(port, 0xAA);
+    if (port->is_mouse) push_ps2(port, 0x00);
+  }
+  deliver_irqs();
+}
+
+/*************** JTAG UART ***********************/
+
+static int read_jtag_uart(unsigned int reg) {
+  // Control register - always space to write
+  if (reg == 1) return 0xFFFF0000;
+
+  static bool nonblocking = false;
+  if (!nonblocking) {
+    fcntl(STDIN_FILENO, F_SETFL, fcntl(STDIN_FILENO, F_GETFL) | O_NONBLOCK);
+    nonblocking = true;
+  }
+  // Data register - RVALID and character if one was read
+  unsigned char character;
+  if (read(STDIN_FILENO, &character, 1) == 1) return 0x8000 | character;
+  return 0;
+}
+
+static void write_jtag_uart(unsigned int reg, int value) {
+  if (reg == 0) putchar(value & 0xFF);
+}
+
+/*************** PIXEL BUFFER ***********************/
+
+// Swaps the buffers on the next vsync
+static void swap_buffers() {
+  short int* shown = back_buffer;
+  back_buffer = front_buffer;
+  front_buffer = shown;
+  cycles += HOST_CYCLES_PER_FRAME - cycles % HOST_CYCLES_PER_FRAME;
+  frames++;
+
+  if (frame_limit == 0 && !frame_limit_set) {
+    const char* limit = getenv("GOBLIN_HOST_FRAMES");
+    frame_limit = limit != NULL ? strtoull(limit, NULL, 10) : 0;
+    if (frame_limit == 0) frame_limit = HOST_DEFAULT_FRAMES;
+  }
+  if (frame_limit != 0 && frames >= frame_limit) {
+    fprintf(stderr, "%llu frames in %.2f simulated seconds, hex %08x %08x\n",
+            frames, (double)cycles / HOST_CLOCK_HZ,
+            hex_registers[1], hex_registers[0]);
+    exit(0);
+  }
+}
+
+/*************** HAL ***********************/
+
+// Reads a register of a simulated device
+int hal_host_read(unsigned int base, unsigned int reg) {
+  HostTimer* timer = find_timer(base);
+  if (timer != NULL) return read_timer(timer, reg);
+  HostPS2* port = find_ps2(base);
+  if (port != NULL) return read_ps2(port, reg);
+
+  if (base == JTAG_UART_BASE) return read_jtag_uart(reg);
+  if (base == SW_BASE) {
+    if (switches < 0) {
+      const char* value = getenv("GOBLIN_HOST_SW");
+      switches = value != NULL ? strtol(value, NULL, 0) & 0x3FF : 0;
+    }
+    return switches;
+  }
+  if (base == HEX3_HEX0_BASE) return hex_registers[0];
+  if (base == HEX5_HEX4_BASE) return hex_registers[1];
+  // Swaps finish immediately, never pending
+  return 0;
+}
+
+// Writes a register of a simulated device
+void hal_host_write(unsigned int base, unsigned int reg, int value) {
+  HostTimer* timer = find_timer(base);
+  if (timer != NULL) {
+    write_timer(timer, reg, value);
+    return;
+  }
+  HostPS2* port = find_ps2(base);
+  if (port != NULL) {
+    write_ps2(port, reg, value);
+    return;
+  }
+
+  if (base == JTAG_UART_BASE) write_jtag_uart(reg, value);
+  if (base == HEX3_HEX0_BASE) hex_registers[0] = value;
+  if (base == HEX5_HEX4_BASE) hex_registers[1] = value;
+  if (base == PIXEL_BUF_CTRL_BASE && reg == 0) swap_buffers();
+}
+
+// Writes a byte of simulated memory, only the character buffer is kept
+void hal_host_write_8(unsigned int base, unsigned int offset, char value) {
+  if (base == FPGA_CHAR_BASE && offset < sizeof(char_buffer)) {
+    char_buffer[offset] = value;
+  }
+}
+
+// Back buffer of the simulated pixel buffer controller
+short int* hal_host_back_buffer() { return back_buffer; }
+
+void hal_host_set_back_buffer(short int* buffer) { back_buffer = buffer; }
+
+// Sets the enabled interrupt lines and turns on processor interrupts
+void hal_host_irq_enable(int mask) {
+  irq_mask = mask;
+  deliver_irqs();
+}
+
+// Interrupt lines currently pending
+int hal_host_irq_pending() { return raised_irqs() & irq_mask; }
+
+// Queues a byte as if sent by the device on a PS2 port
+void hal_host_ps2_send(unsigned int base, unsigned char byte) {
+  HostPS2* port = find_ps2(base);
+  if (port == NULL) return;
+  push_ps2(port, byte);
+  deliver_irqs();
+}
+
+// Buffer currently shown by the simulated pixel buffer controller
+const short int* hal_host_front_buffer() { return front_buffer; }
+
+// Text of the simulated character buffer, rows 128 bytes apart
+const char* hal_host_char_buffer() { return char_buffer; }
+
+// Simulated processor clock cycles since start
+unsigned long long hal_host_cycles() { return cycles; }
+
+// Sets the frames drawn before the program exits, 0 for no limit
+void hal_host_set_frame_limit(unsigned long long limit) {
+  frame_limit = limit;
+  frame_limit_set = true;
+}
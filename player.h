@@ -15,98 +15,5 @@ void updateCursor(Cursor* cursor, MouseData mouse);
 
 // Function called to handle when player hit by enemy
 void collisionHandler(Player* player);
-unsigned short int wizard_idle[16][96] = {
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x10A3, 0xFC24, 0x10A3, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0xFC24, 0x10A3, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x10A3, 0xFC24, 0x10A3, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x10A3, 0xFC24, 0x10A3, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x10A3, 0xFC24, 0x10A3, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x10A3, 0xFC24, 0x10A3, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x910D, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, },
-};
 
-unsigned short int wizard_run[16][96] = {
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x910D, 0xFC24, 0x10A3, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x10A3, 0xFC24, 0x10A3, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x910D, 0xFC24, 0x10A3, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x10A3, 0xFC24, 0x10A3, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x10A3, 0xFC24, 0x10A3, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x10A3, 0xFC24, 0x10A3, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x910D, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x910D, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x7920, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x10A3, 0x7920, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x7920, 0x10A3, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-};
-
-unsigned short int wizard_evade[16][96] = {
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x10A3, 0xFC24, 0x10A3, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x10A3, 0xFC24, 0x10A3, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0xFC24, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x10A3, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x910D, 0xFC24, 0x10A3, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x10A3, 0xFC24, 0x10A3, 0x7920, 0x10A3, 0x10A3, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0xFC24, 0x910D, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, },
-};
-
-unsigned short int wizard_hit[16][48] = {
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x10A3, 0x10A3, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0xFC24, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x10A3, 0xFC24, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0xFC24, 0xFC24, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x910D, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10A3, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0xFC24, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x0000, 0x0000, 0x10A3, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x0000, 0x0000, 0x0000, 0x10A3, 0x7920, 0x7920, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, },
-};
-
-unsigned short int wizard_attack[16][96] = {
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x18E4, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2966, 0x20E3, 0x0000, 0x18E4, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4A6A, 0x636D, 0x528A, 0x0861, 0x0000, 0x0000, 0x0000, 0x10C3, 0x630C, 0xBB85, 0x4A07, 0x4AAB, 0x4A8A, 0x4A8A, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31A6, 0x5B0C, 0x52CB, 0x3A08, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x322A, 0x9B88, 0x8A84, 0x0021, 0x0000, 0x0000, 0x0000, 0x10A3, 0x6B8E, 0x5B0C, 0x31A7, 0x0000, 0x0841, 0x1904, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x7C10, 0x9D55, 0x632C, 0x638E, 0x0882, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0882, 0x528A, 0x18A2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10A3, 0x10C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x6BD0, 0x6A67, 0x8329, 0x4AAB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18E4, 0x4A8A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x31A6, 0x84B4, 0x7A03, 0x6AEA, 0x10E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x4AAB, 0x18E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x8CB4, 0x732B, 0x7A65, 0x3A2A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1062, 0x1863, 0x0020, 0x0000, 0x0000, 0x4A8A, 0x18E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1042, 0x1863, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5B2D, 0x736D, 0xAAC3, 0x52AB, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1062, 0x1862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3885, 0x810C, 0x6128, 0x6909, 0x0821, 0x0000, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x38A5, 0x790A, 0x5107, 0x60E9, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x52EC, 0x73CF, 0xDC88, 0x62AA, 0x1904, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x38A5, 0x690A, 0x48E8, 0x2885, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1062, 0x50C8, 0x40C7, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x38A5, 0x50C8, 0x2884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1062, 0x690A, 0x78CB, 0x5965, 0x5908, 0x1863, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1062, 0x790B, 0x912C, 0x7987, 0x790B, 0x1063, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1042, 0x1863, 0x1022, 0x5AEC, 0x73EF, 0xD4A9, 0x5AAA, 0x18E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x1062, 0x912D, 0x10A3, 0x20E3, 0x5927, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x40A6, 0x890D, 0x4906, 0x4125, 0x48E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0821, 0x70EB, 0x790A, 0x3103, 0x6128, 0x1862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0861, 0x70EA, 0x90ED, 0x5907, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1021, 0x28C4, 0x68CA, 0xB16E, 0x9A27, 0x38C2, 0x1061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0821, 0x58C9, 0x7129, 0x5108, 0x48A5, 0x5AEC, 0x63D0, 0xCC68, 0x62AA, 0x18E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x68EA, 0x30A6, 0x3923, 0x71A6, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x40E6, 0x58E9, 0x5966, 0x5184, 0x58E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1041, 0x40C7, 0x7129, 0x3962, 0x7988, 0x1022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2884, 0x890C, 0xA14C, 0x99AA, 0x0842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2084, 0x890C, 0x990E, 0x6127, 0x7940, 0x1861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x48E7, 0x78EC, 0x6986, 0x0881, 0x3942, 0x73F0, 0x8B49, 0xEBA3, 0x5ACB, 0x18E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x3084, 0x78CB, 0xA12D, 0x998A, 0x4868, 0x10C3, 0x18A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1883, 0x68A9, 0x90EC, 0x8148, 0x38E7, 0x3229, 0x4A6A, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x40C6, 0x88AC, 0x914A, 0x60C8, 0x2187, 0x4A8B, 0x2986, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x812B, 0x90CF, 0xB20B, 0x6925, 0x48E1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x810B, 0x90AF, 0xBA0B, 0x5163, 0x30A1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x30A6, 0x90CD, 0x61AA, 0x538E, 0x6C52, 0x5983, 0x6A04, 0x7C32, 0x10A2, 0x0000, 0x0000, 0x0000, 0x40A5, 0x70EB, 0x616A, 0x5908, 0x50A6, 0x41E8, 0x5B0B, 0x6B8E, 0x10A3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x40C5, 0x60EA, 0x3A4A, 0x59EA, 0x71AA, 0x528A, 0x9B88, 0x636E, 0x18E4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x70E9, 0x4169, 0x426B, 0x718A, 0x49EA, 0x8349, 0x838B, 0x4AAB, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0x9A47, 0xBA69, 0x71E4, 0x30C1, 0x28A1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0x9A47, 0xC289, 0x4962, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x30A4, 0xA98D, 0xB1AC, 0xAA49, 0x71A9, 0x81C8, 0x28E2, 0x0042, 0x31C7, 0x0000, 0x0000, 0x0000, 0x0861, 0xA267, 0x81C8, 0x3249, 0x428A, 0x428A, 0x4A07, 0xBB65, 0x5B0C, 0x10C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5184, 0xBA88, 0x82C5, 0x62A8, 0x3A6A, 0x2103, 0x8284, 0x528A, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0xA247, 0x9AA7, 0x82C6, 0x4AAA, 0x29A7, 0x5141, 0x8309, 0x2166, 0x0000, 0x0000, 0x0000, },
-    {0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x5901, 0x3901, 0x18C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x5901, 0x3901, 0x18C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x38C2, 0x81C3, 0x9284, 0x8244, 0x8A24, 0x9244, 0x9245, 0x6162, 0x2081, 0x0000, 0x0000, 0x0000, 0x0020, 0x5901, 0x3901, 0x20A2, 0x0000, 0x1082, 0x1925, 0x40C1, 0x5143, 0x2986, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x28A1, 0x5901, 0x20E1, 0x28C1, 0x1061, 0x40A0, 0x6101, 0x0022, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x5901, 0x3101, 0x20C1, 0x20A1, 0x40A0, 0x7900, 0x0021, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, },
-};
 #endif
\ No newline at end of file
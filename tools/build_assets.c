@@ -0,0 +1,511 @@
+/**************************************************************
+ * Asset builder for Goblin Rush
+ *
+ * Host tool that compiles the raw RGB565 sprites in sprites.h and the arena
+ * backgrounds in background.h into the asset module the game draws from:
+ *   assets.c  const data for every asset, placed in read-only memory
+ *   assets.h  extern declarations, asset types and a manifest of the
+ *             dimensions and frame counts of every asset
+ *
+ * Build and run from the repository root:
+ *   gcc -O2 -o build_assets tools/build_assets.c
+ *   ./build_assets
+ *
+ * Animation sheets are palette indexed and run-length encoded. Each sheet
+ * has its own RGB565 palette, with index 0 reserved for transparency, and
+ * stores 4 bit indices if its colours fit in 15 entries or 8 bit indices
+ * otherwise. Every frame row is stored as the number of runs in the row
+ * followed by each run: the transparent pixels to skip, the opaque pixels
+ * in the run and then their indices, two to a byte with the first in the
+ * low nibble for 4 bit sheets. Rows are stored one after another. Every
+ * frame is also encoded mirrored horizontally so sprites can face either way
+ * without the game flipping them while drawing.
+ *
+ * Backgrounds are cut into 8x8 tiles and every distinct tile is stored once,
+ * with a map of the tile at every position on screen.
+ *
+ * Small sprites are copied as they are.
+ */
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "../background.h"
+#include "../sprites.h"
+
+#define ARRAYSIZE(a) (sizeof(a) / sizeof(a[0]))
+
+// Describes a sprite sheet to convert
+typedef struct SheetInfo {
+  // Name of the sheet array
+  const char* name;
+  // First pixel of the sheet
+  const unsigned short int* pixels;
+  // Dimensions of the whole sheet
+  unsigned int sheet_width;
+  unsigned int height;
+  // Width of a single frame
+  unsigned int frame_width;
+} SheetInfo;
+
+#define SHEET(sheet, frame_width) \
+  {#sheet, &sheet[0][0], ARRAYSIZE(sheet[0]), ARRAYSIZE(sheet), frame_width}
+
+// Sheets compiled into run-length encoded frames
+static const SheetInfo sheets[] = {
+    SHEET(goblin_D_Attack, 48), SHEET(goblin_D_Walk, 48),
+    SHEET(goblin_S_Attack, 48), SHEET(goblin_S_Walk, 48),
+    SHEET(goblin_U_Walk, 48),   SHEET(goblin_U_Attack, 48),
+    SHEET(goblin_Death, 48),    SHEET(wizard_idle, 16),
+    SHEET(wizard_run, 16),      SHEET(wizard_evade, 16),
+    SHEET(wizard_hit, 16),      SHEET(wizard_attack, 16),
+    SHEET(wizard_dying, 16),    SHEET(wizard_decomposing, 16),
+};
+
+// Sprites copied as they are, a single frame each
+static const SheetInfo images[] = {
+    SHEET(cursor_sprite, 13),
+    SHEET(potion, 16),
+    SHEET(empty_potion, 16),
+};
+
+// Large enough for the encoding of any sheet
+#define MAX_ENCODED_SIZE (48 * 288 * 4)
+// Palette entries with 8 bit indices, index 0 is transparent
+#define MAX_COLOURS 256
+// Most frames in a single sheet
+#define MAX_FRAMES 32
+// Widest frame in any sheet
+#define MAX_FRAME_WIDTH 64
+
+#define SCREEN_WIDTH 320
+#define SCREEN_HEIGHT 240
+#define TILE_SHIFT 3
+#define TILE_SIZE (1 << TILE_SHIFT)
+#define TILE_PIXELS (TILE_SIZE * TILE_SIZE)
+#define MAP_COLUMNS (SCREEN_WIDTH / TILE_SIZE)
+#define MAP_ROWS (SCREEN_HEIGHT / TILE_SIZE)
+// Every tile on screen is different
+#define MAX_TILES (MAP_COLUMNS * MAP_ROWS)
+
+// Describes a background to convert
+typedef struct ArenaInfo {
+  // Name of the background array
+  const char* name;
+  // Background pixels, rows SCREEN_WIDTH apart
+  const unsigned short int (*pixels)[SCREEN_WIDTH];
+} ArenaInfo;
+
+#define ARENA(background) {#background, background}
+
+// Backgrounds compiled into tiles
+static const ArenaInfo arenas[] = {
+    ARENA(bg),
+};
+
+// Types the game uses to draw assets, written at the top of assets.h
+static const char* asset_types =
+    "// Sprite frame compiled into runs of opaque palette indices\n"
+    "// Each row is stored as the number of runs in the row, then for every "
+    "run the\n"
+    "// transparent pixels to skip, the length of the run and its indices\n"
+    "typedef struct RLESprite {\n"
+    "  // Dimensions of the frame\n"
+    "  unsigned short int width;\n"
+    "  unsigned short int height;\n"
+    "  // Bits per index, 4 with two indices to a byte, first in the low "
+    "nibble,\n"
+    "  // or 8\n"
+    "  unsigned short int bits;\n"
+    "  // RGB565 colour of each index of the sheet\n"
+    "  const unsigned short int* palette;\n"
+    "  // Encoded rows of the frame as drawn in the sheet [0] and mirrored\n"
+    "  // horizontally [1], indexed by the reverse flag when drawing\n"
+    "  const unsigned char* data[2];\n"
+    "} RLESprite;\n"
+    "\n"
+    "// Arena background tiles\n"
+    "#define BG_TILE_SHIFT %u\n"
+    "#define BG_TILE_SIZE (1 << BG_TILE_SHIFT)\n"
+    "#define BG_TILE_MASK (BG_TILE_SIZE - 1)\n"
+    "#define BG_TILE_PIXELS (BG_TILE_SIZE * BG_TILE_SIZE)\n"
+    "#define BG_MAP_COLUMNS %u\n"
+    "#define BG_MAP_ROWS %u\n"
+    "\n"
+    "// Arena background split into tiles, each distinct tile is stored once\n"
+    "typedef struct Background {\n"
+    "  // Pixels of every tile, rows one after another\n"
+    "  const unsigned short int (*tiles)[BG_TILE_PIXELS];\n"
+    "  // Index into tiles of every tile on screen, row by row\n"
+    "  const unsigned short int (*map)[BG_MAP_COLUMNS];\n"
+    "} Background;\n"
+    "\n"
+    "// Entry of the asset manifest\n"
+    "typedef struct AssetInfo {\n"
+    "  const char* name;\n"
+    "  // Dimensions of a single frame\n"
+    "  unsigned short int width;\n"
+    "  unsigned short int height;\n"
+    "  unsigned short int frames;\n"
+    "  // Size of the asset data\n"
+    "  unsigned int bytes;\n"
+    "} AssetInfo;\n"
+    "\n";
+
+// Entry of the asset manifest, as AssetInfo in assets.h
+typedef struct ManifestEntry {
+  const char* name;
+  unsigned int width;
+  unsigned int height;
+  unsigned int frames;
+  unsigned int bytes;
+} ManifestEntry;
+
+// Generated files
+static FILE* source;
+static FILE* header;
+
+// Manifest entries written so far
+static ManifestEntry manifest[ARRAYSIZE(sheets) + ARRAYSIZE(images) +
+                          ARRAYSIZE(arenas)];
+static unsigned int manifest_count = 0;
+
+// Returns if a pixel is drawn
+static bool is_opaque(unsigned short int colour) {
+  return colour != 0xFFFF && colour != 0x0000;
+}
+
+// Writes values as the body of a C array, twelve to a line
+static void write_values(const unsigned short int* values, unsigned int count) {
+  for (unsigned int i = 0; i < count; i++) {
+    if (i % 12 == 0) fprintf(source, "\n    ");
+    fprintf(source, "0x%04X, ", values[i]);
+  }
+  fprintf(source, "\n};\n");
+}
+
+// Writes bytes as the body of a C array, sixteen to a line
+static void write_bytes(const unsigned char* values, unsigned int count) {
+  for (unsigned int i = 0; i < count; i++) {
+    if (i % 16 == 0) fprintf(source, "\n    ");
+    fprintf(source, "0x%02X, ", values[i]);
+  }
+  fprintf(source, "\n};\n");
+}
+
+// Writes the frame dimension and frame count macros of an asset and adds it
+// to the manifest
+static void write_manifest_entry(const char* name, unsigned int width,
+                                 unsigned int height, unsigned int frames,
+                                 unsigned int bytes) {
+  char macro[64];
+  unsigned int i = 0;
+  for (; name[i] != '\0' && i < sizeof(macro) - 1; i++) {
+    macro[i] = toupper((unsigned char)name[i]);
+  }
+  macro[i] = '\0';
+
+  fprintf(header, "#define %s_WIDTH %u\n", macro, width);
+  fprintf(header, "#define %s_HEIGHT %u\n", macro, height);
+  fprintf(header, "#define %s_FRAMES %u\n", macro, frames);
+  manifest[manifest_count++] =
+      (ManifestEntry){name, width, height, frames, bytes};
+}
+
+/*************** RUN-LENGTH ENCODED SHEETS ***********************/
+
+// Palette of a sheet being encoded
+typedef struct Palette {
+  unsigned short int colours[MAX_COLOURS];
+  unsigned int count;
+  // Bits per index
+  unsigned int bits;
+} Palette;
+
+// Returns the palette index of an opaque colour, adding it if new
+// Returns 0 once the palette is full
+static unsigned int palette_index(Palette* palette, unsigned short int colour) {
+  for (unsigned int i = 1; i < palette->count; i++) {
+    if (palette->colours[i] == colour) return i;
+  }
+  if (palette->count == MAX_COLOURS) return 0;
+  palette->colours[palette->count] = colour;
+  return palette->count++;
+}
+
+// Collects the colours of a sheet in order of first use
+// Returns false if the sheet has more colours than 8 bit indices can hold
+static bool build_palette(const SheetInfo* sheet, Palette* palette) {
+  // Index 0 is transparent and never drawn
+  palette->colours[0] = 0x0000;
+  palette->count = 1;
+  unsigned int size = sheet->sheet_width * sheet->height;
+  for (unsigned int i = 0; i < size; i++) {
+    if (is_opaque(sheet->pixels[i]) &&
+        palette_index(palette, sheet->pixels[i]) == 0) {
+      return false;
+    }
+  }
+  palette->bits = palette->count <= 16 ? 4 : 8;
+  return true;
+}
+
+// Encodes a single frame into out, returns number of bytes written
+// If mirror is set, rows are read right to left
+static unsigned int encode_frame(const SheetInfo* sheet, Palette* palette,
+                                 unsigned int frame, bool mirror,
+                                 unsigned char* out) {
+  unsigned int size = 0;
+  for (unsigned int i = 0; i < sheet->height; i++) {
+    const unsigned short int* src =
+        sheet->pixels + i * sheet->sheet_width + frame * sheet->frame_width;
+    // Row of frame in the order it is drawn
+    unsigned short int row[MAX_FRAME_WIDTH];
+    for (unsigned int j = 0; j < sheet->frame_width; j++) {
+      row[j] = mirror ? src[sheet->frame_width - 1 - j] : src[j];
+    }
+    // Reserve space for number of runs in row
+    unsigned int run_count_idx = size++;
+    unsigned char runs = 0;
+    unsigned int j = 0;
+    while (j < sheet->frame_width) {
+      // Count transparent pixels before run
+      unsigned int skip = 0;
+      while (j < sheet->frame_width && !is_opaque(row[j])) {
+        skip++;
+        j++;
+      }
+      // Rest of row is transparent
+      if (j == sheet->frame_width) break;
+
+      // Copy indices of opaque pixels of run
+      unsigned int length_idx = size + 1;
+      out[size] = skip;
+      size += 2;
+      unsigned char length = 0;
+      while (j < sheet->frame_width && is_opaque(row[j])) {
+        unsigned int index = palette_index(palette, row[j]);
+        if (palette->bits == 8) {
+          out[size++] = index;
+        } else if (length % 2 == 0) {
+          out[size++] = index;
+        } else {
+          out[size - 1] |= index << 4;
+        }
+        length++;
+        j++;
+      }
+      out[length_idx] = length;
+      runs++;
+    }
+    out[run_count_idx] = runs;
+  }
+  return size;
+}
+
+// Writes encoded sheet and its palette as C arrays
+// Returns the bytes written, 0 if the sheet could not be encoded
+static unsigned int write_sheet(const SheetInfo* sheet) {
+  static unsigned char encoded[MAX_ENCODED_SIZE];
+  Palette palette;
+  unsigned int num_frames = sheet->sheet_width / sheet->frame_width;
+  unsigned int offsets[MAX_FRAMES][2];
+  unsigned int size = 0;
+
+  if (!build_palette(sheet, &palette)) {
+    fprintf(stderr, "%s has more than %u colours\n", sheet->name,
+            MAX_COLOURS - 1);
+    return 0;
+  }
+  for (unsigned int f = 0; f < num_frames; f++) {
+    offsets[f][0] = size;
+    size += encode_frame(sheet, &palette, f, false, encoded + size);
+    offsets[f][1] = size;
+    size += encode_frame(sheet, &palette, f, true, encoded + size);
+  }
+
+  fprintf(source, "// %s: %u frames of %ux%u, %u colours\n", sheet->name,
+          num_frames, sheet->frame_width, sheet->height, palette.count - 1);
+  fprintf(source, "static const unsigned short int %s_palette[%u] = {",
+          sheet->name, palette.count);
+  write_values(palette.colours, palette.count);
+  fprintf(source, "static const unsigned char %s_rle_data[%u] = {",
+          sheet->name, size);
+  write_bytes(encoded, size);
+
+  fprintf(source, "const RLESprite %s_rle[%u] = {\n", sheet->name,
+          num_frames);
+  for (unsigned int f = 0; f < num_frames; f++) {
+    fprintf(source,
+            "    {%u, %u, %u, %s_palette, {%s_rle_data + %u, "
+            "%s_rle_data + %u}},\n",
+            sheet->frame_width, sheet->height, palette.bits, sheet->name,
+            sheet->name, offsets[f][0], sheet->name, offsets[f][1]);
+  }
+  fprintf(source, "};\n\n");
+
+  unsigned int bytes = size + palette.count * 2;
+  write_manifest_entry(sheet->name, sheet->frame_width, sheet->height,
+                       num_frames, bytes);
+  fprintf(header, "extern const RLESprite %s_rle[%u];\n\n", sheet->name,
+          num_frames);
+
+  fprintf(stderr, "%-20s %6u bytes raw %6u bytes encoded, %u bit\n",
+          sheet->name, sheet->sheet_width * sheet->height * 2, bytes,
+          palette.bits);
+  return bytes;
+}
+
+/*************** TILED BACKGROUNDS ***********************/
+
+// Copies the tile at column and row of the map out of a background
+static void cut_tile(const ArenaInfo* arena, unsigned int column,
+                     unsigned int row, unsigned short int* tile) {
+  for (unsigned int i = 0; i < TILE_SIZE; i++) {
+    memcpy(tile + i * TILE_SIZE,
+           &arena->pixels[row * TILE_SIZE + i][column * TILE_SIZE],
+           TILE_SIZE * sizeof(unsigned short int));
+  }
+}
+
+// Writes the tiles and map of a background as C arrays
+static unsigned int write_arena(const ArenaInfo* arena) {
+  static unsigned short int tiles[MAX_TILES][TILE_PIXELS];
+  unsigned short int map[MAP_ROWS][MAP_COLUMNS];
+  unsigned int num_tiles = 0;
+
+  for (unsigned int row = 0; row < MAP_ROWS; row++) {
+    for (unsigned int column = 0; column < MAP_COLUMNS; column++) {
+      unsigned short int tile[TILE_PIXELS];
+      cut_tile(arena, column, row, tile);
+      // Reuse an identical tile if there is one
+      unsigned int index = 0;
+      while (index < num_tiles &&
+             memcmp(tiles[index], tile, sizeof(tile)) != 0) {
+        index++;
+      }
+      if (index == num_tiles) {
+        memcpy(tiles[num_tiles++], tile, sizeof(tile));
+      }
+      map[row][column] = index;
+    }
+  }
+
+  fprintf(source, "// %s: %u tiles of %ux%u\n", arena->name, num_tiles,
+          TILE_SIZE, TILE_SIZE);
+  fprintf(source, "static const unsigned short int %s_tiles[%u][%u] = {\n",
+          arena->name, num_tiles, TILE_PIXELS);
+  for (unsigned int t = 0; t < num_tiles; t++) {
+    fprintf(source, "    {");
+    for (unsigned int i = 0; i < TILE_PIXELS; i++) {
+      if (i > 0 && i % TILE_SIZE == 0) fprintf(source, "\n     ");
+      fprintf(source, "0x%04X, ", tiles[t][i]);
+    }
+    fprintf(source, "},\n");
+  }
+  fprintf(source, "};\n");
+
+  fprintf(source, "static const unsigned short int %s_map[%u][%u] = {\n",
+          arena->name, MAP_ROWS, MAP_COLUMNS);
+  for (unsigned int row = 0; row < MAP_ROWS; row++) {
+    fprintf(source, "    {");
+    for (unsigned int column = 0; column < MAP_COLUMNS; column++) {
+      fprintf(source, "%u, ", map[row][column]);
+    }
+    fprintf(source, "},\n");
+  }
+  fprintf(source, "};\n");
+  fprintf(source, "const Background %s_background = {%s_tiles, %s_map};\n\n",
+          arena->name, arena->name, arena->name);
+
+  unsigned int size = num_tiles * TILE_PIXELS * 2 + sizeof(map);
+  write_manifest_entry(arena->name, SCREEN_WIDTH, SCREEN_HEIGHT, 1, size);
+  fprintf(header, "extern const Background %s_background;\n\n", arena->name);
+
+  fprintf(stderr, "%-20s %6u bytes raw %6u bytes tiled\n", arena->name,
+          SCREEN_WIDTH * SCREEN_HEIGHT * 2, size);
+  return size;
+}
+
+/*************** RAW SPRITES ***********************/
+
+// Writes a sprite as a C array as it is, one brace group per row
+static unsigned int write_image(const SheetInfo* image) {
+  unsigned int size = image->sheet_width * image->height;
+
+  fprintf(source, "// %s: %ux%u\n", image->name, image->sheet_width,
+          image->height);
+  fprintf(source, "const unsigned short int %s[%u][%u] = {\n", image->name,
+          image->height, image->sheet_width);
+  for (unsigned int row = 0; row < image->height; row++) {
+    const unsigned short int* pixels = image->pixels + row * image->sheet_width;
+    fprintf(source, "    {");
+    for (unsigned int i = 0; i < image->sheet_width; i++) {
+      if (i > 0 && i % 12 == 0) fprintf(source, "\n     ");
+      fprintf(source, "0x%04X, ", pixels[i]);
+    }
+    fprintf(source, "},\n");
+  }
+  fprintf(source, "};\n\n");
+
+  write_manifest_entry(image->name, image->sheet_width, image->height, 1,
+                       size * 2);
+  fprintf(header, "extern const unsigned short int %s[%u][%u];\n\n",
+          image->name, image->height, image->sheet_width);
+
+  fprintf(stderr, "%-20s %6u bytes raw\n", image->name, size * 2);
+  return size * 2;
+}
+
+int main() {
+  unsigned int total = 0;
+
+  source = fopen("assets.c", "w");
+  header = fopen("assets.h", "w");
+  if (source == NULL || header == NULL) {
+    perror("assets");
+    return 1;
+  }
+
+  fprintf(source,
+          "// Generated by tools/build_assets.c from sprites.h and "
+          "background.h - do not edit\n");
+  fprintf(source, "#include \"assets.h\"\n\n");
+  fprintf(header,
+          "// Generated by tools/build_assets.c from sprites.h and "
+          "background.h - do not edit\n");
+  fprintf(header, "#ifndef ASSETS_H\n#define ASSETS_H\n\n");
+  fprintf(header, asset_types, TILE_SHIFT, MAP_COLUMNS, MAP_ROWS);
+
+  for (unsigned int i = 0; i < ARRAYSIZE(sheets); i++) {
+    unsigned int bytes = write_sheet(&sheets[i]);
+    if (bytes == 0) return 1;
+    total += bytes;
+  }
+  for (unsigned int i = 0; i < ARRAYSIZE(arenas); i++) {
+    total += write_arena(&arenas[i]);
+  }
+  for (unsigned int i = 0; i < ARRAYSIZE(images); i++) {
+    total += write_image(&images[i]);
+  }
+
+  // Manifest of every asset written
+  fprintf(source, "const AssetInfo asset_manifest[%u] = {\n", manifest_count);
+  for (unsigned int i = 0; i < manifest_count; i++) {
+    fprintf(source, "    {\"%s\", %u, %u, %u, %u},\n", manifest[i].name,
+            manifest[i].width, manifest[i].height, manifest[i].frames,
+            manifest[i].bytes);
+  }
+  fprintf(source, "};\n");
+  fprintf(header, "// Every asset above\n");
+  fprintf(header, "#define ASSET_COUNT %u\n", manifest_count);
+  fprintf(header, "extern const AssetInfo asset_manifest[ASSET_COUNT];\n\n");
+  fprintf(header, "#endif\n");
+
+  fclose(source);
+  fclose(header);
+  fprintf(stderr, "total %u bytes of assets\n", total);
+  return 0;
+}